@@ -0,0 +1,52 @@
+#include "bench_common.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+/*
+    Replaces the global allocation functions so benchmarks can report
+    allocations per operation. Counting is a single relaxed increment.
+*/
+
+namespace {
+    std::atomic<std::size_t> allocations{ 0 };
+}
+
+std::size_t blaze::bench::allocation_count()
+{
+    return allocations.load(std::memory_order_relaxed);
+}
+
+void* operator new(std::size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return ::operator new(size);
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
@@ -0,0 +1,65 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <Blaze2D/util/ColorBatch.h>
+
+#include "bench_common.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+    std::vector<blaze::Color32> random_colors(std::size_t count, unsigned seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<int> byte(0, 255);
+
+        std::vector<blaze::Color32> colors(count);
+        for (auto& c : colors) {
+            c = blaze::Color32(static_cast<uint8_t>(byte(rng)), static_cast<uint8_t>(byte(rng)),
+                static_cast<uint8_t>(byte(rng)), static_cast<uint8_t>(byte(rng)));
+        }
+        return colors;
+    }
+
+} // namespace
+
+TEST_CASE("Batched color conversion and blending per SIMD path", "[ColorBatch][bench]")
+{
+    // One tint per vertex of 10k quads.
+    constexpr std::size_t count = 40'000;
+    const std::vector<blaze::Color32> from = random_colors(count, 1);
+    const std::vector<blaze::Color32> to = random_colors(count, 2);
+    std::vector<blaze::Color32> scratch = from;
+    std::vector<blaze::Color> floats(count);
+    blaze::batch::unpack(from, floats);
+
+    const blaze::SimdLevel original = blaze::batch::level();
+
+    for (blaze::SimdLevel requested : { blaze::SimdLevel::Scalar, blaze::SimdLevel::SSE2, blaze::SimdLevel::AVX2, blaze::SimdLevel::NEON }) {
+        const blaze::SimdLevel level = blaze::batch::forceLevel(requested);
+        if (level != requested)
+            continue;
+        const std::string name = blaze::batch::levelName(level);
+
+        double lerp = blaze::bench::seconds_per_call([&] { blaze::batch::lerp(from, to, 0.3f, scratch); });
+        double blend = blaze::bench::seconds_per_call([&] { blaze::batch::blend(from, scratch); });
+        double pack = blaze::bench::seconds_per_call([&] { blaze::batch::pack(floats, scratch); });
+        double unpack = blaze::bench::seconds_per_call([&] { blaze::batch::unpack(from, floats); });
+        std::printf("color_batch.%s colors=%zu lerp_ns=%.3f blend_ns=%.3f pack_ns=%.3f unpack_ns=%.3f (per color)\n",
+            name.c_str(), count, lerp * 1e9 / count, blend * 1e9 / count, pack * 1e9 / count, unpack * 1e9 / count);
+
+        BENCHMARK("lerp 40k colors " + name) {
+            blaze::batch::lerp(from, to, 0.3f, scratch);
+            return scratch[0].r;
+        };
+
+        BENCHMARK("pack 40k colors " + name) {
+            blaze::batch::pack(floats, scratch);
+            return scratch[0].r;
+        };
+    }
+
+    blaze::batch::forceLevel(original);
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+
+namespace blaze::bench {
+
+    // Number of global operator new calls made so far (all threads).
+    std::size_t allocation_count();
+
+    // Unique path in the system temp directory.
+    inline std::filesystem::path temp_path(const std::string& stem, const std::string& extension)
+    {
+        using namespace std::chrono;
+        auto stamp = duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+        return std::filesystem::temp_directory_path() / (stem + "_" + std::to_string(stamp) + extension);
+    }
+
+    /**
+    * @brief Runs fn repeatedly for at least minSeconds and returns seconds per call.
+    * Used for derived throughput figures (lines/sec etc.) next to Catch2's BENCHMARK output.
+    */
+    template <typename Fn>
+    double seconds_per_call(Fn&& fn, double minSeconds = 0.25)
+    {
+        using clock = std::chrono::steady_clock;
+        std::size_t calls = 0;
+        auto start = clock::now();
+        double elapsed = 0.0;
+        do {
+            fn();
+            ++calls;
+            elapsed = std::chrono::duration<double>(clock::now() - start).count();
+        } while (elapsed < minSeconds);
+        return elapsed / static_cast<double>(calls);
+    }
+
+    // Allocations performed by a single call to fn.
+    template <typename Fn>
+    std::size_t allocations_during(Fn&& fn)
+    {
+        std::size_t before = allocation_count();
+        fn();
+        return allocation_count() - before;
+    }
+
+} // namespace blaze::bench
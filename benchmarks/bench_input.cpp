@@ -0,0 +1,74 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <Blaze2D/App.h>
+#include <Blaze2D/input/EventRouter.h>
+
+#include <SDL3/SDL.h>
+
+#include "bench_common.h"
+
+#include <memory>
+#include <vector>
+
+/*
+    Routes synthetic mouse motion through a window holding a grid of panels
+    with buttons, as a stand-in for a tool window under high-rate input.
+    Uses the dummy video driver so it runs without a display.
+*/
+TEST_CASE("Event dispatch through a container tree", "[input][bench]")
+{
+    SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "dummy");
+
+    blaze::App app;
+    blaze::Window& window = app.createWindow("bench_input", 1280, 720);
+    blaze::EventRouter& router = app.getEventRouter();
+
+    std::vector<std::unique_ptr<blaze::Container>> containers;
+    for (int py = 0; py < 8; ++py) {
+        for (int px = 0; px < 8; ++px) {
+            blaze::Container* panel = containers.emplace_back(std::make_unique<blaze::Container>(
+                window, blaze::Rect(px * 160.0f, py * 90.0f, 160.0f, 90.0f))).get();
+            for (int b = 0; b < 4; ++b) {
+                containers.emplace_back(std::make_unique<blaze::Container>(
+                    *panel, blaze::Rect(8.0f + b * 38.0f, 8.0f, 32.0f, 24.0f)));
+            }
+        }
+    }
+
+    std::size_t handled = 0;
+    for (auto& container : containers) {
+        container->onEvent([&](blaze::Container&, const SDL_Event&, blaze::EventPhase) {
+            ++handled;
+            return blaze::EventResult::Ignored;
+        });
+    }
+
+    constexpr std::size_t count = 100'000;
+    std::vector<SDL_Event> events(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        SDL_Event& event = events[i];
+        event = SDL_Event{};
+        event.type = SDL_EVENT_MOUSE_MOTION;
+        event.motion.windowID = window.getId();
+        event.motion.x = float((i * 37) % 1280);
+        event.motion.y = float((i * 11) % 720);
+    }
+
+    auto dispatchAll = [&] {
+        for (const SDL_Event& event : events)
+            router.dispatch(event);
+    };
+
+    dispatchAll();
+    std::size_t allocs = blaze::bench::allocations_during(dispatchAll);
+    double seconds = blaze::bench::seconds_per_call(dispatchAll);
+    std::printf("input.dispatch events=%zu containers=%zu ns_per_event=%.1f allocs=%zu\n",
+        count, containers.size(), seconds * 1e9 / double(count), allocs);
+
+    CHECK(allocs == 0);
+    CHECK(handled > 0);
+
+    BENCHMARK("dispatch 100k mouse motion events") {
+        dispatchAll();
+    };
+}
@@ -0,0 +1,110 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <Blaze2D/App.h>
+#include <Blaze2D/ui/Container.h>
+
+#include <SDL3/SDL.h>
+
+#include "bench_common.h"
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+    struct Tree
+    {
+        std::vector<std::unique_ptr<blaze::Container>> nodes;
+        blaze::Container* leaf = nullptr; // Changed by the incremental case
+    };
+
+    // A single chain: every container is the only child of the previous one.
+    void build_deep(blaze::Window& window, Tree& tree, int depth)
+    {
+        blaze::Container* parent = &window.getRoot();
+        for (int i = 0; i < depth; ++i) {
+            auto* node = tree.nodes.emplace_back(std::make_unique<blaze::Container>(*parent)).get();
+            node->setPadding(0.1f);
+            parent = node;
+        }
+        tree.leaf = parent;
+    }
+
+    // One row holding 'width' columns of 'height' items, like a property grid.
+    void build_wide(blaze::Window& window, Tree& tree, int width, int height)
+    {
+        auto* row = tree.nodes.emplace_back(std::make_unique<blaze::Container>(window)).get();
+        row->setDirection(blaze::LayoutDirection::Row);
+        for (int x = 0; x < width; ++x) {
+            auto* column = tree.nodes.emplace_back(std::make_unique<blaze::Container>(*row)).get();
+            column->setGrow(1.0f);
+            column->setDirection(blaze::LayoutDirection::Column);
+            for (int y = 0; y < height; ++y) {
+                auto* item = tree.nodes.emplace_back(std::make_unique<blaze::Container>(*column)).get();
+                item->setSize({ 0.0f, 4.0f });
+                tree.leaf = item;
+            }
+        }
+    }
+
+    void report(const char* name, blaze::Window& window, Tree& tree)
+    {
+        blaze::Container& root = window.getRoot();
+        root.layout();
+
+        float width = 1280.0f;
+        auto fullRelayout = [&] {
+            width = width == 1280.0f ? 1281.0f : 1280.0f;
+            root.setRect(blaze::Rect(0.0f, 0.0f, width, 720.0f));
+            return root.layout();
+        };
+
+        float leafHeight = 4.0f;
+        auto incremental = [&] {
+            leafHeight = leafHeight == 4.0f ? 5.0f : 4.0f;
+            tree.leaf->setSize({ 0.0f, leafHeight });
+            return root.layout();
+        };
+
+        std::size_t fullCount = fullRelayout();
+        std::size_t incrementalCount = incremental();
+
+        double full = blaze::bench::seconds_per_call(fullRelayout);
+        double partial = blaze::bench::seconds_per_call(incremental);
+        double clean = blaze::bench::seconds_per_call([&] { return root.layout(); });
+
+        std::printf("layout.%s containers=%zu full_ms=%.4f full_rects=%zu incremental_ms=%.4f incremental_rects=%zu clean_ns=%.1f\n",
+            name, tree.nodes.size(), full * 1000.0, fullCount, partial * 1000.0, incrementalCount, clean * 1e9);
+
+        BENCHMARK(std::string("full relayout ") + name) {
+            return fullRelayout();
+        };
+
+        BENCHMARK(std::string("incremental relayout ") + name) {
+            return incremental();
+        };
+    }
+
+} // namespace
+
+TEST_CASE("Container relayout on deep and wide trees", "[Container][bench]")
+{
+    SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "dummy");
+
+    blaze::App app;
+    blaze::Window& window = app.createWindow("bench_layout", 1280, 720);
+
+    SECTION("deep") {
+        Tree tree;
+        build_deep(window, tree, 2'000);
+        report("deep", window, tree);
+    }
+
+    SECTION("wide") {
+        Tree tree;
+        build_wide(window, tree, 100, 100);
+        report("wide", window, tree);
+    }
+}
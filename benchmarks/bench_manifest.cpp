@@ -0,0 +1,225 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <Blaze2D/util/Manifest.h>
+
+#include "bench_common.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+    /*
+        Reference copy of the original std::getline / std::stringstream
+        manifest parser, kept as the baseline for the zero-copy parser.
+    */
+    namespace legacy {
+
+        struct AssetDescriptor {
+            std::string name;
+            std::string type;
+            std::filesystem::path path;
+            std::unordered_map<std::string, std::string> flags;
+        };
+
+        std::string trim(std::string s)
+        {
+            auto not_space = [](unsigned char c) { return !std::isspace(c); };
+            s.erase(s.begin(), std::find_if(s.begin(), s.end(), not_space));
+            s.erase(std::find_if(s.rbegin(), s.rend(), not_space).base(), s.end());
+            return s;
+        }
+
+        AssetDescriptor parse_manifest_line(const std::string& line)
+        {
+            std::stringstream ss(line);
+            std::string segment;
+            std::vector<std::string> parts;
+
+            while (std::getline(ss, segment, '|')) {
+                parts.push_back(trim(segment));
+            }
+
+            if (parts.size() < 3) {
+                throw std::runtime_error("Invalid manifest line");
+            }
+
+            AssetDescriptor desc;
+            desc.type = parts[0];
+            desc.name = parts[1];
+            desc.path = std::filesystem::path(parts[2]);
+
+            for (size_t i = 3; i < parts.size(); ++i) {
+                const std::string& flag = parts[i];
+                auto eq = flag.find('=');
+                if (eq == std::string::npos) {
+                    desc.flags.emplace(trim(flag), "true");
+                }
+                else {
+                    desc.flags.emplace(trim(flag.substr(0, eq)), trim(flag.substr(eq + 1)));
+                }
+            }
+            return desc;
+        }
+
+        std::size_t parse(const std::filesystem::path& path)
+        {
+            std::ifstream file(path);
+            std::vector<AssetDescriptor> assets;
+            std::unordered_map<std::string, size_t> index;
+            std::string line;
+
+            while (std::getline(file, line)) {
+                if (std::all_of(line.begin(), line.end(), [](unsigned char c) { return std::isspace(c); }))
+                    continue;
+                if (line.starts_with('#') || line.starts_with('-'))
+                    continue;
+
+                AssetDescriptor desc = parse_manifest_line(line);
+                index.emplace(desc.name, assets.size());
+                assets.push_back(std::move(desc));
+            }
+            return assets.size();
+        }
+
+    } // namespace legacy
+
+    // Writes a manifest resembling shipping content: mixed types, a few flags, comments and separators.
+    std::filesystem::path write_manifest(std::size_t lines)
+    {
+        static const char* types[] = { "sprite", "audio", "font", "shader", "data" };
+
+        auto path = blaze::bench::temp_path("blaze_bench_manifest", ".manifest");
+        std::ofstream ofs(path, std::ios::binary);
+        ofs << "# Generated benchmark manifest\n";
+
+        for (std::size_t i = 0; i < lines; ++i) {
+            if (i % 100 == 0)
+                ofs << "-----\n";
+
+            const char* type = types[i % 5];
+            ofs << type << " | asset_" << i << " | assets/" << type << "/asset_" << i << ".bin";
+            if (i % 2 == 0) ofs << " | PRELOAD";
+            if (i % 3 == 0) ofs << " | FILTER = linear";
+            if (i % 7 == 0) ofs << " | SCALE = 2 | GROUP = level_" << (i % 13);
+            ofs << '\n';
+        }
+        return path;
+    }
+
+    void report(const char* parser, std::size_t lines, double secondsPerParse, std::size_t allocations)
+    {
+        std::printf("manifest.parse %-8s lines=%-7zu lines/sec=%-14.0f allocs/line=%.3f\n",
+            parser, lines,
+            static_cast<double>(lines) / secondsPerParse,
+            static_cast<double>(allocations) / static_cast<double>(lines));
+    }
+
+} // namespace
+
+TEST_CASE("Manifest parse throughput", "[manifest][bench]")
+{
+    for (std::size_t lines : { std::size_t(1'000), std::size_t(10'000), std::size_t(50'000) }) {
+        auto path = write_manifest(lines);
+
+        // Both parsers must agree before their numbers mean anything.
+        REQUIRE(legacy::parse(path) == blaze::Manifest(path).getAll().size());
+
+        auto compiledPath = path;
+        compiledPath.replace_extension(".blzm");
+        blaze::Manifest(path).writeCompiled(compiledPath);
+
+        std::size_t legacyAllocs = blaze::bench::allocations_during([&] { legacy::parse(path); });
+        std::size_t mappedAllocs = blaze::bench::allocations_during([&] { blaze::Manifest m(path); });
+        std::size_t compiledAllocs = blaze::bench::allocations_during([&] { blaze::Manifest m(compiledPath); });
+
+        report("legacy", lines, blaze::bench::seconds_per_call([&] { legacy::parse(path); }), legacyAllocs);
+        report("mapped", lines, blaze::bench::seconds_per_call([&] { blaze::Manifest m(path); }), mappedAllocs);
+        report("compiled", lines, blaze::bench::seconds_per_call([&] { blaze::Manifest m(compiledPath); }), compiledAllocs);
+
+        std::string suffix = std::to_string(lines) + " lines";
+
+        BENCHMARK("legacy parser, " + suffix) {
+            return legacy::parse(path);
+        };
+
+        BENCHMARK("mapped parser, " + suffix) {
+            return blaze::Manifest(path).getAll().size();
+        };
+
+        BENCHMARK("compiled load, " + suffix) {
+            return blaze::Manifest(compiledPath).getAll().size();
+        };
+
+        std::filesystem::remove(path);
+        std::filesystem::remove(compiledPath);
+    }
+}
+
+TEST_CASE("Manifest lookup", "[manifest][bench]")
+{
+    constexpr std::size_t lines = 10'000;
+    auto path = write_manifest(lines);
+
+    blaze::Manifest manifest(path);
+
+    // Names as hot code holds them: C strings with static storage.
+    std::vector<std::string> storage;
+    std::vector<const char*> names;
+    for (std::size_t i = 0; i < lines; i += 7)
+        storage.push_back("asset_" + std::to_string(i));
+    for (const auto& name : storage)
+        names.push_back(name.c_str());
+
+    std::vector<blaze::AssetId> ids;
+    for (const char* name : names)
+        ids.push_back(manifest.find(name));
+
+    // The previous index: std::string keys, so every lookup builds a temporary.
+    std::unordered_map<std::string, std::size_t> legacyIndex;
+    for (const auto& asset : manifest.getAll())
+        legacyIndex.emplace(std::string(asset.name), asset.id.value);
+
+    std::size_t lookupAllocs = blaze::bench::allocations_during([&] {
+        for (const char* name : names) manifest.get(name);
+        for (blaze::AssetId id : ids) manifest.get(id);
+    });
+    REQUIRE(lookupAllocs == 0);
+
+    BENCHMARK("unordered_map<std::string> from const char*") {
+        std::size_t sum = 0;
+        for (const char* name : names)
+            sum += legacyIndex.find(name)->second;
+        return sum;
+    };
+
+    BENCHMARK("Manifest::get(string_view)") {
+        std::size_t sum = 0;
+        for (const char* name : names)
+            sum += manifest.get(name).path.size();
+        return sum;
+    };
+
+    BENCHMARK("Manifest::get(AssetId)") {
+        std::size_t sum = 0;
+        for (blaze::AssetId id : ids)
+            sum += manifest.get(id).path.size();
+        return sum;
+    };
+
+    // Type names as callers pass them; the views are precomputed, so this is one hash per call.
+    const char* types[] = { "sprite", "audio", "font", "shader", "data", "missing" };
+    BENCHMARK("Manifest::getByType x6") {
+        std::size_t sum = 0;
+        for (const char* type : types)
+            sum += manifest.getByType(type).size();
+        return sum;
+    };
+
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,62 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <Blaze2D/graphics/RectPacker.h>
+
+#include "bench_common.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+    // Sprite-like sizes: mostly small, some wide/tall strips.
+    std::vector<blaze::PackSize> random_sizes(std::size_t count)
+    {
+        std::mt19937 rng(1234);
+        std::uniform_int_distribution<int> small(8, 64);
+        std::uniform_int_distribution<int> large(64, 256);
+        std::uniform_int_distribution<int> pick(0, 9);
+
+        std::vector<blaze::PackSize> sizes(count);
+        for (auto& size : sizes) {
+            size.w = pick(rng) == 0 ? large(rng) : small(rng);
+            size.h = pick(rng) == 0 ? large(rng) : small(rng);
+        }
+        return sizes;
+    }
+
+} // namespace
+
+TEST_CASE("Rect packer time and occupancy", "[packer][bench]")
+{
+    constexpr int page = 2048;
+
+    for (std::size_t count : { std::size_t(1'000), std::size_t(5'000), std::size_t(10'000), std::size_t(50'000) }) {
+        auto sizes = random_sizes(count);
+        std::vector<blaze::PackedRect> out(count);
+
+        uint32_t pages = blaze::pack_rects(sizes, page, page, out);
+
+        double area = 0.0;
+        for (const auto& size : sizes)
+            area += double(size.w) * size.h;
+
+        // Occupancy over all pages, and over every page but the last (which is partially filled by nature).
+        double lastPageArea = 0.0;
+        for (std::size_t i = 0; i < count; ++i) {
+            if (out[i].page == pages - 1)
+                lastPageArea += double(sizes[i].w) * sizes[i].h;
+        }
+        double pageArea = double(page) * page;
+        double full = pages > 1 ? (area - lastPageArea) / ((pages - 1) * pageArea) : area / pageArea;
+
+        double seconds = blaze::bench::seconds_per_call([&] { blaze::pack_rects(sizes, page, page, out); });
+        std::printf("packer.skyline rects=%-6zu pages=%-3u occupancy=%.3f full_page_occupancy=%.3f ms=%.3f\n",
+            count, pages, area / (pages * pageArea), full, seconds * 1000.0);
+
+        BENCHMARK("skyline pack " + std::to_string(count) + " rects") {
+            return blaze::pack_rects(sizes, page, page, out);
+        };
+    }
+}
@@ -0,0 +1,62 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <Blaze2D/util/RectBatch.h>
+
+#include "bench_common.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+    // Sprite bounds scattered over a world four screens wide.
+    std::vector<blaze::Rect> random_rects(std::size_t count)
+    {
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<float> x(0.0f, 5120.0f);
+        std::uniform_real_distribution<float> y(0.0f, 2880.0f);
+        std::uniform_real_distribution<float> size(8.0f, 128.0f);
+
+        std::vector<blaze::Rect> rects(count);
+        for (auto& rect : rects)
+            rect = blaze::Rect(x(rng), y(rng), size(rng), size(rng));
+        return rects;
+    }
+
+} // namespace
+
+TEST_CASE("Batched rect culling and hit testing per SIMD path", "[RectBatch][bench]")
+{
+    constexpr std::size_t count = 10'000;
+    const std::vector<blaze::Rect> rects = random_rects(count);
+    std::vector<blaze::Rect> scratch = rects;
+    std::vector<uint8_t> mask(count);
+
+    const blaze::Rect camera(1280.0f, 720.0f, 1280.0f, 720.0f);
+    const blaze::Vec2 cursor(1900.0f, 1000.0f);
+    const blaze::SimdLevel original = blaze::batch::level();
+
+    for (blaze::SimdLevel requested : { blaze::SimdLevel::Scalar, blaze::SimdLevel::SSE2, blaze::SimdLevel::AVX2, blaze::SimdLevel::NEON }) {
+        const blaze::SimdLevel level = blaze::batch::forceLevel(requested);
+        if (level != requested)
+            continue;
+        const std::string name = blaze::batch::levelName(level);
+
+        double cull = blaze::bench::seconds_per_call([&] { return blaze::batch::intersects(rects, camera, mask); });
+        double hit = blaze::bench::seconds_per_call([&] { return blaze::batch::contains(rects, cursor, mask); });
+        double clip = blaze::bench::seconds_per_call([&] { blaze::batch::intersection(rects, camera, scratch); });
+        std::printf("rect_batch.%s rects=%zu intersects_ns=%.3f contains_ns=%.3f intersection_ns=%.3f (per rect)\n",
+            name.c_str(), count, cull * 1e9 / count, hit * 1e9 / count, clip * 1e9 / count);
+
+        BENCHMARK("intersects 10k rects " + name) {
+            return blaze::batch::intersects(rects, camera, mask);
+        };
+
+        BENCHMARK("contains point 10k rects " + name) {
+            return blaze::batch::contains(rects, cursor, mask);
+        };
+    }
+
+    blaze::batch::forceLevel(original);
+}
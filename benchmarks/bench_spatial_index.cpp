@@ -0,0 +1,119 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <Blaze2D/util/RectBatch.h>
+#include <Blaze2D/util/SpatialIndex.h>
+
+#include "bench_common.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+    // Sprite bounds over a world of 100 x 100 screens-ish; small objects, a few large ones.
+    std::vector<blaze::Rect> random_scene(std::size_t count, float world)
+    {
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<float> pos(0.0f, world);
+        std::uniform_real_distribution<float> size(8.0f, 64.0f);
+        std::uniform_int_distribution<int> pick(0, 199);
+
+        std::vector<blaze::Rect> rects(count);
+        for (auto& rect : rects) {
+            const float scale = pick(rng) == 0 ? 16.0f : 1.0f;
+            rect = blaze::Rect(pos(rng), pos(rng), size(rng) * scale, size(rng) * scale);
+        }
+        return rects;
+    }
+
+} // namespace
+
+TEST_CASE("Spatial index culling against brute force", "[SpatialIndex][bench]")
+{
+    constexpr std::size_t count = 100'000;
+    constexpr float world = 40'000.0f;
+    const std::vector<blaze::Rect> rects = random_scene(count, world);
+
+    blaze::AabbTree tree(4.0f);
+    blaze::SpatialGrid grid(64.0f);
+    std::vector<uint32_t> treeProxies, gridProxies;
+    for (uint32_t i = 0; i < count; ++i) {
+        treeProxies.push_back(tree.insert(rects[i], i));
+        gridProxies.push_back(grid.insert(rects[i], i));
+    }
+
+    // Cameras swept across the world.
+    std::vector<blaze::Rect> cameras;
+    for (int i = 0; i < 64; ++i)
+        cameras.emplace_back(float(i) * 600.0f, float(i) * 550.0f, 1920.0f, 1080.0f);
+
+    std::vector<uint32_t> out;
+    std::vector<uint8_t> mask(count);
+    std::size_t camera = 0;
+
+    auto bruteQuery = [&] {
+        const blaze::Rect& area = cameras[camera++ % cameras.size()];
+        out.clear();
+        for (uint32_t i = 0; i < count; ++i) {
+            if (rects[i].intersects(area))
+                out.push_back(i);
+        }
+        return out.size();
+    };
+    auto batchQuery = [&] {
+        return blaze::batch::intersects(rects, cameras[camera++ % cameras.size()], mask);
+    };
+    auto treeQuery = [&] {
+        out.clear();
+        return tree.query(cameras[camera++ % cameras.size()], out);
+    };
+    auto gridQuery = [&] {
+        out.clear();
+        return grid.query(cameras[camera++ % cameras.size()], out);
+    };
+
+    // Every object nudged each frame, as in a scene full of moving sprites.
+    std::vector<blaze::Rect> moving = rects;
+    float phase = 1.0f;
+    auto treeMove = [&] {
+        phase = -phase;
+        const blaze::Vec2 delta(phase, 0.5f * phase);
+        for (uint32_t i = 0; i < count; ++i) {
+            moving[i] = moving[i].translated(delta);
+            tree.move(treeProxies[i], moving[i], delta);
+        }
+    };
+    auto gridMove = [&] {
+        phase = -phase;
+        const blaze::Vec2 delta(phase, 0.5f * phase);
+        for (uint32_t i = 0; i < count; ++i) {
+            moving[i] = moving[i].translated(delta);
+            grid.move(gridProxies[i], moving[i]);
+        }
+    };
+
+    std::vector<blaze::SpatialPair> pairs;
+    auto treePairs = [&] { pairs.clear(); return tree.queryPairs(pairs); };
+    auto gridPairs = [&] { pairs.clear(); return grid.queryPairs(pairs); };
+
+    const double brute = blaze::bench::seconds_per_call(bruteQuery);
+    const double batch = blaze::bench::seconds_per_call(batchQuery);
+    const double treeQ = blaze::bench::seconds_per_call(treeQuery);
+    const double gridQ = blaze::bench::seconds_per_call(gridQuery);
+    std::printf("spatial.query objects=%zu brute_us=%.1f batch_%s_us=%.1f tree_us=%.2f grid_us=%.2f tree_height=%d visible=%zu\n",
+        count, brute * 1e6, blaze::batch::levelName(blaze::batch::level()), batch * 1e6, treeQ * 1e6, gridQ * 1e6,
+        tree.height(), treeQuery());
+
+    const double treeU = blaze::bench::seconds_per_call(treeMove);
+    const double gridU = blaze::bench::seconds_per_call(gridMove);
+    const double treeP = blaze::bench::seconds_per_call(treePairs);
+    const double gridP = blaze::bench::seconds_per_call(gridPairs);
+    std::printf("spatial.update objects=%zu tree_move_ms=%.2f grid_move_ms=%.2f tree_pairs_ms=%.2f grid_pairs_ms=%.2f pairs=%zu\n",
+        count, treeU * 1e3, gridU * 1e3, treeP * 1e3, gridP * 1e3, gridPairs());
+
+    BENCHMARK("cull 100k brute force") { return bruteQuery(); };
+    BENCHMARK("cull 100k batch::intersects") { return batchQuery(); };
+    BENCHMARK("cull 100k AabbTree") { return treeQuery(); };
+    BENCHMARK("cull 100k SpatialGrid") { return gridQuery(); };
+}
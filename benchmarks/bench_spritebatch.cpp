@@ -0,0 +1,103 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <Blaze2D/graphics/SpriteBatch.h>
+
+#include <SDL3/SDL.h>
+
+#include "bench_common.h"
+
+#include <array>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+
+    struct BenchSprite
+    {
+        std::size_t texture;
+        blaze::Rect src;
+        blaze::Rect dst;
+    };
+
+} // namespace
+
+/*
+    Uses SDL's software renderer on an offscreen surface, so it runs without a
+    display or GPU. The software rasterizer dominates at large sprite sizes;
+    sprites are kept small so that per-call overhead is what gets measured.
+*/
+TEST_CASE("SpriteBatch against per-sprite SDL_RenderTexture", "[SpriteBatch][bench]")
+{
+    constexpr std::size_t count = 20'000;
+    constexpr int width = 1280;
+    constexpr int height = 720;
+
+    SDL_Surface* target = SDL_CreateSurface(width, height, SDL_PIXELFORMAT_RGBA32);
+    SDL_Renderer* renderer = SDL_CreateSoftwareRenderer(target);
+    REQUIRE(renderer != nullptr);
+
+    std::array<SDL_Texture*, 4> textures{};
+    for (SDL_Texture*& texture : textures) {
+        SDL_Surface* image = SDL_CreateSurface(64, 64, SDL_PIXELFORMAT_RGBA32);
+        SDL_FillSurfaceRect(image, nullptr, SDL_MapSurfaceRGBA(image, 200, 120, 40, 255));
+        texture = SDL_CreateTextureFromSurface(renderer, image);
+        SDL_DestroySurface(image);
+        REQUIRE(texture != nullptr);
+    }
+
+    std::mt19937 rng(99);
+    std::uniform_int_distribution<std::size_t> pickTexture(0, textures.size() - 1);
+    std::uniform_real_distribution<float> px(0.0f, width - 4.0f);
+    std::uniform_real_distribution<float> py(0.0f, height - 4.0f);
+    std::uniform_real_distribution<float> cell(0.0f, 60.0f);
+
+    std::vector<BenchSprite> scene(count);
+    for (BenchSprite& sprite : scene) {
+        sprite.texture = pickTexture(rng);
+        sprite.src = blaze::Rect(cell(rng), cell(rng), 4.0f, 4.0f);
+        sprite.dst = blaze::Rect(px(rng), py(rng), 4.0f, 4.0f);
+    }
+
+    auto renderDirect = [&] {
+        for (const BenchSprite& sprite : scene) {
+            const SDL_FRect src{ sprite.src.x, sprite.src.y, sprite.src.w, sprite.src.h };
+            const SDL_FRect dst{ sprite.dst.x, sprite.dst.y, sprite.dst.w, sprite.dst.h };
+            SDL_RenderTexture(renderer, textures[sprite.texture], &src, &dst);
+        }
+        SDL_FlushRenderer(renderer);
+    };
+
+    blaze::SpriteBatch batch(count);
+    auto renderBatched = [&] {
+        batch.begin();
+        for (const BenchSprite& sprite : scene)
+            batch.draw(textures[sprite.texture], sprite.src, sprite.dst);
+        batch.end(renderer);
+        SDL_FlushRenderer(renderer);
+    };
+
+    renderBatched();
+    std::size_t drawCalls = batch.getDrawCallCount();
+    std::size_t steadyAllocs = blaze::bench::allocations_during(renderBatched);
+
+    double direct = blaze::bench::seconds_per_call(renderDirect);
+    double batched = blaze::bench::seconds_per_call(renderBatched);
+    std::printf("spritebatch.software sprites=%zu direct_ms=%.3f batched_ms=%.3f draw_calls=%zu steady_allocs=%zu\n",
+        count, direct * 1000.0, batched * 1000.0, drawCalls, steadyAllocs);
+
+    CHECK(drawCalls == textures.size());
+
+    BENCHMARK("SDL_RenderTexture x20000") {
+        renderDirect();
+    };
+
+    BENCHMARK("SpriteBatch x20000") {
+        renderBatched();
+    };
+
+    for (SDL_Texture* texture : textures)
+        SDL_DestroyTexture(texture);
+    SDL_DestroyRenderer(renderer);
+    SDL_DestroySurface(target);
+}
@@ -0,0 +1,106 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <Blaze2D/graphics/Font.h>
+#include <Blaze2D/graphics/GlyphCache.h>
+#include <Blaze2D/graphics/SpriteBatch.h>
+#include <Blaze2D/graphics/TextRenderer.h>
+
+#include <SDL3/SDL.h>
+
+#include "bench_common.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace {
+
+    // Printable ASCII in 8x12 cells, 16 per row of a 128x128 page.
+    blaze::Font make_ascii_font()
+    {
+        std::string fnt = "common lineHeight=14 base=11 scaleW=128 scaleH=128 pages=1\n";
+        for (int c = 32; c < 127; ++c) {
+            const int cell = c - 32;
+            fnt += "char id=" + std::to_string(c)
+                + " x=" + std::to_string((cell % 16) * 8) + " y=" + std::to_string((cell / 16) * 12)
+                + " width=" + std::string(c == 32 ? "0" : "7") + " height=" + std::string(c == 32 ? "0" : "11")
+                + " xoffset=0 yoffset=1 xadvance=8 page=0\n";
+        }
+        return blaze::Font(fnt, { SDL_CreateSurface(128, 128, SDL_PIXELFORMAT_RGBA32) });
+    }
+
+} // namespace
+
+/*
+    A dashboard of short labels, drawn every frame. With the layout cache
+    each label costs a lookup plus its quads; without it every label is
+    decoded and laid out again.
+*/
+TEST_CASE("Text labels with and without the layout cache", "[Text][bench]")
+{
+    constexpr std::size_t labels = 2'000;
+
+    SDL_Surface* target = SDL_CreateSurface(1280, 720, SDL_PIXELFORMAT_RGBA32);
+    SDL_Renderer* renderer = SDL_CreateSoftwareRenderer(target);
+    REQUIRE(renderer != nullptr);
+
+    {
+        blaze::Font font = make_ascii_font();
+        blaze::GlyphCache cache(renderer);
+        blaze::TextRenderer text(cache, labels);
+        blaze::SpriteBatch batch(labels * 16);
+
+        std::vector<std::string> strings(labels);
+        for (std::size_t i = 0; i < labels; ++i)
+            strings[i] = "cpu" + std::to_string(i % 64) + " load " + std::to_string((i * 37) % 100) + "%";
+
+        auto drawCached = [&] {
+            cache.beginFrame();
+            batch.begin();
+            for (std::size_t i = 0; i < labels; ++i)
+                text.draw(batch, font, strings[i], blaze::Vec2(float(i % 8) * 160.0f, float(i / 8 % 48) * 15.0f));
+            batch.end(renderer);
+        };
+
+        blaze::TextLayout layout;
+        std::vector<blaze::CachedGlyph> glyphs;
+        auto drawUncached = [&] {
+            cache.beginFrame();
+            batch.begin();
+            for (std::size_t i = 0; i < labels; ++i) {
+                blaze::layout_text(font, strings[i], {}, layout);
+                const blaze::Vec2 position(float(i % 8) * 160.0f, float(i / 8 % 48) * 15.0f);
+                for (const blaze::GlyphQuad& quad : layout.quads) {
+                    const blaze::CachedGlyph glyph = cache.get(font, quad.glyph);
+                    batch.drawUV(glyph.texture, glyph.uv, blaze::Rect(quad.dst.x + position.x, quad.dst.y + position.y, quad.dst.w, quad.dst.h));
+                }
+            }
+            batch.end(renderer);
+        };
+
+        drawCached();
+        drawUncached();
+        const std::size_t steadyAllocs = blaze::bench::allocations_during(drawCached);
+        const std::size_t drawCalls = batch.getDrawCallCount();
+
+        const double cached = blaze::bench::seconds_per_call(drawCached);
+        const double uncached = blaze::bench::seconds_per_call(drawUncached);
+        std::printf("text.labels labels=%zu glyphs=%zu cached_ms=%.3f uncached_ms=%.3f draw_calls=%zu glyph_uploads=%llu steady_allocs=%zu\n",
+            labels, batch.getSpriteCount(), cached * 1000.0, uncached * 1000.0, drawCalls,
+            static_cast<unsigned long long>(cache.getStats().misses), steadyAllocs);
+
+        CHECK(steadyAllocs == 0);
+        CHECK(drawCalls == 1);
+
+        BENCHMARK("TextRenderer x2000 labels") {
+            drawCached();
+        };
+
+        BENCHMARK("layout_text x2000 labels") {
+            drawUncached();
+        };
+    }
+
+    SDL_DestroyRenderer(renderer);
+    SDL_DestroySurface(target);
+}
@@ -0,0 +1,125 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <Blaze2D/App.h>
+
+#include <SDL3/SDL.h>
+
+#include "bench_common.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/*
+    Windows are created on SDL's offscreen video driver, which renders with
+    the software renderer into memory, so this runs without a display and
+    measures Blaze2D's own per-window and per-frame overhead rather than a
+    GPU driver. Headless windows skip the video driver altogether.
+*/
+TEST_CASE("Window create/destroy and empty frames", "[Window][bench]")
+{
+    SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "offscreen");
+    blaze::App app;
+
+    // Warm up SDL's video subsystem so the first sample does not include it.
+    app.removeWindow(app.createWindow("warmup", 640, 360));
+
+    double createDestroy = blaze::bench::seconds_per_call([&] {
+        app.removeWindow(app.createWindow("bench", 640, 360));
+    });
+    std::printf("window.create_destroy size=640x360 ms=%.3f\n", createDestroy * 1000.0);
+
+    BENCHMARK("create + destroy 640x360 window") {
+        app.removeWindow(app.createWindow("bench", 640, 360));
+    };
+
+    blaze::Window& window = app.createWindow("frames", 640, 360);
+
+    BENCHMARK("render + present, no dirty tracking") {
+        app.render(0.0);
+        return app.present();
+    };
+
+    window.setDirtyTracking(true);
+    app.render(0.0);
+    app.present();
+
+    std::size_t idleAllocs = blaze::bench::allocations_during([&] {
+        app.render(0.0);
+        app.present();
+    });
+    std::printf("window.idle_frame steady_allocs=%zu\n", idleAllocs);
+
+    BENCHMARK("render + present, dirty tracking with nothing dirty") {
+        app.render(0.0);
+        return app.present();
+    };
+
+    app.removeWindow(window);
+
+    // Display-less path: software rendering into the window's own framebuffer.
+    blaze::Window& headless = app.createWindow("headless", 640, 360, "", blaze::WindowMode::Headless);
+    headless.setClearColor(blaze::Color(0.2f, 0.3f, 0.4f, 1.f));
+
+    BENCHMARK("headless 640x360 clear + present + readback") {
+        app.render(0.0);
+        app.present();
+        return headless.readPixel(320, 180).r;
+    };
+
+    // Same frame recorded into a command buffer and replayed.
+    std::vector<blaze::Rect> tiles;
+    for (int y = 0; y < 360; y += 20)
+        for (int x = 0; x < 640; x += 20)
+            tiles.emplace_back(float(x), float(y), 18.f, 18.f);
+
+    headless.onRecord([&](blaze::Window&, blaze::CommandBuffer& commands, double) {
+        commands.fillRects(tiles, blaze::Color(0.9f, 0.5f, 0.1f, 1.f));
+    });
+    // Once into each of the two buffers.
+    for (int i = 0; i < 2; ++i) {
+        app.render(0.0);
+        app.present();
+    }
+
+    std::size_t recordAllocs = blaze::bench::allocations_during([&] {
+        headless.record(0.0);
+        headless.swapCommands();
+    });
+    std::printf("window.record tiles=%zu steady_allocs=%zu\n", tiles.size(), recordAllocs);
+
+    BENCHMARK("record 576 tiles into a command buffer") {
+        headless.record(0.0);
+        headless.swapCommands();
+    };
+
+    BENCHMARK("replay 576 tiles + present, headless") {
+        return headless.replay();
+    };
+
+    app.removeWindow(headless);
+}
+
+TEST_CASE("Window lookups and popup churn", "[Window][SlotMap][bench]")
+{
+    blaze::App app;
+    std::vector<blaze::WindowHandle> handles;
+    for (int i = 0; i < 64; ++i)
+        handles.push_back(app.createWindow("popup" + std::to_string(i), 8, 8, "", blaze::WindowMode::Headless).getHandle());
+
+    const std::string last = "popup63";
+    BENCHMARK("getWindow by name, 64 windows") {
+        return &app.getWindow(last);
+    };
+
+    BENCHMARK("getWindow by handle, 64 windows") {
+        return app.getWindow(handles.back());
+    };
+
+    // Transient popups: the removed slot is reused and the stale handle rejected.
+    BENCHMARK("create + remove headless popup") {
+        blaze::WindowHandle popup = app.createWindow("transient", 8, 8, "", blaze::WindowMode::Headless).getHandle();
+        app.removeWindow(popup);
+        return app.getWindow(popup);
+    };
+}
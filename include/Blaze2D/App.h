@@ -1,12 +1,63 @@
 #pragma once
 #include <vector>
+#include <condition_variable>
 #include <cstdint>
+#include <exception>
 #include <memory>
+#include <mutex>
+#include <span>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include "Blaze2D/window/Window.h"
+#include "Blaze2D/input/EventRouter.h"
+#include "Blaze2D/util/FixedTimestep.h"
+
+union SDL_Event;
 
 namespace blaze {
 
+	struct FrameLoopOptions
+	{
+		double update_hz = 60.0;       // Fixed simulation rate
+		int max_updates_per_frame = 5; // Further catch-up updates are dropped
+		double max_fps = 0.0;          // Frame cap; 0 leaves pacing to vsync
+		double spin_ms = 1.0;          // Final part of the frame wait that is spun instead of slept
+
+		/*
+			Runs the fixed updates and the record callbacks of a frame on a
+			worker thread while the main thread replays and presents the
+			previous frame (see Window::onRecord). SDL calls stay on the main
+			thread. Update callbacks then run on the worker: they must not
+			call SDL or create windows.
+		*/
+		bool pipelined = false;
+	};
+
+	/**
+	* @brief Timing of the last frame run by App::run() or App::frame().
+	* Durations are in milliseconds; counters are totals since run() started.
+	*/
+	struct FrameStats
+	{
+		double frame_ms = 0.0;   // Whole frame, including the frame-cap wait
+		double input_ms = 0.0;
+		double update_ms = 0.0;  // All fixed updates of the frame together
+		double render_ms = 0.0;  // Pipelined: recording on the worker; replay counts as present
+		double present_ms = 0.0;
+		double wait_ms = 0.0;
+		double alpha = 0.0;      // Interpolation factor passed to render()
+		int updates = 0;
+
+		// Peak FrameArena use of the frame on the main thread plus, when pipelined, the worker.
+		std::size_t arena_peak_bytes = 0;
+
+		uint64_t frame_index = 0;
+		uint64_t dropped_frames = 0;  // Frames whose work overran the frame budget
+		uint64_t dropped_updates = 0; // Fixed updates skipped to catch up after a stall
+		uint64_t idle_frames = 0;     // Frames in which no window needed presenting
+	};
+
 	class App {
 	public:
 		/**
@@ -16,13 +67,121 @@ namespace blaze {
 		App();
 		~App();
 
-		Window& createWindow(const std::string name, const int width = 100, const int height = 100, const std::string title = "");
+		/**
+		* @brief Creates a window owned by the app. Keep window.getHandle() rather
+		* than the reference when the window may be removed while you hold it.
+		* Headless windows (see WindowMode) are updated and rendered like the others but get no input.
+		*/
+		Window& createWindow(const std::string name, const int width = 100, const int height = 100, const std::string title = "", WindowMode mode = WindowMode::Native);
+
+		/**
+		* @brief Window with the given name, found in O(1). If several share the
+		* name, the first created resolves until it is removed, then another one.
+		* @throws std::runtime_error if there is none
+		*/
 		Window& getWindow(const std::string& name);
 
+		// Window 'handle' refers to, or nullptr once it was removed.
+		Window* getWindow(WindowHandle handle);
+
+		// Handle of the window with the given name, or a null handle.
+		WindowHandle findWindow(const std::string& name) const;
+
+		/**
+		* @brief Removes a window. A window removed from a callback while the
+		* app goes through its windows (update(), render(), present(), run())
+		* is skipped and no longer found from then on, and is destroyed once
+		* the frame is over, so the reference passed to the callback stays
+		* valid until it returns.
+		*/
 		void removeWindow(Window& window);
 
+		// Returns false if the handle was already stale.
+		bool removeWindow(WindowHandle handle);
+
+		std::size_t getWindowCount() const { return windows.size() - removed_windows.size(); }
+
+		/**
+		* @brief Polls pending SDL events, propagates them through the window and
+		* container hierarchy and returns the ones no container consumed.
+		* The span stays valid until the next call. A quit event stops run().
+		*/
+		std::span<const SDL_Event> get_input();
+
+		// Calls update() of all windows.
+		void update(double dt);
+
+		// Calls render() of all windows.
+		void render(double alpha);
+
+		// Presents all windows. Returns how many were presented (see Window::setDirtyTracking()).
+		std::size_t present();
+
+		/**
+		* @brief Runs the frame loop until stop() is called, a quit event
+		* arrives or the last window is removed.
+		*
+		* Every frame polls input, runs as many fixed updates as real time
+		* requires, renders with the interpolation factor and presents. With
+		* max_fps set, the rest of the frame is slept and then spun on the
+		* performance counter for an accurate frame period. Frames in which no
+		* window presented (all use dirty tracking and nothing changed) wait
+		* for the next event or fixed update instead, so an idle app sleeps.
+		*/
+		void run(const FrameLoopOptions& options = {});
+
+		// Runs a single frame of run(). Returns false once the loop should stop.
+		bool frame();
+
+		void stop() { running = false; }
+		bool isRunning() const { return running; }
+
+		const FrameStats& getFrameStats() const { return stats; }
+
+		EventRouter& getEventRouter() { return router; }
+
 	private:
-		std::vector<std::unique_ptr<Window>> windows;
+		void waitUntil(uint64_t deadline) const;
+
+		// Held while windows are iterated; the last one out erases the windows removed meanwhile.
+		struct WindowLoop;
+		void eraseRemovedWindows();
+
+		// Pipelined frames: the worker runs 'updates' fixed updates and records every window.
+		void startWorkerFrame(int updates, double alpha);
+		void finishWorkerFrame();
+		void stopWorker();
+		void workerLoop();
+
+		// Contiguous, in no particular order; removal moves the last window into the gap.
+		SlotMap<std::unique_ptr<Window>, Window> windows;
+		std::unordered_map<std::string, WindowHandle> windows_by_name;
+		std::vector<WindowHandle> removed_windows; // Awaiting erasure at the end of the frame
+		int window_loops = 0;
+
+		EventRouter router;
+
+		FrameLoopOptions options;
+		FixedTimestep timestep;
+		FrameStats stats;
+		bool running = true;
+
+		uint64_t frequency = 0;
+		uint64_t lastFrame = 0;
+
+		std::thread worker;
+		std::mutex worker_mutex;
+		std::condition_variable worker_wake;
+		std::condition_variable worker_done;
+		bool worker_busy = false;
+		bool worker_stopping = false;
+		int worker_updates = 0;
+		double worker_alpha = 0.0;
+		uint64_t worker_update_ticks = 0;
+		uint64_t worker_record_ticks = 0;
+		std::size_t worker_arena_peak = 0;
+		std::exception_ptr worker_error; // Rethrown on the main thread by finishWorkerFrame()
 	};
 
 } // namespace blaze
+
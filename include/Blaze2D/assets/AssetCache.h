@@ -0,0 +1,115 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "Blaze2D/assets/AssetLoader.h"
+
+namespace blaze
+{
+	struct AssetCacheStats
+	{
+		uint64_t hits = 0;           // get() calls answered by a cached entry
+		uint64_t misses = 0;         // get() calls that started a load
+		uint64_t evictions = 0;
+		std::size_t bytes_resident = 0; // Estimated memory of the cached, ready assets
+		std::size_t entries = 0;     // Cached assets, loading or ready
+	};
+
+	/**
+	* @brief Keeps loaded assets alive between uses, within a memory budget.
+	*
+	* The cache holds one AssetHandle per requested asset, so an asset stays
+	* loaded after callers drop their handles and the next get() is a hit.
+	* Memory is estimated with AssetHandle::getMemorySize() once an asset is
+	* ready. When the total exceeds the budget, entries that nobody else holds
+	* a handle to are evicted, least recently requested first; entries still
+	* in use are never evicted, so the budget can be exceeded while they are.
+	*
+	* Entries follow their assets across AssetLoader::setManifest() (assets
+	* removed from the manifest are dropped) and are accounted again after
+	* reloads.
+	*
+	* Main thread only. Call update() once per frame after AssetLoader::update().
+	*/
+	class AssetCache
+	{
+	public:
+		static constexpr std::size_t unlimited = SIZE_MAX;
+
+		explicit AssetCache(AssetLoader& loader, std::size_t budgetBytes = unlimited);
+
+		AssetCache(const AssetCache&) = delete;
+		AssetCache& operator=(const AssetCache&) = delete;
+
+		/**
+		* @brief Returns the cached asset, or starts loading it.
+		* @throws std::out_of_range if the asset is not in the manifest
+		*/
+		AssetHandle get(AssetId id);
+		AssetHandle get(std::string_view name);
+
+		// True if the asset is cached (loading or ready). Does not count as a use.
+		bool contains(AssetId id) const;
+
+		/**
+		* @brief Accounts for assets that became ready since the last call and
+		* evicts down to the budget.
+		* @return the number of entries evicted
+		*/
+		std::size_t update();
+
+		// Evicts unreferenced entries, least recently used first, until within the budget.
+		std::size_t trim();
+
+		// Evicts every unreferenced entry, regardless of the budget.
+		std::size_t clear();
+
+		void setBudget(std::size_t budgetBytes);
+		std::size_t getBudget() const { return budget; }
+
+		const AssetCacheStats& getStats() const { return stats; }
+
+		AssetLoader& getLoader() { return loader; }
+
+	private:
+		static constexpr uint32_t none = UINT32_MAX;
+
+		struct Entry
+		{
+			AssetHandle handle;
+			std::size_t bytes = 0;  // Counted in bytes_resident once ready
+			bool accounted = false;
+
+			// Recency list, most recent first.
+			uint32_t prev = none;
+			uint32_t next = none;
+		};
+
+		void sync();
+		void rekey();
+		void recount();
+		void link(uint32_t index);
+		void unlink(uint32_t index);
+		void evict(uint32_t index);
+		std::size_t evictUntil(std::size_t limit);
+
+		AssetLoader& loader;
+		std::size_t budget;
+		AssetCacheStats stats;
+
+		// By AssetId.
+		std::vector<Entry> entries;
+		uint32_t head = none;
+		uint32_t tail = none;
+
+		// Entries that were loading at the last update().
+		std::vector<uint32_t> loading;
+
+		// Loader state the entries were last checked against.
+		uint64_t generation = 0;
+		uint64_t reloads = 0;
+	};
+
+} // namespace blaze
@@ -0,0 +1,238 @@
+#pragma once
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "Blaze2D/util/Manifest.h"
+
+struct SDL_Renderer;
+struct SDL_Surface;
+struct SDL_Texture;
+
+namespace blaze
+{
+	namespace detail {
+		struct AssetSlot;
+		struct DecodeResult;
+	}
+
+	enum class AssetState : uint8_t
+	{
+		Queued,   // Waiting for a worker
+		Decoding, // Being read / decoded on a worker
+		Decoded,  // Waiting for AssetLoader::update() on the main thread
+		Ready,
+		Failed
+	};
+
+	/**
+	* @brief Reference-counted handle to an asset requested from an AssetLoader.
+	*
+	* Copies share the loaded asset, which is freed (texture included) when
+	* the last handle goes away. Dropping every handle before the asset is
+	* decoded cancels the load. Handles must be used and released on the
+	* main thread, before the renderer the loader uploads to is destroyed.
+	*
+	* Handles stay valid across AssetLoader::reload() and setManifest(): the
+	* texture, surface or data they return is replaced in place, so callers
+	* should fetch it each frame rather than keep the pointer.
+	*/
+	class AssetHandle
+	{
+	public:
+		AssetHandle() = default;
+
+		bool valid() const { return slot != nullptr; }
+		explicit operator bool() const { return valid(); }
+
+		AssetId getId() const;
+		AssetState getState() const;
+		bool ready() const { return getState() == AssetState::Ready; }
+		bool failed() const { return getState() == AssetState::Failed; }
+
+		// Texture of a ready image asset, or nullptr (not ready, not an image, or no renderer).
+		SDL_Texture* getTexture() const;
+
+		// Decoded image of a ready asset when the loader has no renderer, otherwise nullptr.
+		SDL_Surface* getSurface() const;
+
+		// Contents of a ready non-image asset (memory mapped), otherwise empty.
+		std::string_view getData() const;
+
+		// Reason a failed asset failed, otherwise empty.
+		const std::string& getError() const;
+
+		/**
+		* @brief Estimated memory held by a ready asset: texture or surface
+		* pixels (pitch * height) or the mapped file size. 0 until ready.
+		*/
+		std::size_t getMemorySize() const;
+
+		// Number of handles sharing this asset (0 for an empty handle).
+		long getUseCount() const { return slot.use_count(); }
+
+		// Incremented every time new contents are applied (first load and reloads).
+		uint32_t getVersion() const;
+
+		friend bool operator==(const AssetHandle&, const AssetHandle&) = default;
+
+	private:
+		friend class AssetLoader;
+		explicit AssetHandle(std::shared_ptr<detail::AssetSlot> slot) : slot(std::move(slot)) {}
+
+		std::shared_ptr<detail::AssetSlot> slot;
+	};
+
+	struct AssetLoaderOptions
+	{
+		std::size_t threads = 0;        // Worker threads; 0 uses one less than the hardware threads (at least 1)
+		double upload_budget_ms = 2.0;  // Main-thread time update() may spend finishing assets per call
+		bool map_files = true;          // Non-image files are mapped; false reads them (needed for hot reload)
+	};
+
+	/**
+	* @brief Difference between two manifests, matched by asset name.
+	* Ids refer to the new manifest.
+	*/
+	struct ManifestDiff
+	{
+		std::vector<AssetId> added;
+		std::vector<AssetId> changed;       // Type, path or flags differ
+		std::vector<std::string> removed;   // Names no longer in the manifest
+		std::size_t unchanged = 0;
+
+		bool empty() const { return added.empty() && changed.empty() && removed.empty(); }
+	};
+
+	/**
+	* @brief Loads the assets of a Manifest on a pool of worker threads.
+	*
+	* Workers read and decode files: images (by file extension) are decoded
+	* to surfaces with SDL3_image, everything else is memory mapped. Decoded
+	* assets are handed back to the main thread, where update() turns image
+	* surfaces into textures within a per-call time budget, so a level load
+	* overlaps disk I/O and decoding with rendering instead of blocking it.
+	*
+	* Requesting an asset that is still loaded (some handle to it is alive)
+	* returns the same handle. The Manifest passed to the constructor must
+	* outlive the loader, or be replaced with setManifest().
+	*/
+	class AssetLoader
+	{
+	public:
+		/**
+		* @param renderer renderer that image textures are created for; with
+		* nullptr images stay surfaces (headless tools, tests)
+		*/
+		explicit AssetLoader(const Manifest& manifest, SDL_Renderer* renderer = nullptr, const AssetLoaderOptions& options = {});
+		~AssetLoader();
+
+		AssetLoader(const AssetLoader&) = delete;
+		AssetLoader& operator=(const AssetLoader&) = delete;
+
+		/**
+		* @brief Starts loading an asset, or returns the handle of its load in progress.
+		* @throws std::out_of_range if the asset is not in the manifest
+		*/
+		AssetHandle load(AssetId id);
+		AssetHandle load(std::string_view name);
+
+		// Starts loading every asset of a type, in manifest order.
+		std::vector<AssetHandle> loadType(std::string_view type);
+
+		/**
+		* @brief Finishes decoded assets on the calling (main) thread: creates
+		* textures and marks assets ready or failed. Stops once the upload
+		* budget is spent, but always finishes at least one asset.
+		* @return the number of assets finished
+		*/
+		std::size_t update();
+
+		/**
+		* @brief Blocks until 'handle' is ready or failed, finishing it on the
+		* calling thread. For loads that cannot be deferred.
+		* @throws std::invalid_argument if the handle is empty
+		*/
+		void wait(const AssetHandle& handle);
+
+		// Blocks until every requested asset is ready or failed.
+		void waitAll();
+
+		/**
+		* @brief Decodes a loaded asset again, e.g. after its file changed.
+		* Handles keep the old contents until update() applies the new ones;
+		* if decoding fails the old contents are kept and the error is logged.
+		* @return false if no handle to the asset is alive (nothing to reload)
+		* @throws std::out_of_range if the asset is not in the manifest
+		*/
+		bool reload(AssetId id);
+
+		/**
+		* @brief Switches to a new version of the manifest, which the loader
+		* then owns.
+		*
+		* Assets are matched by name. Live handles keep their asset and get
+		* its new id (an invalid one if it was removed); assets whose type,
+		* path or flags changed are reloaded. Unchanged assets cost one name
+		* lookup each, with no file access.
+		*/
+		ManifestDiff setManifest(Manifest&& next);
+
+		// Requested assets that are not ready or failed yet.
+		std::size_t getPendingCount() const;
+
+		std::size_t getThreadCount() const { return workers.size(); }
+
+		const Manifest& getManifest() const { return *manifest; }
+
+		// Incremented by every setManifest(); ids from older generations are stale.
+		uint64_t getManifestGeneration() const { return generation; }
+
+		// Reloads applied by update() / wait() so far.
+		uint64_t getReloadCount() const { return reloads; }
+
+		// True for file extensions decoded with SDL3_image.
+		static bool isImagePath(const std::filesystem::path& path);
+
+	private:
+		struct Job
+		{
+			std::weak_ptr<detail::AssetSlot> slot;
+			std::filesystem::path path;
+			bool image = false;
+		};
+
+		void enqueue(const std::shared_ptr<detail::AssetSlot>& slot);
+		void workerLoop();
+		void finish(detail::DecodeResult& result);
+
+		const Manifest* manifest;
+		std::unique_ptr<Manifest> owned_manifest; // Set by setManifest()
+		SDL_Renderer* renderer;
+		AssetLoaderOptions options;
+		uint64_t generation = 0;
+		uint64_t reloads = 0;
+
+		// By AssetId; main thread only.
+		std::vector<std::weak_ptr<detail::AssetSlot>> slots;
+
+		mutable std::mutex mutex;
+		std::condition_variable work_available;
+		std::condition_variable decoded_available;
+		std::deque<Job> queue;
+		std::deque<std::unique_ptr<detail::DecodeResult>> decoded;
+		std::size_t pending = 0;
+		bool stopping = false;
+
+		std::vector<std::thread> workers;
+	};
+
+} // namespace blaze
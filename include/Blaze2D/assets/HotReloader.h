@@ -0,0 +1,70 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+
+#include "Blaze2D/assets/AssetLoader.h"
+#include "Blaze2D/util/FileWatcher.h"
+
+namespace blaze
+{
+	/**
+	* @brief Reloads a loader's manifest and assets when their files change.
+	*
+	* The manifest file and the file of every asset in it are watched. When
+	* the manifest changes it is parsed again and handed to
+	* AssetLoader::setManifest(), which diffs it by name; only the watches of
+	* added, changed and removed assets are touched. When an asset file
+	* changes, that asset is reloaded if anything holds a handle to it.
+	* Handles stay valid throughout and pick up the new contents once
+	* AssetLoader::update() applies them.
+	*
+	* Files are rewritten in place by editors and exporters, so the loader
+	* should read rather than map them (AssetLoaderOptions::map_files = false)
+	* and the initial Manifest should be constructed with mapFile = false.
+	*
+	* Main thread only. Call update() once per frame before AssetLoader::update().
+	*/
+	class HotReloader
+	{
+	public:
+		explicit HotReloader(AssetLoader& loader);
+
+		HotReloader(const HotReloader&) = delete;
+		HotReloader& operator=(const HotReloader&) = delete;
+
+		/**
+		* @brief Handles the file changes since the last call. Never blocks
+		* on the reloads it starts. A manifest that fails to parse (e.g. saved
+		* halfway through an edit) is logged and the current one is kept.
+		* @return the number of assets reloaded, added or removed
+		*/
+		std::size_t update();
+
+		// Result of the last manifest reload.
+		const ManifestDiff& getLastDiff() const { return last_diff; }
+
+		uint64_t getManifestReloadCount() const { return manifest_reloads; }
+
+		const FileWatcher& getWatcher() const { return watcher; }
+
+	private:
+		void watchAsset(const AssetDescriptor& asset);
+		void unwatchAsset(const std::string& name);
+		std::size_t reloadManifest();
+
+		AssetLoader& loader;
+		FileWatcher watcher;
+		std::filesystem::path manifest_path; // Normalized
+
+		// Watched file of each asset, and the assets of each file (several may share one).
+		std::unordered_map<std::string, std::string> file_by_name;
+		std::unordered_multimap<std::string, std::string> names_by_file;
+
+		ManifestDiff last_diff;
+		uint64_t manifest_reloads = 0;
+	};
+
+} // namespace blaze
@@ -1,14 +1,116 @@
 #pragma once
 
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
 
+#include "Blaze2D/util/Rect.h"
+#include "Blaze2D/internal/PerfectHash.h"
+
+struct SDL_Renderer;
+struct SDL_Texture;
 
 namespace blaze
 {
+	/**
+	* @brief Index of a sprite within an Atlas.
+	* Resolve names to ids once (at load time) and draw by id every frame.
+	*/
+	struct SpriteId
+	{
+		static constexpr uint32_t invalid_value = UINT32_MAX;
+
+		uint32_t value = invalid_value;
+
+		constexpr bool valid() const { return value != invalid_value; }
+		constexpr explicit operator bool() const { return valid(); }
+
+		friend constexpr bool operator==(SpriteId, SpriteId) = default;
+	};
+
+	/**
+	* @brief Named sprites packed onto one or more equally sized texture pages.
+	*
+	* Loaded from a JSON sprite sheet (a single page) of the form:
+	*
+	*   {
+	*     "image": "sheet.png",
+	*     "sprites": {
+	*       "name": { "x": 0, "y": 0, "w": 32, "h": 32 },
+	*       ...
+	*     }
+	*   }
+	*
+	* or packed at runtime by AtlasBuilder. 'image' is relative to the JSON file.
+	* Sprite rects, UVs and pages are stored in flat arrays indexed by SpriteId,
+	* so drawing never touches names.
+	*/
 	class Atlas
 	{
+	public:
+		/**
+		* @throws std::runtime_error if the description is malformed or the
+		*         image cannot be loaded.
+		*/
+		Atlas(SDL_Renderer* renderer, const std::filesystem::path& jsonPath);
+		~Atlas();
+
+		Atlas(const Atlas&) = delete;
+		Atlas& operator=(const Atlas&) = delete;
+		Atlas(Atlas&& other) noexcept;
+		Atlas& operator=(Atlas&& other) noexcept;
+
+		// First page; the only one for atlases loaded from JSON.
+		SDL_Texture* getTexture() const { return pages.empty() ? nullptr : pages.front(); }
+		SDL_Texture* getTexture(SpriteId id) const { return pages[spritePages[id.value]]; }
+
+		std::size_t getPageCount() const { return pages.size(); }
+		uint32_t getPage(SpriteId id) const { return spritePages[id.value]; }
+
+		// Page size in pixels.
+		float getWidth() const { return width; }
+		float getHeight() const { return height; }
+
+		// Id of the named sprite, or an invalid SpriteId if there is none.
+		SpriteId find(std::string_view name) const;
+
+		// Source rect in page pixels. 'id' must be valid for this atlas.
+		const Rect& getRect(SpriteId id) const { return rects[id.value]; }
+
+		// Source rect normalized to [0, 1] over its page.
+		const Rect& getUV(SpriteId id) const { return uvs[id.value]; }
+
+		std::string_view getName(SpriteId id) const { return names[id.value]; }
+
+		std::span<const Rect> getRects() const { return rects; }
+		std::size_t size() const { return rects.size(); }
+
+		// Draws a sprite into 'dst' with a single SDL_RenderTexture call.
+		void draw(SDL_Renderer* renderer, SpriteId id, const Rect& dst) const;
+
+	private:
+		friend class AtlasBuilder;
+
+		Atlas() = default;
+
+		void parse(std::string_view json, std::filesystem::path& imagePath);
 
+		// Builds UVs and the name lookup once rects, names and pages are set.
+		void finalize();
 
+		void release();
 
+		std::vector<SDL_Texture*> pages;
+		float width = 0.0f;
+		float height = 0.0f;
 
+		std::vector<Rect> rects;
+		std::vector<Rect> uvs;
+		std::vector<uint32_t> spritePages;
+		std::vector<std::string> names;
+		detail::PerfectHash nameHash;
 	};
-} // namespace blaze
\ No newline at end of file
+} // namespace blaze
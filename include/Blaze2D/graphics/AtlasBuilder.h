@@ -0,0 +1,71 @@
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Blaze2D/graphics/Atlas.h"
+
+struct SDL_Renderer;
+struct SDL_Surface;
+
+namespace blaze
+{
+	class Manifest;
+
+	struct AtlasBuilderOptions
+	{
+		int page_width = 2048;
+		int page_height = 2048;
+		int padding = 1; // Transparent pixels between neighbouring sprites
+		int extrude = 1; // Edge pixels repeated around each sprite to avoid bleeding when filtering
+	};
+
+	/**
+	* @brief Packs loose images into the pages of a single Atlas.
+	*
+	* Images are collected as surfaces, packed with a skyline packer and copied
+	* onto RGBA pages, one texture per page. Sprites keep the order in which they
+	* were added, so SpriteIds are deterministic for a given input.
+	*/
+	class AtlasBuilder
+	{
+	public:
+		explicit AtlasBuilder(AtlasBuilderOptions options = {});
+		~AtlasBuilder();
+
+		AtlasBuilder(const AtlasBuilder&) = delete;
+		AtlasBuilder& operator=(const AtlasBuilder&) = delete;
+
+		// Adds a sprite; the builder takes ownership of 'surface'.
+		void add(std::string_view name, SDL_Surface* surface);
+
+		// @throws std::runtime_error if the image cannot be loaded
+		void addFile(std::string_view name, const std::filesystem::path& path);
+
+		// Adds every asset of 'type' in the manifest, named after its asset name.
+		void addManifest(const Manifest& manifest, std::string_view type = "sprite");
+
+		std::size_t size() const { return entries.size(); }
+
+		/**
+		* @brief Packs all added images and uploads the pages.
+		* The builder keeps its images, so build() may be called again.
+		* @throws std::runtime_error if an image is larger than a page or a
+		*         page cannot be created
+		*/
+		Atlas build(SDL_Renderer* renderer) const;
+
+	private:
+		struct Entry
+		{
+			std::string name;
+			SDL_Surface* surface;
+		};
+
+		AtlasBuilderOptions options;
+		std::vector<Entry> entries;
+	};
+
+} // namespace blaze
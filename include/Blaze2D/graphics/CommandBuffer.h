@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "Blaze2D/util/Color.h"
+#include "Blaze2D/util/Rect.h"
+
+struct SDL_Rect;
+struct SDL_Renderer;
+struct SDL_Texture;
+
+namespace blaze
+{
+	// Layout-compatible with SDL_Vertex (checked in CommandBuffer.cpp).
+	struct Vertex
+	{
+		float x, y;
+		float r, g, b, a;
+		float u, v;
+	};
+
+	/**
+	* @brief Draw commands recorded without touching SDL, replayed later
+	* against an SDL_Renderer.
+	*
+	* Commands and their data (rect lists, vertices) are appended to one
+	* linear block of memory that reset() rewinds without freeing, so a
+	* buffer recording frames of steady size does not allocate. Recording
+	* is plain memory writes and may happen on any thread; replay() must
+	* run on the renderer's thread.
+	*
+	* Textures are referenced, not copied: they must stay alive until the
+	* buffer has been replayed.
+	*/
+	class CommandBuffer
+	{
+	public:
+		CommandBuffer() = default;
+
+		// Forgets all commands, keeping the memory.
+		void reset();
+
+		void clear(const Color& color);
+		void fillRect(const Rect& rect, const Color& color);
+		void fillRects(std::span<const Rect> rects, const Color& color);
+
+		// Whole texture, or the 'src' pixels of it, into 'dst'.
+		void drawTexture(SDL_Texture* texture, const Rect& dst);
+		void drawTexture(SDL_Texture* texture, const Rect& src, const Rect& dst);
+
+		/**
+		* @brief Quads of four vertices each, clockwise from the top-left,
+		* drawn with one SDL_RenderGeometry call. 'texture' may be nullptr.
+		*/
+		void drawQuads(SDL_Texture* texture, std::span<const Vertex> vertices);
+
+		// Restricts drawing to 'rect' (whole pixels), or lifts the restriction.
+		void setClip(const Rect& rect);
+		void resetClip();
+
+		// An SDL_BlendMode value.
+		void setBlendMode(uint32_t mode);
+
+		// Issues the recorded commands in order. Returns the number of commands.
+		std::size_t replay(SDL_Renderer* renderer);
+
+		/**
+		* @brief Replays into 'paintRect' (rounded out to whole pixels) only,
+		* for repainting part of a persistent target: clears fill the rect
+		* instead of the target, clips are intersected with it and
+		* resetClip() goes back to it.
+		*/
+		std::size_t replay(SDL_Renderer* renderer, const Rect& paintRect);
+
+		std::size_t size() const { return count; }
+		bool empty() const { return count == 0; }
+
+		// Bytes of command data recorded.
+		std::size_t bytes() const { return data.size(); }
+
+	private:
+		enum class Op : uint32_t
+		{
+			Clear,
+			FillRect,
+			FillRects,
+			Texture,
+			Quads,
+			Clip,
+			BlendMode
+		};
+
+		// Every command starts with a header and is padded to 8 bytes.
+		struct Header
+		{
+			Op op;
+			uint32_t size; // Including the header
+		};
+
+		// 'bound' is the paint rect, or nullptr for the whole target.
+		std::size_t replayInto(SDL_Renderer* renderer, const SDL_Rect* bound);
+
+		template <typename T>
+		void push(Op op, const T& command, const void* extra = nullptr, std::size_t extraBytes = 0);
+
+		std::vector<std::byte> data;
+		std::size_t count = 0;
+
+		// Shared index pattern for quads, grown on replay.
+		std::vector<int> quad_indices;
+	};
+
+} // namespace blaze
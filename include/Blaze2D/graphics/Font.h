@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Blaze2D/util/Rect.h"
+#include "Blaze2D/util/Vec.h"
+
+struct SDL_Surface;
+
+namespace blaze
+{
+	/**
+	* @brief One character of a Font.
+	* 'src' is in page pixels; 'offset' is from the pen position at the top
+	* of the line to the glyph's top-left corner.
+	*/
+	struct Glyph
+	{
+		char32_t codepoint = 0;
+		Rect src;
+		Vec2 offset;
+		float advance = 0.0f;
+		uint32_t page = 0;
+	};
+
+	/**
+	* @brief Bitmap font in the AngelCode BMFont text format.
+	*
+	*   info face="Sans" size=16
+	*   common lineHeight=19 base=15 scaleW=256 scaleH=256 pages=1
+	*   page id=0 file="sans_0.png"
+	*   char id=65 x=0 y=0 width=10 height=12 xoffset=0 yoffset=3 xadvance=10 page=0
+	*   kerning first=65 second=86 amount=-1
+	*
+	* Pages are kept in CPU memory as RGBA32 surfaces; GlyphCache copies the
+	* glyphs that are drawn onto its own texture pages. Pages without an alpha
+	* channel (the usual 8-bit BMFont export) are treated as coverage: their
+	* brightness becomes alpha over white, so text takes its tint's color.
+	*
+	* Glyphs are referred to by index, resolved once per character by layout.
+	*/
+	class Font
+	{
+	public:
+		static constexpr uint32_t no_glyph = UINT32_MAX;
+
+		/**
+		* @brief Loads a .fnt file and its page images, which are relative to it.
+		* @throws std::runtime_error if the file is malformed or a page cannot be loaded
+		*/
+		explicit Font(const std::filesystem::path& fntPath);
+
+		/**
+		* @brief Builds a font from a description and already loaded pages,
+		* indexed by page id. Takes ownership of the surfaces; 'page' lines in
+		* the description are ignored.
+		* @throws std::runtime_error if the description is malformed or a page is missing
+		*/
+		Font(std::string_view description, std::vector<SDL_Surface*> pages);
+
+		~Font();
+
+		Font(const Font&) = delete;
+		Font& operator=(const Font&) = delete;
+
+		// Identifies the font in glyph and layout caches; never reused within a run.
+		uint64_t getId() const { return id; }
+
+		const std::string& getFace() const { return face; }
+		float getSize() const { return size; }
+
+		// Distance between baselines, and from the top of a line to its baseline.
+		float getLineHeight() const { return lineHeight; }
+		float getBase() const { return base; }
+
+		/**
+		* @brief Index of the glyph for 'codepoint'. Characters the font lacks
+		* map to its '?' glyph if it has one, else to no_glyph.
+		*/
+		uint32_t findGlyph(char32_t codepoint) const;
+
+		// 'index' must be a valid glyph index.
+		const Glyph& getGlyph(uint32_t index) const { return glyphs[index]; }
+		std::size_t getGlyphCount() const { return glyphs.size(); }
+
+		// Advance adjustment between two consecutive characters.
+		float getKerning(char32_t first, char32_t second) const;
+
+		// RGBA32 page surface.
+		const SDL_Surface* getPage(uint32_t page) const { return pages[page]; }
+		std::size_t getPageCount() const { return pages.size(); }
+
+	private:
+		struct Kerning
+		{
+			uint64_t pair; // First codepoint in the high half
+			float amount;
+		};
+
+		// Parses the description; appends the page files it names to 'files'.
+		void parse(std::string_view text, std::vector<std::string>* files);
+
+		// Sorts the lookup tables once glyphs and kerning are read.
+		void finalize();
+
+		void adoptPage(SDL_Surface* surface);
+		void release();
+
+		uint64_t id;
+		std::string face;
+		float size = 0.0f;
+		float lineHeight = 0.0f;
+		float base = 0.0f;
+
+		std::vector<Glyph> glyphs;         // Sorted by codepoint
+		uint32_t ascii[128];               // Glyph index per ASCII character
+		uint32_t fallback = no_glyph;
+		std::vector<Kerning> kernings;     // Sorted by pair
+		std::vector<SDL_Surface*> pages;
+	};
+
+} // namespace blaze
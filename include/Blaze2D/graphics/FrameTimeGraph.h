@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "Blaze2D/util/Color.h"
+#include "Blaze2D/util/Rect.h"
+
+struct SDL_Renderer;
+
+namespace blaze
+{
+	/**
+	* @brief On-screen bar graph of recent frame times.
+	*
+	* One bar per frame, newest on the right, scaled so the budget line sits
+	* at half the height; frames over budget are drawn in 'over_color'.
+	* Typically fed from App::getFrameStats().frame_ms and drawn at the end
+	* of a render callback:
+	*
+	*   graph.push(app.getFrameStats().frame_ms);
+	*   graph.draw(renderer, Rect(8.f, 8.f, 240.f, 60.f));
+	*
+	* A window with dirty tracking must invalidate the graph's rect each frame.
+	*/
+	class FrameTimeGraph
+	{
+	public:
+		explicit FrameTimeGraph(std::size_t frames = 120, double budgetMs = 1000.0 / 60.0);
+
+		void push(double frameMs);
+
+		// Draws the graph into 'area' with one SDL_RenderFillRects call per color.
+		void draw(SDL_Renderer* renderer, const Rect& area);
+
+		void setBudget(double budgetMs) { budget_ms = budgetMs; }
+		double getBudget() const { return budget_ms; }
+
+		// Statistics over the frames currently in the graph.
+		double getAverage() const;
+		double getMax() const;
+		std::size_t size() const { return count; }
+
+		Color background_color = Color(0.f, 0.f, 0.f, 0.6f);
+		Color under_color = Color(0.3f, 0.85f, 0.4f, 1.f);
+		Color over_color = Color(0.95f, 0.25f, 0.2f, 1.f);
+		Color budget_color = Color(1.f, 1.f, 1.f, 0.5f);
+
+	private:
+		std::vector<double> samples; // Ring buffer
+		std::size_t next = 0;
+		std::size_t count = 0;
+		double budget_ms;
+
+		// Bars by color; Rect is layout-compatible with SDL_FRect (checked in FrameTimeGraph.cpp).
+		std::vector<Rect> under;
+		std::vector<Rect> over;
+	};
+
+} // namespace blaze
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "Blaze2D/graphics/RectPacker.h"
+#include "Blaze2D/util/Rect.h"
+
+struct SDL_Renderer;
+struct SDL_Surface;
+struct SDL_Texture;
+
+namespace blaze
+{
+	class Font;
+
+	struct GlyphCacheOptions
+	{
+		int page_size = 512;        // Width and height of each texture page
+		std::size_t max_pages = 4;  // Pages kept before the least recently used one is recycled
+		int padding = 1;            // Transparent pixels between neighbouring glyphs
+	};
+
+	struct GlyphCacheStats
+	{
+		uint64_t hits = 0;
+		uint64_t misses = 0;    // Glyphs copied and uploaded
+		uint64_t evictions = 0; // Pages recycled
+	};
+
+	/**
+	* @brief Where a glyph currently lives in a GlyphCache.
+	* Valid while its page keeps the same generation; see GlyphCache::isCurrent().
+	*/
+	struct CachedGlyph
+	{
+		static constexpr uint32_t no_page = UINT32_MAX;
+
+		SDL_Texture* texture = nullptr;
+		Rect uv;
+		uint32_t page = no_page;
+		uint32_t generation = 0;
+	};
+
+	/**
+	* @brief Texture atlas of the glyphs being drawn, filled on demand.
+	*
+	* A glyph is copied from its font's page and uploaded the first time it
+	* is asked for, onto the first page it fits on (skyline packing). Once
+	* every page is full, the least recently used page is cleared and reused
+	* as a whole: evicting single glyphs would leave holes the packer cannot
+	* fill. Clearing bumps the page's generation, which tells holders of a
+	* CachedGlyph to look it up again.
+	*
+	* Call beginFrame() once per frame before drawing text. Pages used in the
+	* current frame are never recycled, since quads already queued in a
+	* SpriteBatch point at them; if they are all in use the cache grows past
+	* max_pages instead.
+	*
+	* Glyphs are keyed by Font::getId(), so a destroyed font's glyphs simply
+	* age out. Uploads textures, so use the cache on the render thread (from
+	* onRender, not from the record callbacks of pipelined frames).
+	*/
+	class GlyphCache
+	{
+	public:
+		// @throws std::runtime_error without a renderer, std::invalid_argument for bad options
+		explicit GlyphCache(SDL_Renderer* renderer, GlyphCacheOptions options = {});
+		~GlyphCache();
+
+		GlyphCache(const GlyphCache&) = delete;
+		GlyphCache& operator=(const GlyphCache&) = delete;
+
+		void beginFrame() { ++frame; }
+
+		/**
+		* @brief Location of a glyph of 'font', uploading it if it is not cached.
+		* @throws std::invalid_argument if the glyph is empty or larger than a page
+		* @throws std::runtime_error if a page cannot be created
+		*/
+		CachedGlyph get(const Font& font, uint32_t glyph);
+
+		// Whether 'cached' still points at its glyph.
+		bool isCurrent(const CachedGlyph& cached) const
+		{
+			return cached.page < pages.size() && pages[cached.page].generation == cached.generation;
+		}
+
+		/**
+		* @brief Keeps 'cached' usable for this frame: marks its page used if
+		* it is current, looks the glyph up again otherwise.
+		*/
+		void refresh(const Font& font, uint32_t glyph, CachedGlyph& cached)
+		{
+			if (isCurrent(cached))
+				pages[cached.page].last_used = frame;
+			else
+				cached = get(font, glyph);
+		}
+
+		// Drops every glyph; pages are kept for reuse.
+		void clear();
+
+		std::size_t getPageCount() const { return pages.size(); }
+		std::size_t getGlyphCount() const { return glyphs.size(); }
+		SDL_Texture* getPageTexture(std::size_t page) const { return pages[page].texture; }
+		const GlyphCacheOptions& getOptions() const { return options; }
+		const GlyphCacheStats& getStats() const { return stats; }
+
+	private:
+		struct Key
+		{
+			uint64_t font;
+			uint32_t glyph;
+
+			bool operator==(const Key&) const = default;
+		};
+
+		struct KeyHash
+		{
+			std::size_t operator()(const Key& key) const noexcept
+			{
+				return std::size_t((key.font * 0x9E3779B97F4A7C15ull) ^ key.glyph);
+			}
+		};
+
+		struct Page
+		{
+			SDL_Surface* surface;
+			SDL_Texture* texture;
+			SkylinePacker packer;
+			uint64_t last_used;
+			uint32_t generation;
+			std::vector<Key> keys; // Glyphs on the page, erased with it
+		};
+
+		void addPage();
+		void recycle(Page& page);
+
+		// Copies the glyph onto 'page' at (x, y) and uploads that rect.
+		CachedGlyph upload(const Font& font, uint32_t glyph, uint32_t page, int x, int y);
+
+		SDL_Renderer* renderer;
+		GlyphCacheOptions options;
+		GlyphCacheStats stats;
+		uint64_t frame = 1;
+
+		std::vector<Page> pages;
+		std::unordered_map<Key, CachedGlyph, KeyHash> glyphs;
+	};
+
+} // namespace blaze
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace blaze
+{
+	struct PackSize
+	{
+		int w = 0;
+		int h = 0;
+	};
+
+	struct PackedRect
+	{
+		int x = 0;
+		int y = 0;
+		uint32_t page = 0;
+	};
+
+	/**
+	* @brief Skyline bottom-left packer for a single page.
+	*
+	* The skyline is the upper contour of everything placed so far. Each
+	* insertion tries every skyline segment, picks the lowest (then leftmost)
+	* position that fits, and raises the skyline there. Insertion is linear in
+	* the number of segments, which stays small because adjacent segments of
+	* equal height are merged.
+	*/
+	class SkylinePacker
+	{
+	public:
+		SkylinePacker(int width, int height);
+
+		// Places a w x h rect, or returns false if it does not fit on this page.
+		bool insert(int w, int h, int& x, int& y);
+
+		void reset();
+
+		int getWidth() const { return width; }
+		int getHeight() const { return height; }
+
+		// Fraction of the page area covered by inserted rects.
+		float occupancy() const;
+
+	private:
+		struct Segment
+		{
+			int x;
+			int y;
+			int w;
+		};
+
+		// Lowest y at which a rect of width w can rest starting at segment i, or -1.
+		int fit(std::size_t i, int w, int h) const;
+
+		int width;
+		int height;
+		int64_t usedArea = 0;
+		std::vector<Segment> skyline;
+	};
+
+	/**
+	* @brief Packs rects onto as many width x height pages as needed.
+	*
+	* Rects are placed tallest first, which keeps the skyline flat and
+	* occupancy high. Results are written to 'out' in input order.
+	*
+	* @return the number of pages used
+	* @throws std::invalid_argument if a rect is larger than a page
+	*/
+	uint32_t pack_rects(std::span<const PackSize> sizes, int width, int height, std::span<PackedRect> out);
+
+} // namespace blaze
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Blaze2D/graphics/Atlas.h"
+#include "Blaze2D/graphics/CommandBuffer.h"
+#include "Blaze2D/util/Color.h"
+#include "Blaze2D/util/Rect.h"
+#include "Blaze2D/util/Vec.h"
+
+struct SDL_Renderer;
+struct SDL_Texture;
+
+namespace blaze
+{
+	enum class SpriteSortMode
+	{
+		Texture,    // Sort by layer, then texture; submission order is kept among equal keys
+		Submission  // Sort by layer only; consecutive sprites sharing a texture are still merged
+	};
+
+	/**
+	* @brief Collects textured quads and submits them with one SDL_RenderGeometry
+	* call per texture run.
+	*
+	* Usage per frame:
+	*
+	*   batch.begin();
+	*   batch.draw(atlas, id, dst);
+	*   ...
+	*   batch.end(renderer);
+	*
+	* Lower layers are drawn first. Vertex, index and sort buffers are kept
+	* between frames, so a batch of steady size does not allocate.
+	*/
+	class SpriteBatch
+	{
+	public:
+		explicit SpriteBatch(std::size_t reserveSprites = 1024);
+
+		void begin(SpriteSortMode mode = SpriteSortMode::Texture);
+
+		// Whole texture into 'dst'.
+		void draw(SDL_Texture* texture, const Rect& dst, const Color& tint = Color(1.f, 1.f, 1.f, 1.f), int layer = 0);
+
+		// 'src' is in texture pixels.
+		void draw(SDL_Texture* texture, const Rect& src, const Rect& dst, const Color& tint = Color(1.f, 1.f, 1.f, 1.f), int layer = 0);
+
+		// 'uv' is normalized to [0, 1] over the texture, as from Atlas::getUV() or GlyphCache.
+		void drawUV(SDL_Texture* texture, const Rect& uv, const Rect& dst, const Color& tint = Color(1.f, 1.f, 1.f, 1.f), int layer = 0);
+
+		// Atlas sprite into 'dst'. 'id' must be valid for 'atlas'.
+		void draw(const Atlas& atlas, SpriteId id, const Rect& dst, const Color& tint = Color(1.f, 1.f, 1.f, 1.f), int layer = 0);
+
+		// Atlas sprite at its native size with its top-left corner at 'position'.
+		void draw(const Atlas& atlas, SpriteId id, const Vec2& position, const Color& tint = Color(1.f, 1.f, 1.f, 1.f), int layer = 0);
+
+		// Untextured quad.
+		void fill(const Rect& dst, const Color& color, int layer = 0);
+
+		/**
+		* @brief Sorts the collected sprites and submits them to 'renderer'.
+		* @return the number of SDL_RenderGeometry calls made
+		*/
+		std::size_t end(SDL_Renderer* renderer);
+
+		/**
+		* @brief Sorts the collected sprites and records them into 'commands',
+		* one drawQuads command per texture run, for replay on the render thread.
+		* @return the number of commands recorded
+		*/
+		std::size_t end(CommandBuffer& commands);
+
+		// Sprites queued since begin().
+		std::size_t size() const { return sprites.size(); }
+
+		// Statistics of the last end().
+		std::size_t getSpriteCount() const { return lastSpriteCount; }
+		std::size_t getDrawCallCount() const { return lastDrawCalls; }
+
+	private:
+		struct Sprite
+		{
+			Rect dst;
+			Rect uv;
+			Color color;
+		};
+
+		struct SortEntry
+		{
+			int32_t layer;
+			uint32_t index;
+			SDL_Texture* texture;
+		};
+
+		void push(SDL_Texture* texture, const Rect& dst, const Rect& uv, const Color& color, int layer);
+		void sort();
+
+		// Sorts and fills 'vertices' in draw order. Returns the sprite count.
+		std::size_t build();
+
+		// Calls submit(texture, firstSprite, spriteCount) per run of one texture.
+		template <typename Submit>
+		void submitRuns(std::size_t count, Submit&& submit);
+
+		SpriteSortMode mode = SpriteSortMode::Texture;
+
+		std::vector<Sprite> sprites;
+		std::vector<SortEntry> order;
+
+		// Per-frame scratch, grown on demand and reused.
+		std::vector<Vertex> vertices;
+		std::vector<int> indices;
+
+		// Size of the last texture drawn with a pixel source rect.
+		SDL_Texture* sizedTexture = nullptr;
+		float sizedWidth = 0.0f;
+		float sizedHeight = 0.0f;
+
+		std::size_t lastSpriteCount = 0;
+		std::size_t lastDrawCalls = 0;
+	};
+
+} // namespace blaze
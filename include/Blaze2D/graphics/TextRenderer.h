@@ -0,0 +1,149 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "Blaze2D/graphics/GlyphCache.h"
+#include "Blaze2D/util/Color.h"
+#include "Blaze2D/util/Rect.h"
+#include "Blaze2D/util/Vec.h"
+
+namespace blaze
+{
+	class Font;
+	class SpriteBatch;
+
+	enum class TextAlign
+	{
+		Left,
+		Center,
+		Right
+	};
+
+	struct TextOptions
+	{
+		float max_width = 0.0f; // Wrap at spaces past this width; 0 for no wrapping
+		TextAlign align = TextAlign::Left;
+		float scale = 1.0f; // Positive and finite
+
+		bool operator==(const TextOptions&) const = default;
+	};
+
+	// A glyph placed relative to the top-left corner of its text.
+	struct GlyphQuad
+	{
+		Rect dst;
+		uint32_t glyph; // Index into the font
+	};
+
+	struct TextLine
+	{
+		uint32_t first; // First quad on the line
+		uint32_t count;
+		float width;
+	};
+
+	struct TextLayout
+	{
+		std::vector<GlyphQuad> quads;
+		std::vector<TextLine> lines;
+		Vec2 size;
+	};
+
+	/**
+	* @brief Lays UTF-8 text out with 'font' into 'out', reusing its buffers.
+	*
+	* Applies kerning, breaks lines at '\n' and, with a max_width, at the
+	* last space before the width is exceeded; a word longer than the width
+	* keeps its own line. Lines are aligned within max_width, or within the
+	* widest line without one. Invalid UTF-8 shows as U+FFFD; characters the
+	* font lacks use its '?' glyph or are skipped. Spaces make no quads.
+	* @throws std::invalid_argument if options.scale is not positive and finite
+	*/
+	void layout_text(const Font& font, std::string_view text, const TextOptions& options, TextLayout& out);
+
+	struct TextRendererStats
+	{
+		uint64_t hits = 0;   // Draws that reused a cached layout
+		uint64_t misses = 0; // Draws that laid the text out
+	};
+
+	/**
+	* @brief Draws text through a SpriteBatch, caching layouts.
+	*
+	* Each (font, text, options) layout is kept, least recently used first
+	* out once there are more than 'maxLayouts', so unchanged labels cost a
+	* hash lookup and one quad per glyph per frame. Layouts remember where
+	* their glyphs are in the GlyphCache and look them up again only after
+	* a page has been recycled. A steady set of labels draws without
+	* allocating.
+	*
+	* Quads go through SpriteBatch, so text from one cache page merges into
+	* one draw call with whatever else shares its layer.
+	*/
+	class TextRenderer
+	{
+	public:
+		explicit TextRenderer(GlyphCache& cache, std::size_t maxLayouts = 4096);
+
+		/**
+		* @brief Queues 'text' with its top-left corner at 'position'.
+		* @return the size of the text
+		*/
+		Vec2 draw(SpriteBatch& batch, const Font& font, std::string_view text, const Vec2& position,
+			const Color& color = Color(1.f, 1.f, 1.f, 1.f), const TextOptions& options = {}, int layer = 0);
+
+		// Size 'text' would be drawn at.
+		Vec2 measure(const Font& font, std::string_view text, const TextOptions& options = {});
+
+		// Cached layout of 'text'; valid until the next call that lays text out.
+		const TextLayout& layout(const Font& font, std::string_view text, const TextOptions& options = {});
+
+		void clear();
+
+		std::size_t getLayoutCount() const { return entries.size(); }
+		std::size_t getMaxLayouts() const { return maxLayouts; }
+		const TextRendererStats& getStats() const { return stats; }
+		GlyphCache& getGlyphCache() const { return cache; }
+
+	private:
+		struct Entry
+		{
+			std::string text;
+			uint64_t font;
+			TextOptions options;
+			TextLayout layout;
+			std::vector<CachedGlyph> glyphs; // Per quad
+		};
+
+		// Refers to the text of its entry, so lookups by string_view need no copy.
+		struct Key
+		{
+			uint64_t font;
+			TextOptions options;
+			std::string_view text;
+
+			bool operator==(const Key&) const = default;
+		};
+
+		struct KeyHash
+		{
+			std::size_t operator()(const Key& key) const noexcept;
+		};
+
+		Entry& find(const Font& font, std::string_view text, const TextOptions& requested);
+
+		GlyphCache& cache;
+		std::size_t maxLayouts;
+		TextRendererStats stats;
+
+		std::list<Entry> entries; // Most recently used first
+		std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index;
+	};
+
+} // namespace blaze
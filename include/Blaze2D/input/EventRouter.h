@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+union SDL_Event;
+
+namespace blaze
+{
+	class Container;
+	class Window;
+
+	/**
+	* @brief Fixed-capacity ring of SDL events, allocated once.
+	* When full, pushing drops the oldest event and counts it as dropped.
+	* Quit and window close requests are never dropped: the oldest other
+	* event goes instead, and if there is none a non-critical newcomer or a
+	* repeated request is dropped. A ring holding only distinct close
+	* requests grows.
+	*/
+	class EventRing
+	{
+	public:
+		// 'capacity' is rounded up to a power of two.
+		explicit EventRing(std::size_t capacity = 1024);
+		~EventRing();
+
+		void push(const SDL_Event& event);
+		void clear();
+
+		std::size_t size() const { return count; }
+		std::size_t capacity() const { return mask + 1; }
+		bool empty() const { return count == 0; }
+
+		// i-th oldest event.
+		const SDL_Event& operator[](std::size_t i) const;
+
+		// Rotates the contents in place so they are contiguous, oldest first.
+		std::span<const SDL_Event> linearize();
+
+		// Events dropped since construction.
+		uint64_t getDropped() const { return dropped; }
+
+		// Quit and window close requests, which overflow never drops.
+		static bool isCritical(const SDL_Event& event);
+
+	private:
+		// Frees a slot for 'event' in a full ring. Returns false if 'event' is to be dropped instead.
+		bool makeRoom(const SDL_Event& event);
+
+		std::vector<SDL_Event> storage;
+		std::size_t mask = 0;
+		std::size_t head = 0; // Index of the oldest event
+		std::size_t count = 0;
+		uint64_t dropped = 0;
+	};
+
+	/**
+	* @brief Routes SDL events to windows and down their container trees.
+	*
+	* Events are drained from SDL in batches. Each one is routed to its window
+	* by SDL window id through a flat table, so lookup is a single index. Within
+	* the window the target is the pointer-capturing container, the deepest
+	* container under the pointer, or the focused container for keyboard and
+	* text input. The event then runs through the capture, target and bubble
+	* phases until a handler consumes it.
+	*
+	* Events nobody consumed are kept in a ring that is reset every poll().
+	* Dispatch itself does not allocate once the path buffer has grown to the
+	* depth of the deepest tree.
+	*/
+	class EventRouter
+	{
+	public:
+		explicit EventRouter(std::size_t capacity = 1024);
+		~EventRouter();
+
+		EventRouter(const EventRouter&) = delete;
+		EventRouter& operator=(const EventRouter&) = delete;
+
+		void addWindow(Window& window);
+		void removeWindow(Window& window);
+
+		// Window with the given SDL id, or nullptr.
+		Window* findWindow(uint32_t windowId) const;
+
+		/**
+		* @brief Drains all pending SDL events and routes them.
+		* @return the unconsumed events of this poll, oldest first; valid until the next poll()
+		*/
+		std::span<const SDL_Event> poll();
+
+		/**
+		* @brief Routes a single event, e.g. a synthetic one from a test or replay.
+		* @return true if a handler consumed it. Unconsumed events are not queued.
+		*/
+		bool dispatch(const SDL_Event& event);
+
+		// Merge consecutive motion events of the same mouse or finger before routing (default on).
+		void setCoalesceMotion(bool enabled) { coalesceMotion = enabled; }
+
+		// Unconsumed events lost because a single poll() produced more than the ring holds.
+		uint64_t getDroppedEvents() const { return remaining.getDropped(); }
+
+	private:
+		bool dispatchTo(Container* target, const SDL_Event& event);
+		void routeBatch(std::size_t count);
+
+		std::vector<Window*> windowsById;
+
+		std::vector<SDL_Event> batch;
+		EventRing remaining;
+		std::vector<Container*> path;
+
+		bool coalesceMotion = true;
+	};
+
+} // namespace blaze
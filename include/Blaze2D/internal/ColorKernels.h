@@ -0,0 +1,142 @@
+#pragma once
+
+#include "Blaze2D/util/Color.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace blaze::detail {
+
+    /*
+        Block loops behind the blaze::batch color functions, shared by the
+        per-ISA translation units (ColorBatch.cpp for SSE2 / NEON,
+        ColorBatchAvx2.cpp for AVX2). As with RectKernels, every kernel
+        handles whole blocks only and returns how many colors it processed;
+        the caller finishes the tail with the scalar functions in Color.h.
+    */
+    struct ColorKernels
+    {
+        std::size_t (*pack)(const Color* in, std::size_t count, Color32* out);
+        std::size_t (*unpack)(const Color32* in, std::size_t count, Color* out);
+        std::size_t (*lerp)(const Color32* a, const Color32* b, std::size_t count, unsigned weight, Color32* out);
+        std::size_t (*premultiply)(Color32* colors, std::size_t count);
+        std::size_t (*modulate)(Color32* colors, std::size_t count, Color32 tint);
+        std::size_t (*blend)(const Color32* src, Color32* dst, std::size_t count);
+    };
+
+#ifdef BLAZE2D_HAVE_AVX2
+    extern const ColorKernels avx2_color_kernels;
+#endif
+
+    // Scalar rounding shared by Color.cpp and the tail loops (defined in Color.cpp).
+    uint8_t unit_to_byte(float v);          // clamp to [0, 1], round(v * 255), NaN -> 0
+    uint8_t div255(unsigned x);             // round(x / 255) for x <= 255 * 255
+
+    /* =========================
+       Integer block loops
+       =========================
+
+        Colors are widened to one 16-bit lane per channel, so products of
+        two bytes fit, then divided by 255 with rounding using
+        (t + (t >> 8)) >> 8 where t = x + 128, which is exact for every
+        product of two bytes and matches div255.
+
+        An Isa provides:
+          V, W                  byte vector and 16-bit vector types
+          width                 colors per V
+          load, store           unaligned V access
+          widen_lo, widen_hi    zero-extend the low / high half of V to W
+          narrow(lo, hi)        pack two W back into V (values are <= 255)
+          splat16, splat64      broadcast a 16-bit lane, or a 64-bit pattern
+                                (one widened color, r in the low lane)
+          add16, sub16, mul16   wrapping 16-bit ops
+          srl8                  logical shift right by 8
+          and_, or_             bitwise ops on W
+          alpha16(w)            every lane of a color set to its alpha lane
+          adds8                 saturating byte add on V
+    */
+
+    template <typename Isa>
+    typename Isa::W div255_lanes(typename Isa::W x)
+    {
+        const auto t = Isa::add16(x, Isa::splat16(128));
+        return Isa::srl8(Isa::add16(t, Isa::srl8(t)));
+    }
+
+    // div255(a * (255 - w) + b * w)
+    template <typename Isa>
+    std::size_t lerp_blocks(const Color32* a, const Color32* b, std::size_t count, unsigned weight, Color32* out)
+    {
+        const auto wb = Isa::splat16(static_cast<uint16_t>(weight));
+        const auto wa = Isa::splat16(static_cast<uint16_t>(255 - weight));
+
+        std::size_t i = 0;
+        for (; i + Isa::width <= count; i += Isa::width) {
+            const auto va = Isa::load(a + i);
+            const auto vb = Isa::load(b + i);
+            const auto lo = Isa::add16(Isa::mul16(Isa::widen_lo(va), wa), Isa::mul16(Isa::widen_lo(vb), wb));
+            const auto hi = Isa::add16(Isa::mul16(Isa::widen_hi(va), wa), Isa::mul16(Isa::widen_hi(vb), wb));
+            Isa::store(out + i, Isa::narrow(div255_lanes<Isa>(lo), div255_lanes<Isa>(hi)));
+        }
+        return i;
+    }
+
+    // rgb = div255(rgb * a); the alpha lane is multiplied by 255, which leaves it unchanged.
+    template <typename Isa>
+    std::size_t premultiply_blocks(Color32* colors, std::size_t count)
+    {
+        const auto rgb = Isa::splat64(0x0000FFFFFFFFFFFFull);
+        const auto opaque = Isa::splat64(0x00FF000000000000ull);
+
+        std::size_t i = 0;
+        for (; i + Isa::width <= count; i += Isa::width) {
+            const auto v = Isa::load(colors + i);
+            const auto lo = Isa::widen_lo(v);
+            const auto hi = Isa::widen_hi(v);
+            const auto mlo = Isa::or_(Isa::and_(Isa::alpha16(lo), rgb), opaque);
+            const auto mhi = Isa::or_(Isa::and_(Isa::alpha16(hi), rgb), opaque);
+            Isa::store(colors + i, Isa::narrow(
+                div255_lanes<Isa>(Isa::mul16(lo, mlo)),
+                div255_lanes<Isa>(Isa::mul16(hi, mhi))));
+        }
+        return i;
+    }
+
+    // div255(c * tint) per channel
+    template <typename Isa>
+    std::size_t modulate_blocks(Color32* colors, std::size_t count, Color32 tint)
+    {
+        const auto t = Isa::splat64(
+            uint64_t(tint.r) | (uint64_t(tint.g) << 16) | (uint64_t(tint.b) << 32) | (uint64_t(tint.a) << 48));
+
+        std::size_t i = 0;
+        for (; i + Isa::width <= count; i += Isa::width) {
+            const auto v = Isa::load(colors + i);
+            Isa::store(colors + i, Isa::narrow(
+                div255_lanes<Isa>(Isa::mul16(Isa::widen_lo(v), t)),
+                div255_lanes<Isa>(Isa::mul16(Isa::widen_hi(v), t))));
+        }
+        return i;
+    }
+
+    // min(255, src + div255(dst * (255 - src.a))) per channel
+    template <typename Isa>
+    std::size_t blend_blocks(const Color32* src, Color32* dst, std::size_t count)
+    {
+        const auto full = Isa::splat16(255);
+
+        std::size_t i = 0;
+        for (; i + Isa::width <= count; i += Isa::width) {
+            const auto s = Isa::load(src + i);
+            const auto d = Isa::load(dst + i);
+            const auto invLo = Isa::sub16(full, Isa::alpha16(Isa::widen_lo(s)));
+            const auto invHi = Isa::sub16(full, Isa::alpha16(Isa::widen_hi(s)));
+            const auto scaled = Isa::narrow(
+                div255_lanes<Isa>(Isa::mul16(Isa::widen_lo(d), invLo)),
+                div255_lanes<Isa>(Isa::mul16(Isa::widen_hi(d), invHi)));
+            Isa::store(dst + i, Isa::adds8(s, scaled));
+        }
+        return i;
+    }
+
+} // namespace blaze::detail
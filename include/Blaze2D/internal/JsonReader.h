@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace blaze::detail {
+
+    /**
+    * @brief Pull-style streaming JSON tokenizer.
+    *
+    * Walks the input once without building a document tree. Strings without
+    * escape sequences are returned as views into the input; escaped strings
+    * are decoded into an internal buffer that is reused by the next token.
+    *
+    * Structure (matching brackets, keys inside objects, commas and colons)
+    * is validated as tokens are read.
+    *
+    * @throws std::runtime_error on malformed input, reporting the byte offset.
+    */
+    class JsonReader {
+    public:
+        enum class Token {
+            BeginObject,
+            EndObject,
+            BeginArray,
+            EndArray,
+            Key,
+            String,
+            Number,
+            True,
+            False,
+            Null,
+            End
+        };
+
+        explicit JsonReader(std::string_view text) : text(text) {}
+
+        Token next();
+
+        // Contents of the last Key or String token.
+        std::string_view string() const { return str; }
+
+        // Value of the last Number token.
+        double number() const { return num; }
+
+        // Skips the value that starts at the next token, including nested containers.
+        void skipValue();
+
+        // Reads the next token and throws unless it is 'expected'.
+        void expect(Token expected);
+
+        // Reads the next token as a number and throws if it is anything else.
+        double expectNumber();
+
+    private:
+        enum class State : unsigned char {
+            Start,      // After '{' or '['
+            AfterKey,   // Object only: expecting ':' and a value
+            AfterValue, // Expecting ',' or the closing bracket
+        };
+
+        struct Scope {
+            bool object;
+            State state;
+        };
+
+        [[noreturn]] void fail(const char* what) const;
+
+        void skipWhitespace();
+        char peek();
+        Token readValue();
+        Token readKey();
+        Token close(bool object);
+        std::string_view readString();
+        double readNumber();
+        void readLiteral(std::string_view literal);
+
+        std::string_view text;
+        std::size_t pos = 0;
+
+        std::string_view str;
+        std::string scratch;
+        double num = 0.0;
+
+        std::vector<Scope> stack; // Open containers
+        bool done = false;        // The top-level value is complete
+    };
+
+} // namespace blaze::detail
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <string_view>
+
+/*
+    On-disk layout of a compiled manifest (see blaze-manifest-compile).
+
+    All integers are little-endian; all offsets are in bytes from the start
+    of the file. Sections are laid out in this order and are 4-byte aligned:
+
+        Header
+        TypeEntry  [type_count]   contiguous asset range per type
+        StringRef  [key_count]    unique flag keys
+        AssetEntry [asset_count]  grouped by type, manifest order within a type
+        FlagEntry  [flag_count]
+        int32_t    [hash_bucket_count]  perfect hash displacements (optional)
+        uint32_t   [asset_count]        perfect hash slots (present with displacements)
+        char       [strings_size] string table (not NUL terminated)
+
+    The perfect hash section is absent when hash_bucket_count is 0; the loader
+    then builds the hash itself. See detail::PerfectHashView.
+*/
+
+namespace blaze::detail::manifest_format {
+
+    static_assert(std::endian::native == std::endian::little,
+        "Compiled manifests are only supported on little-endian targets");
+
+    // Contains NUL and SUB bytes so it can never start a text manifest.
+    inline constexpr std::string_view magic{ "BLZMAN\0\x1A", 8 };
+    inline constexpr uint32_t version = 2;
+
+    struct StringRef {
+        uint32_t offset;
+        uint32_t length;
+    };
+
+    struct Header {
+        char magic[8];
+        uint32_t version;
+
+        uint32_t asset_count;
+        uint32_t flag_count;
+        uint32_t type_count;
+        uint32_t key_count;
+
+        uint32_t types_offset;
+        uint32_t keys_offset;
+        uint32_t assets_offset;
+        uint32_t flags_offset;
+        uint32_t strings_offset;
+        uint32_t strings_size;
+
+        uint32_t hash_seed;
+        uint32_t hash_bucket_count;
+        uint32_t hash_displacements_offset;
+        uint32_t hash_slots_offset;
+
+        uint32_t reserved;
+    };
+
+    struct TypeEntry {
+        StringRef name;
+        uint32_t first_asset;
+        uint32_t asset_count;
+    };
+
+    struct AssetEntry {
+        StringRef name;
+        StringRef path;
+        uint32_t type; // Index into the type table
+        uint32_t first_flag;
+        uint32_t flag_count;
+        uint32_t reserved;
+    };
+
+    struct FlagEntry {
+        uint32_t key; // Index into the key table
+        StringRef value;
+    };
+
+    static_assert(sizeof(Header) == 72);
+    static_assert(sizeof(TypeEntry) == 16);
+    static_assert(sizeof(AssetEntry) == 32);
+    static_assert(sizeof(FlagEntry) == 12);
+
+} // namespace blaze::detail::manifest_format
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <string_view>
+
+namespace blaze::detail {
+
+    /**
+    * @brief Read-only memory mapping of a whole file.
+    *
+    * The mapping stays valid for the lifetime of the object, so string_views
+    * into view() may be handed out freely as long as the MappedFile outlives them.
+    * Empty files are represented by an empty view without an actual mapping.
+    *
+    * @throws std::runtime_error if the file cannot be opened or mapped.
+    */
+    class MappedFile {
+    public:
+        MappedFile() = default;
+        explicit MappedFile(const std::filesystem::path& path);
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        /**
+        * @brief Reads the whole file into memory instead of mapping it.
+        * For files that may be rewritten in place while in use (hot reload):
+        * a mapping would change under its readers, or fault once the file
+        * shrinks, and on Windows it keeps other programs from writing it.
+        * @throws std::runtime_error if the file cannot be read.
+        */
+        static MappedFile read(const std::filesystem::path& path);
+
+        const char* data() const { return ptr; }
+        std::size_t size() const { return length; }
+        std::string_view view() const { return { ptr, length }; }
+
+    private:
+        void release();
+
+        const char* ptr = nullptr;
+        std::size_t length = 0;
+        std::unique_ptr<char[]> buffer; // Set instead of a mapping by read()
+
+#ifdef _WIN32
+        void* file_handle = nullptr;
+        void* mapping_handle = nullptr;
+#endif
+    };
+
+} // namespace blaze::detail
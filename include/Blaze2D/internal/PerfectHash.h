@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstdint>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+namespace blaze::detail {
+
+    /*
+        Minimal perfect hash over a fixed set of names ("hash and displace").
+
+        Every key hashes once with a 64-bit seeded hash. The hash picks a bucket;
+        the bucket's displacement either names the slot directly (single-key
+        buckets, stored as -slot - 1) or is mixed into the hash to pick a slot.
+        Lookups therefore cost one string hash and two array reads. Keys that
+        are not in the set map to an arbitrary slot, so callers must compare
+        the stored key.
+    */
+
+    uint64_t hash_name(std::string_view key, uint64_t seed);
+
+    inline uint64_t mix_hash(uint64_t h)
+    {
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+    // Maps a 64-bit hash onto [0, n) with a multiply instead of a division.
+    inline uint64_t reduce_hash(uint64_t h, uint64_t n)
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        return __umulh(h, n);
+#else
+        return static_cast<uint64_t>((static_cast<unsigned __int128>(h) * n) >> 64);
+#endif
+    }
+
+    struct PerfectHashView {
+        uint64_t seed = 0;
+        std::span<const int32_t> displacements; // One per bucket
+        std::span<const uint32_t> slots;        // Key index per slot
+
+        bool empty() const { return slots.empty(); }
+
+        // Index of the only key that may equal 'key'. Requires !empty().
+        uint32_t candidate(std::string_view key) const
+        {
+            uint64_t h = hash_name(key, seed);
+            int32_t d = displacements[reduce_hash(h, displacements.size())];
+            uint64_t slot = d < 0
+                ? uint64_t(-int64_t(d) - 1)
+                : reduce_hash(mix_hash(h ^ (uint64_t(d) * 0x9e3779b97f4a7c15ULL)), slots.size());
+            return slots[slot];
+        }
+    };
+
+    struct PerfectHash {
+        uint64_t seed = 0;
+        std::vector<int32_t> displacements;
+        std::vector<uint32_t> slots;
+
+        PerfectHashView view() const { return { seed, displacements, slots }; }
+    };
+
+    // Thrown by build_perfect_hash when the key set contains the same key twice.
+    struct DuplicateKeyError : std::runtime_error {
+        DuplicateKeyError(uint32_t first, uint32_t second)
+            : std::runtime_error("Duplicate key in perfect hash"), first(first), second(second) {}
+
+        uint32_t first;
+        uint32_t second;
+    };
+
+    /**
+    * @brief Build a minimal perfect hash for 'keys'; slot values are indices into 'keys'.
+    * @throws DuplicateKeyError if two keys are equal
+    */
+    PerfectHash build_perfect_hash(std::span<const std::string_view> keys);
+
+} // namespace blaze::detail
@@ -0,0 +1,167 @@
+#pragma once
+
+#include "Blaze2D/util/Rect.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace blaze::detail {
+
+    /*
+        Block loops behind blaze::batch, shared by the per-ISA translation
+        units (RectBatch.cpp for SSE2 / NEON, RectBatchAvx2.cpp for AVX2).
+
+        Every kernel handles whole blocks only and returns how many elements
+        it processed; the caller finishes the tail with the scalar Rect
+        methods. Kernels read Rect / Vec2 fields directly instead of calling
+        their inline members, so no copy of a shared inline function built
+        for a wider ISA can be picked by the linker for baseline code.
+    */
+    struct RectKernels
+    {
+        std::size_t (*intersects)(const Rect* rects, std::size_t count, const Rect& area, uint8_t* out, std::size_t& hits);
+        std::size_t (*containsRect)(const Rect* rects, std::size_t count, const Rect& inner, uint8_t* out, std::size_t& hits);
+        std::size_t (*containsPoint)(const Rect* rects, std::size_t count, const Vec2& point, uint8_t* out, std::size_t& hits);
+        std::size_t (*pointsInRect)(const Rect& rect, const Vec2* points, std::size_t count, uint8_t* out, std::size_t& hits);
+        std::size_t (*intersection)(const Rect* rects, std::size_t count, const Rect& clip, Rect* out);
+        std::size_t (*united)(const Rect* rects, std::size_t count, const Rect& other, Rect* out);
+        std::size_t (*translateRects)(Rect* rects, std::size_t count, const Vec2& delta);
+        std::size_t (*translatePoints)(Vec2* points, std::size_t count, const Vec2& delta);
+    };
+
+#ifdef BLAZE2D_HAVE_AVX2
+    extern const RectKernels avx2_rect_kernels;
+#endif
+
+    /* =========================
+       Predicate loops
+       =========================
+
+        An Isa provides:
+          F, M                    float vector and comparison mask types
+          width, all              lane count and a mask with every lane set
+          splat, add              float ops
+          ge, le, lt              ordered comparisons (false on NaN, like
+                                  the scalar operators)
+          and_, or_               mask ops
+          bits(M)                 lane mask as an integer, lane 0 in bit 0
+          load_rects(p, x,y,w,h)  'width' rects transposed into lanes
+          load_points(p, x,y)     'width' points transposed into lanes
+    */
+
+    struct MaskTables
+    {
+        uint64_t bytes[256];  // Bit i of the index -> byte i set to 1
+        uint8_t counts[256];
+
+        constexpr MaskTables() : bytes(), counts()
+        {
+            for (unsigned m = 0; m < 256; ++m) {
+                for (unsigned b = 0; b < 8; ++b) {
+                    if (m & (1u << b)) {
+                        bytes[m] |= uint64_t(1) << (8 * b);
+                        ++counts[m];
+                    }
+                }
+            }
+        }
+    };
+
+    inline constexpr MaskTables mask_tables{};
+
+    template <typename Isa>
+    std::size_t store_mask(uint8_t* out, unsigned bits)
+    {
+        // Little-endian: byte i of the table entry is lane i.
+        std::memcpy(out, &mask_tables.bytes[bits], Isa::width);
+        return mask_tables.counts[bits];
+    }
+
+    // rects[i].intersects(area)
+    template <typename Isa>
+    std::size_t intersects_blocks(const Rect* rects, std::size_t count, const Rect& area, uint8_t* out, std::size_t& hits)
+    {
+        const auto left = Isa::splat(area.x);
+        const auto right = Isa::splat(area.x + area.w);
+        const auto top = Isa::splat(area.y);
+        const auto bottom = Isa::splat(area.y + area.h);
+
+        std::size_t i = 0;
+        for (; i + Isa::width <= count; i += Isa::width) {
+            typename Isa::F x, y, w, h;
+            Isa::load_rects(rects + i, x, y, w, h);
+
+            const auto miss = Isa::or_(
+                Isa::or_(Isa::ge(left, Isa::add(x, w)), Isa::le(right, x)),
+                Isa::or_(Isa::ge(top, Isa::add(y, h)), Isa::le(bottom, y)));
+            hits += store_mask<Isa>(out + i, ~Isa::bits(miss) & Isa::all);
+        }
+        return i;
+    }
+
+    // rects[i].contains(inner)
+    template <typename Isa>
+    std::size_t contains_rect_blocks(const Rect* rects, std::size_t count, const Rect& inner, uint8_t* out, std::size_t& hits)
+    {
+        const auto left = Isa::splat(inner.x);
+        const auto right = Isa::splat(inner.x + inner.w);
+        const auto top = Isa::splat(inner.y);
+        const auto bottom = Isa::splat(inner.y + inner.h);
+
+        std::size_t i = 0;
+        for (; i + Isa::width <= count; i += Isa::width) {
+            typename Isa::F x, y, w, h;
+            Isa::load_rects(rects + i, x, y, w, h);
+
+            const auto inside = Isa::and_(
+                Isa::and_(Isa::ge(left, x), Isa::le(right, Isa::add(x, w))),
+                Isa::and_(Isa::ge(top, y), Isa::le(bottom, Isa::add(y, h))));
+            hits += store_mask<Isa>(out + i, Isa::bits(inside));
+        }
+        return i;
+    }
+
+    // rects[i].contains(point)
+    template <typename Isa>
+    std::size_t contains_point_blocks(const Rect* rects, std::size_t count, const Vec2& point, uint8_t* out, std::size_t& hits)
+    {
+        const auto px = Isa::splat(point.x);
+        const auto py = Isa::splat(point.y);
+
+        std::size_t i = 0;
+        for (; i + Isa::width <= count; i += Isa::width) {
+            typename Isa::F x, y, w, h;
+            Isa::load_rects(rects + i, x, y, w, h);
+
+            const auto inside = Isa::and_(
+                Isa::and_(Isa::ge(px, x), Isa::lt(px, Isa::add(x, w))),
+                Isa::and_(Isa::ge(py, y), Isa::lt(py, Isa::add(y, h))));
+            hits += store_mask<Isa>(out + i, Isa::bits(inside));
+        }
+        return i;
+    }
+
+    // rect.contains(points[i])
+    template <typename Isa>
+    std::size_t points_in_rect_blocks(const Rect& rect, const Vec2* points, std::size_t count, uint8_t* out, std::size_t& hits)
+    {
+        const auto left = Isa::splat(rect.x);
+        const auto right = Isa::splat(rect.x + rect.w);
+        const auto top = Isa::splat(rect.y);
+        const auto bottom = Isa::splat(rect.y + rect.h);
+
+        std::size_t i = 0;
+        for (; i + Isa::width <= count; i += Isa::width) {
+            typename Isa::F x, y;
+            Isa::load_points(points + i, x, y);
+
+            const auto inside = Isa::and_(
+                Isa::and_(Isa::ge(x, left), Isa::lt(x, right)),
+                Isa::and_(Isa::ge(y, top), Isa::lt(y, bottom)));
+            hits += store_mask<Isa>(out + i, Isa::bits(inside));
+        }
+        return i;
+    }
+
+} // namespace blaze::detail
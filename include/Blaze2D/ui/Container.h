@@ -1,9 +1,19 @@
+#pragma once
 
-class Window;
+#include <functional>
+#include <span>
+#include <vector>
 
-namespace blaze 
+#include "Blaze2D/ui/ContainerStore.h"
+#include "Blaze2D/util/Rect.h"
+
+union SDL_Event;
+
+namespace blaze
 {
-	enum Anchor 
+	class Window;
+
+	enum Anchor
 	{
 		TOP_LEFT,
 		TOP_CENTER,
@@ -14,29 +24,174 @@ namespace blaze
 		BOTTOM_LEFT,
 		BOTTOM_CENTER,
 		BOTTOM_RIGHT,
-		OVERRIDE
+		OVERRIDE // Placed exactly at its rect; not moved by layout and outside any flow
+	};
+
+	/**
+	* @brief How a container arranges its children.
+	* None places each child by its anchor; Row and Column place children one
+	* after another along the main axis (children with OVERRIDE excepted).
+	*/
+	enum class LayoutDirection
+	{
+		None,
+		Row,
+		Column
 	};
 
+	/**
+	* @brief Phase in which a container sees an event.
+	* Capture runs root -> target, Target on the target itself, Bubble target -> root.
+	*/
+	enum class EventPhase
+	{
+		Capture,
+		Target,
+		Bubble
+	};
+
+	enum class EventResult
+	{
+		Ignored,
+		Consumed // Stops propagation; the event is not returned by App::get_input()
+	};
+
+	/**
+	* @brief Handle to one entry of its window's ContainerStore.
+	*
+	* The object itself only holds the entry id and the event handler; layout
+	* data lives in the store's arrays. Containers must be destroyed before
+	* their window.
+	*/
+	class Container;
+	using ContainerHandle = Handle<Container>;
+
 	class Container
 	{
 	public:
+		using EventHandler = std::function<EventResult(Container&, const SDL_Event&, EventPhase)>;
+
+		// Child of the window's root container, placed by layout.
+		explicit Container(Window& _parent_window);
+		explicit Container(Container& _parent_container);
+
+		// Child placed at 'rect' (relative to the parent) with the OVERRIDE anchor.
+		Container(Window& _parent_window, const Rect& _rect);
+		Container(Container& _parent_container, const Rect& _rect);
+		~Container();
+
+		Container(const Container&) = delete;
+		Container& operator=(const Container&) = delete;
+
+		/* =========================
+		   Layout
+		   ========================= */
+
+		// Rect relative to the parent, as of the last layout().
+		const Rect& getRect() const { return store->rect(id); }
+
+		// Places the container explicitly and switches it to the OVERRIDE anchor.
+		void setRect(const Rect& _rect);
+
+		// Rect in window coordinates, as of the last layout().
+		const Rect& getWindowRect() const { return store->windowRect(id); }
+
+		Anchor getAnchor() const { return static_cast<Anchor>(store->anchor(id)); }
+		void setAnchor(Anchor _anchor);
 
-		//Container(Container& _parent_container);
-		//Container(Window& _parent_window);
+		// Preferred size. A zero component fills the parent's content area on that axis.
+		const Vec2& getSize() const { return store->size(id); }
+		void setSize(const Vec2& _size);
+
+		// Offset from the anchor point, pointing into the parent.
+		const Vec2& getOffset() const { return store->offset(id); }
+		void setOffset(const Vec2& _offset);
+
+		// Share of the free main-axis space in a Row/Column parent.
+		float getGrow() const { return store->grow(id); }
+		void setGrow(float _grow);
+
+		LayoutDirection getDirection() const { return static_cast<LayoutDirection>(store->direction(id)); }
+		void setDirection(LayoutDirection _direction);
+
+		// Inset of the content area on all sides.
+		float getPadding() const { return store->padding(id); }
+		void setPadding(float _padding);
+
+		// Space between consecutive children of a Row/Column.
+		float getGap() const { return store->gap(id); }
+		void setGap(float _gap);
+
+		bool needsLayout() const { return (store->flags(id) & (ContainerStore::CHILDREN_DIRTY | ContainerStore::SUBTREE_DIRTY)) != 0; }
+
+		/**
+		* @brief Brings the rects of this subtree up to date.
+		*
+		* Only dirty parts are visited: a container re-arranges its children
+		* when its own size changed or one of their layout properties did, and
+		* descends into children that are dirty themselves or changed size.
+		* Moving a container only shifts the window rects of its descendants.
+		*
+		* @return the number of child rects that were recomputed
+		*/
+		std::size_t layout() { return store->layout(id); }
+
+		bool isVisible() const { return (store->flags(id) & ContainerStore::VISIBLE) != 0; }
+		void setVisible(bool _visible);
+
+		// Marks the container's window rect for repainting (see Window::setDirtyTracking()).
+		void invalidate();
+
+		// nullptr for the root and for containers whose parent was destroyed.
+		Container* getParent() const { return store->parent(id); }
+		Window& getWindow() const { return *parent_window; }
+
+		// Stays valid to look up (Window::getContainer()) and turns stale when the container is destroyed.
+		ContainerHandle getHandle() const { return store->handle(id); }
+
+		// Children in order; iterate with a range-for.
+		ContainerStore::ChildRange getChildren() const { return store->children(id); }
+
+		void onEvent(EventHandler handler) { event_handler = std::move(handler); }
+
+		// Runs the event handler, if any.
+		EventResult handleEvent(const SDL_Event& event, EventPhase phase);
+
+		// Keyboard and text events target the focused container of a window.
+		void focus();
+		bool hasFocus() const;
+
+		// While captured, pointer events target this container regardless of position.
+		// Capture ends on releasePointer() or when a mouse button is released.
+		void capturePointer();
+		void releasePointer();
+		bool hasPointerCapture() const;
+
+		/**
+		* @brief Deepest visible container under 'point' (window coordinates).
+		* Later children are on top. Returns nullptr if the point is outside this container.
+		*/
+		Container* hitTest(const Vec2& point) const { return store->hitTest(id, point); }
+
+		// Appends this container and its visible descendants whose window rects intersect 'area'.
+		void cull(const Rect& area, std::vector<Container*>& out) const { store->cull(id, area, out); }
 
 	private:
-		int x;
-		int y;
-		int w;
-		int h;
-		
-		Anchor anchor = Anchor::CENTER;
+		friend class Window;
+
+		// Root container of a window.
+		Container(Window& _window, const Rect& _rect, std::nullptr_t);
+
+		void attach(Container& _parent_container);
+
+		ContainerStore* store = nullptr;
+		uint32_t id = ContainerStore::npos;
+		Window* parent_window = nullptr;
 
-		Container* parent_container;
-		Window* parent_window;
+		EventHandler event_handler;
 
 	}; // class container
 
 
 
-} // namespace blaze
\ No newline at end of file
+} // namespace blaze
@@ -0,0 +1,173 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Blaze2D/util/Rect.h"
+#include "Blaze2D/util/SlotMap.h"
+
+namespace blaze
+{
+	class Container;
+
+	/**
+	* @brief Structure-of-arrays storage for the containers of one window.
+	*
+	* Per-container layout data lives in parallel arrays kept in depth-first
+	* (pre-order) order, each entry knowing the end of its subtree. A subtree is
+	* therefore a contiguous index range: layout, hit testing and culling are
+	* forward scans that skip whole ranges instead of following pointers.
+	*
+	* Containers refer to their entry by a stable id. New entries are appended;
+	* when that is the end of the parent's subtree (the usual case when a tree
+	* is built parent-first) the order stays valid, otherwise it is marked stale
+	* and the arrays are re-sorted into depth-first order (O(n)) before the next
+	* traversal. Destroyed entries are left as holes that traversals skip and
+	* are compacted by the same re-sort. Children of a destroyed container are
+	* detached and ignored.
+	*
+	* Ids are reused after destruction; each carries a generation that
+	* destroy() bumps, so handle() / get() tell a live container from one
+	* that has since been destroyed.
+	*/
+	class ContainerStore
+	{
+	public:
+		static constexpr uint32_t npos = UINT32_MAX;
+
+		enum Flags : uint8_t
+		{
+			VISIBLE        = 1 << 0,
+			CHILDREN_DIRTY = 1 << 1, // Children need to be re-arranged
+			SUBTREE_DIRTY  = 1 << 2, // Some descendant needs layout
+			RESIZED        = 1 << 3, // Size changed during the current pass
+			MOVED          = 1 << 4, // Window rect changed during the current pass
+			DEAD           = 1 << 5
+		};
+
+		ContainerStore() = default;
+
+		ContainerStore(const ContainerStore&) = delete;
+		ContainerStore& operator=(const ContainerStore&) = delete;
+
+		// Adds an entry under 'parentId' (npos for a root) and returns its id.
+		uint32_t create(Container* owner, uint32_t parentId);
+		void destroy(uint32_t id);
+
+		std::size_t size() const { return live; }
+
+		// Generational handle for a live entry.
+		Handle<Container> handle(uint32_t id) const { return { id, generations[id] }; }
+
+		// Owner of the entry 'handle' refers to, or nullptr once it was destroyed.
+		Container* get(Handle<Container> handle) const
+		{
+			if (handle.index >= owners.size() || generations[handle.index] != handle.generation)
+				return nullptr;
+			return owners[handle.index];
+		}
+
+		/* =========================
+		   Per-entry data, by id
+		   ========================= */
+
+		Rect& rect(uint32_t id) { return rects[index_of[id]]; }
+		const Rect& windowRect(uint32_t id) const { return world[index_of[id]]; }
+		Vec2& size(uint32_t id) { return sizes[index_of[id]]; }
+		Vec2& offset(uint32_t id) { return offsets[index_of[id]]; }
+		float& grow(uint32_t id) { return grows[index_of[id]]; }
+		float& padding(uint32_t id) { return paddings[index_of[id]]; }
+		float& gap(uint32_t id) { return gaps[index_of[id]]; }
+		uint8_t& anchor(uint32_t id) { return anchors[index_of[id]]; }
+		uint8_t& direction(uint32_t id) { return directions[index_of[id]]; }
+		uint8_t& flags(uint32_t id) { return flag_bits[index_of[id]]; }
+
+		Container* owner(uint32_t id) const { return owners[id]; }
+
+		// Owner of the parent entry, or nullptr for roots and detached entries.
+		Container* parent(uint32_t id) const;
+
+		/* =========================
+		   Dirty tracking
+		   ========================= */
+
+		// The entry's placement changed; its parent must re-arrange.
+		void markPlacementDirty(uint32_t id);
+		// The entry's children must be re-arranged.
+		void markChildrenDirty(uint32_t id);
+
+		/* =========================
+		   Traversals (bring the order up to date first)
+		   ========================= */
+
+		class ChildIterator
+		{
+		public:
+			Container* operator*() const;
+			ChildIterator& operator++();
+			bool operator==(const ChildIterator& other) const { return index == other.index; }
+
+		private:
+			friend class ContainerStore;
+			ChildIterator(const ContainerStore* store, uint32_t index, uint32_t limit);
+			void skipDead();
+
+			const ContainerStore* store;
+			uint32_t index;
+			uint32_t limit; // End of the parent's subtree
+		};
+
+		struct ChildRange
+		{
+			ChildIterator first;
+			ChildIterator last;
+			ChildIterator begin() const { return first; }
+			ChildIterator end() const { return last; }
+		};
+
+		ChildRange children(uint32_t id);
+
+		// @see Container::layout()
+		std::size_t layout(uint32_t id);
+
+		// Deepest visible entry in the subtree of 'id' containing 'point' (window coordinates).
+		Container* hitTest(uint32_t id, const Vec2& point);
+
+		// Appends the visible entries of the subtree of 'id' whose window rects intersect 'area'.
+		void cull(uint32_t id, const Rect& area, std::vector<Container*>& out);
+
+	private:
+		void ensureOrdered();
+		void rebuild();
+		std::size_t arrange(uint32_t index);
+
+		void markChildrenDirtyAt(uint32_t index);
+
+		// Hot data, indexed by depth-first position.
+		std::vector<Rect> rects;      // Relative to the parent
+		std::vector<Rect> world;      // Window coordinates
+		std::vector<Vec2> sizes;
+		std::vector<Vec2> offsets;
+		std::vector<float> grows;
+		std::vector<float> paddings;
+		std::vector<float> gaps;
+		std::vector<uint8_t> anchors;
+		std::vector<uint8_t> directions;
+		std::vector<uint8_t> flag_bits;
+		std::vector<uint32_t> parents;      // Index of the parent, or npos
+		std::vector<uint32_t> subtree_ends; // One past the last descendant
+		std::vector<uint32_t> id_of;
+
+		// Cold data, indexed by id.
+		std::vector<uint32_t> index_of;
+		std::vector<Container*> owners;
+		std::vector<uint32_t> generations;
+		std::vector<uint32_t> free_ids;
+
+		std::size_t live = 0;
+		std::size_t dead = 0;
+		bool order_dirty = false;
+	};
+
+} // namespace blaze
@@ -15,7 +15,62 @@ namespace blaze
         Color(float rf, float gf, float bf, float af = 1.f);
     };
 
-    inline void set_render_draw_color(SDL_Renderer* renderer, const Color& c);
+    /**
+    * @brief Packed 8-bit RGBA color, four bytes in r, g, b, a order.
+    *
+    * A quarter of the size of Color; meant for storing many colors at once
+    * (particles, gradients, vertex tints). See ColorBatch.h for span kernels.
+    */
+    struct Color32
+    {
+        uint8_t r, g, b, a;
+
+        constexpr Color32() : r(0), g(0), b(0), a(0) {} // Transparent black
+        constexpr Color32(uint8_t r8, uint8_t g8, uint8_t b8, uint8_t a8 = 255) : r(r8), g(g8), b(b8), a(a8) {}
+
+        bool operator==(const Color32&) const = default;
+    };
+
+    static_assert(sizeof(Color32) == 4, "Color32 must stay packed");
+
+    void set_render_draw_color(SDL_Renderer* renderer, const Color& c);
+
+    Color lerp(const Color& a, const Color& b, float t);
+
+    /* =========================
+       Conversions
+       ========================= */
+
+    // Clamps each channel to [0, 1] and rounds to the nearest byte (ties to even). NaN becomes 0.
+    Color32 to_color32(const Color& c);
+
+    // Exact: channel / 255, the same as Color(r8, g8, b8, a8).
+    Color to_color(Color32 c);
+
+    // sRGB transfer function (IEC 61966-2-1) for one channel in [0, 1].
+    float srgb_to_linear(float v);
+    float linear_to_srgb(float v);
+
+    // Converts r, g and b; alpha is already linear and is left unchanged.
+    Color to_linear(const Color& c);
+    Color to_srgb(const Color& c);
+
+    /* =========================
+       Packed color math
+       =========================
+
+        All results are rounded to nearest, so x * 255 / 255 == x.
+    */
+
+    // 't' is clamped to [0, 1] and quantized to steps of 1/255.
+    Color32 lerp(Color32 a, Color32 b, float t);
+
+    // Multiplies r, g and b by alpha.
+    Color32 premultiply(Color32 c);
+
+    // Channel-wise product, e.g. a texture color tinted by a vertex color.
+    Color32 modulate(Color32 c, Color32 tint);
 
-    static Color lerp(const Color& a, const Color& b, float t);
+    // Premultiplied source-over: src + dst * (1 - src.a), saturating at 255.
+    Color32 blend(Color32 src, Color32 dst);
 }
@@ -0,0 +1,50 @@
+#pragma once
+#include "Blaze2D/util/Color.h"
+#include "Blaze2D/util/RectBatch.h"
+#include <cstddef>
+#include <span>
+
+/*
+    Batched color kernels for gradients, particle tinting and software
+    compositing over large spans of colors.
+
+    Each function applies the matching scalar function from Color.h to
+    every element and produces bit-identical results. Outputs must be at
+    least as long as the inputs; Color32 outputs may alias Color32 inputs.
+
+    The implementation follows blaze::batch::level() (see RectBatch.h):
+    AVX2 or SSE2 on x86-64, NEON on ARM64, plain loops elsewhere.
+*/
+
+namespace blaze::batch
+{
+    /* =========================
+       Conversions
+       ========================= */
+
+    // out[i] = to_color32(in[i])
+    void pack(std::span<const Color> in, std::span<Color32> out);
+
+    // out[i] = to_color(in[i])
+    void unpack(std::span<const Color32> in, std::span<Color> out);
+
+    // out[i] = to_linear(to_color(in[i])), through a 256-entry table
+    void toLinear(std::span<const Color32> in, std::span<Color> out);
+
+    /* =========================
+       Packed color math
+       ========================= */
+
+    // out[i] = lerp(a[i], b[i], t); 'b' must be at least as long as 'a'
+    void lerp(std::span<const Color32> a, std::span<const Color32> b, float t, std::span<Color32> out);
+
+    // colors[i] = premultiply(colors[i])
+    void premultiply(std::span<Color32> colors);
+
+    // colors[i] = modulate(colors[i], tint)
+    void modulate(std::span<Color32> colors, Color32 tint);
+
+    // dst[i] = blend(src[i], dst[i])
+    void blend(std::span<const Color32> src, std::span<Color32> dst);
+
+} // namespace blaze::batch
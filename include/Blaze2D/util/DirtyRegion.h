@@ -0,0 +1,59 @@
+#pragma once
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "Blaze2D/util/Rect.h"
+
+namespace blaze
+{
+	/**
+	* @brief Accumulates the parts of a surface that need repainting.
+	*
+	* Added rects are clipped to the bounds and kept pairwise disjoint:
+	* overlapping rects, and rects whose union wastes little area, are merged
+	* with Rect::united. When there are more than the maximum number of rects
+	* the pair whose union wastes the least area is merged, and once most of
+	* the surface is dirty the region collapses to the whole bounds. This
+	* keeps the number of clipped redraw passes small.
+	*/
+	class DirtyRegion
+	{
+	public:
+		static constexpr std::size_t default_max_rects = 8;
+
+		// Rects are merged if their union is at most this much larger than the two together.
+		static constexpr float merge_slack = 1.25f;
+
+		// Fraction of the bounds above which the whole surface is marked dirty.
+		static constexpr float full_threshold = 0.7f;
+
+		explicit DirtyRegion(const Rect& bounds = Rect(), std::size_t maxRects = default_max_rects);
+
+		// Changes the surface size; everything becomes dirty.
+		void setBounds(const Rect& bounds);
+		const Rect& getBounds() const { return bounds; }
+
+		void add(const Rect& rect);
+		void addAll();
+		void clear();
+
+		bool empty() const { return rects.empty(); }
+		bool isFull() const { return full; }
+
+		std::span<const Rect> getRects() const { return rects; }
+
+		// Total dirty area (the rects do not overlap).
+		float area() const;
+
+	private:
+		void fold(Rect rect);
+		void mergeCheapestPair();
+
+		Rect bounds;
+		std::size_t max_rects;
+		std::vector<Rect> rects;
+		bool full = false;
+	};
+
+} // namespace blaze
@@ -0,0 +1,85 @@
+#pragma once
+#include <chrono>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace blaze
+{
+	/**
+	* @brief Reports files that were rewritten since the last poll().
+	*
+	* On Linux the directories containing the watched files are watched with
+	* inotify, so poll() only reads the pending events and costs nothing when
+	* nothing changed. Elsewhere, and for files whose directory cannot be
+	* watched, modification times are compared, at most every poll_interval.
+	*
+	* A file counts as changed once its writer closes it or renames a new
+	* version over it, so half-written files are not reported on Linux.
+	*/
+	class FileWatcher
+	{
+	public:
+		static constexpr std::chrono::milliseconds poll_interval{ 500 };
+
+		FileWatcher();
+		~FileWatcher();
+
+		FileWatcher(const FileWatcher&) = delete;
+		FileWatcher& operator=(const FileWatcher&) = delete;
+
+		// Watches a file, which does not need to exist yet. Watching a file twice has no effect.
+		void watch(const std::filesystem::path& file);
+		void unwatch(const std::filesystem::path& file);
+
+		bool isWatching(const std::filesystem::path& file) const;
+		std::size_t getWatchCount() const { return files.size(); }
+
+		/**
+		* @brief Returns the watched files that changed since the last call,
+		* each once, as normalize()d paths. Never blocks.
+		* The span is valid until the next call.
+		*/
+		std::span<const std::filesystem::path> poll();
+
+		// True if changes are reported by the OS rather than found by polling.
+		bool isNative() const;
+
+		// Absolute, lexically normal form of a path, as returned by poll().
+		static std::filesystem::path normalize(const std::filesystem::path& file);
+
+	private:
+		struct File
+		{
+			std::filesystem::path path;
+			std::filesystem::file_time_type modified;
+			bool polled = true; // No native watch on its directory
+		};
+
+		void scan();
+		void report(const std::filesystem::path& file);
+
+		// By normalized path.
+		std::unordered_map<std::string, File> files;
+		std::vector<std::filesystem::path> changed;
+		std::chrono::steady_clock::time_point next_scan;
+		std::size_t polled_count = 0;
+
+#ifdef __linux__
+		struct Directory
+		{
+			int wd = -1;
+			std::filesystem::path path;
+			std::size_t files = 0;
+		};
+
+		void readEvents();
+
+		int inotify_fd = -1;
+		std::vector<Directory> directories;
+#endif
+	};
+
+} // namespace blaze
@@ -0,0 +1,66 @@
+#pragma once
+#include <cstdint>
+#include <stdexcept>
+
+namespace blaze
+{
+    /**
+    * @brief Accumulator for a fixed-timestep update loop.
+    *
+    * Real frame time is fed in with advance(), which returns how many fixed
+    * updates to run. The remainder is exposed as alpha() for interpolating
+    * rendering between the last two simulation states. At most maxSteps
+    * updates run per frame; time beyond that is discarded and counted, so a
+    * slow frame cannot cause an ever-growing backlog of updates.
+    */
+    class FixedTimestep {
+    public:
+        explicit FixedTimestep(double stepSeconds = 1.0 / 60.0, int maxSteps = 5)
+            : stepSeconds(stepSeconds), maxSteps(maxSteps) {
+            if (stepSeconds <= 0.0 || maxSteps < 1)
+                throw std::invalid_argument("FixedTimestep: step must be positive and maxSteps at least 1");
+        }
+
+        // Adds elapsed real time and returns the number of updates due.
+        int advance(double elapsedSeconds) {
+            if (elapsedSeconds > 0.0)
+                accumulator += elapsedSeconds;
+
+            int steps = 0;
+            while (accumulator >= stepSeconds && steps < maxSteps) {
+                accumulator -= stepSeconds;
+                ++steps;
+            }
+
+            // Spiral-of-death guard: drop whole steps we cannot catch up on.
+            if (accumulator >= stepSeconds) {
+                auto dropped = static_cast<uint64_t>(accumulator / stepSeconds);
+                droppedSteps += dropped;
+                accumulator -= static_cast<double>(dropped) * stepSeconds;
+            }
+
+            return steps;
+        }
+
+        void reset() {
+            accumulator = 0.0;
+            droppedSteps = 0;
+        }
+
+        double step() const { return stepSeconds; }
+        int getMaxSteps() const { return maxSteps; }
+
+        // Fraction of a step left in the accumulator, in [0, 1).
+        double alpha() const { return accumulator / stepSeconds; }
+
+        // Updates discarded because a frame fell more than maxSteps behind.
+        uint64_t getDroppedSteps() const { return droppedSteps; }
+
+    private:
+        double stepSeconds;
+        int maxSteps;
+        double accumulator = 0.0;
+        uint64_t droppedSteps = 0;
+    };
+
+} // namespace blaze
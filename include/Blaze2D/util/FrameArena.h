@@ -0,0 +1,122 @@
+#pragma once
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+namespace blaze
+{
+	/**
+	* @brief Bump allocator for memory that lives at most one frame.
+	*
+	* Allocation moves a pointer forward through a block; deallocation does
+	* nothing and the memory comes back all at once, either when a Scope
+	* ends or when reset() starts the next frame. When a frame needs more
+	* than the block holds, overflow blocks are taken from the upstream
+	* resource and reset() replaces them with a single block large enough
+	* for that frame, so frames of steady size stop allocating after the
+	* first one that needed the space. A grown block shrinks again once
+	* shrink_after frames in a row have used at most a quarter of it.
+	*
+	* As a std::pmr::memory_resource it backs std::pmr containers directly:
+	*
+	*     FrameArena::Scope scope(FrameArena::local());
+	*     std::pmr::vector<uint32_t> order(&scope.arena());
+	*
+	* An arena is not thread-safe; local() gives every thread its own.
+	*/
+	class FrameArena : public std::pmr::memory_resource
+	{
+	public:
+		static constexpr std::size_t default_capacity = 64 * 1024;
+		static constexpr std::size_t shrink_after = 300;
+
+		// The first block is allocated on first use, not here.
+		explicit FrameArena(std::size_t capacity = default_capacity,
+			std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+		~FrameArena() override;
+
+		FrameArena(const FrameArena&) = delete;
+		FrameArena& operator=(const FrameArena&) = delete;
+
+		/**
+		* @brief Rewinds the arena to its start on leaving, releasing everything
+		* allocated since it was entered. Scopes nest.
+		*/
+		class Scope
+		{
+		public:
+			explicit Scope(FrameArena& arena);
+			~Scope();
+
+			Scope(const Scope&) = delete;
+			Scope& operator=(const Scope&) = delete;
+
+			FrameArena& arena() const { return owner; }
+
+		private:
+			FrameArena& owner;
+			std::size_t block;
+			std::size_t offset;
+			std::size_t used;
+		};
+
+		/**
+		* @brief Ends the frame: records its peak and rewinds to empty.
+		* Everything allocated from the arena becomes invalid. Called by
+		* App::frame() for the main thread's arena and by the pipelined
+		* worker for its own.
+		*/
+		void reset();
+
+		// Bytes handed out and not yet rewound, including alignment padding.
+		std::size_t used() const { return used_bytes; }
+
+		// Size of the block(s) currently held.
+		std::size_t capacity() const;
+
+		// Highest used() of the frame in progress, and of the last frame reset() ended.
+		std::size_t getPeak() const { return peak_bytes; }
+		std::size_t getFramePeak() const { return frame_peak; }
+
+		// Highest frame peak since construction.
+		std::size_t getHighWater() const { return high_water; }
+
+		// Blocks taken from the upstream resource since construction.
+		std::size_t getUpstreamAllocations() const { return upstream_allocations; }
+
+		// The calling thread's arena, created on first use.
+		static FrameArena& local();
+
+	protected:
+		void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+		void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+		bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+	private:
+		struct Block
+		{
+			std::byte* data;
+			std::size_t size;
+		};
+
+		void addBlock(std::size_t minimum);
+		void release();
+
+		std::pmr::memory_resource* upstream;
+		std::size_t block_size;
+		std::size_t base_size;          // Capacity given to the constructor
+		std::size_t quiet_frames = 0;   // Consecutive frames far below block_size
+		std::size_t quiet_peak = 0;     // Highest peak among them
+
+		std::vector<Block> blocks;
+		std::size_t current = 0;  // Block being bumped through
+		std::size_t offset = 0;   // Within blocks[current]
+
+		std::size_t used_bytes = 0;
+		std::size_t peak_bytes = 0;
+		std::size_t frame_peak = 0;
+		std::size_t high_water = 0;
+		std::size_t upstream_allocations = 0;
+	};
+
+} // namespace blaze
@@ -1,36 +1,173 @@
 #pragma once
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <unordered_map>
-#include <fstream>
 #include <filesystem>
+#include <memory_resource>
 #include <span>
+#include <vector>
+
+#include "Blaze2D/internal/MappedFile.h"
+#include "Blaze2D/internal/PerfectHash.h"
 
 namespace blaze
 {
 
+	/**
+	* @brief Integer handle to an asset within a Manifest.
+	* Ids are positions in getAll(), so resolving one is a single array index.
+	* Loading the same manifest (text or compiled) always yields the same ids.
+	*/
+	struct AssetId {
+		static constexpr uint32_t invalid_value = UINT32_MAX;
+
+		uint32_t value = invalid_value;
+
+		constexpr bool valid() const { return value != invalid_value; }
+		constexpr explicit operator bool() const { return valid(); }
+
+		friend constexpr bool operator==(AssetId, AssetId) = default;
+	};
+
+	struct AssetFlag {
+		std::string_view key;
+		std::string_view value;
+	};
+
+	/**
+	* @brief Read-only view of the flags attached to an asset.
+	* Flags are stored flat and looked up linearly; assets carry only a handful.
+	*/
+	class AssetFlags {
+	public:
+		AssetFlags() = default;
+		AssetFlags(const AssetFlag* first, std::size_t count) : first(first), count(count) {}
+
+		const AssetFlag* find(std::string_view key) const;
+		bool contains(std::string_view key) const { return find(key) != nullptr; }
+
+		// @throws std::out_of_range if the flag is not present
+		std::string_view at(std::string_view key) const;
+
+		std::size_t size() const { return count; }
+		bool empty() const { return count == 0; }
+
+		const AssetFlag* begin() const { return first; }
+		const AssetFlag* end() const { return first + count; }
+
+	private:
+		const AssetFlag* first = nullptr;
+		std::size_t count = 0;
+	};
+
+	/**
+	* @brief Declarative description of a single asset.
+	*
+	* All strings are views owned by the Manifest the descriptor came from and
+	* stay valid for the Manifest's lifetime. 'type' and flag keys are interned
+	* in StringPool::shared().
+	*/
 	struct AssetDescriptor {
-		std::string name;
-		std::string type;
-		std::filesystem::path path;
-		std::unordered_map<std::string, std::string> flags;
+		std::string_view name;
+		std::string_view type;
+		std::string_view path; // Relative to the manifest root
+		AssetFlags flags;
+		AssetId id;
 	};
 
 
 
+	/**
+	* @brief Asset manifest loaded from either a text or a compiled manifest file.
+	*
+	* Text manifests are parsed on load. Compiled manifests (written by
+	* writeCompiled() or the blaze-manifest-compile tool) are detected by their
+	* header and used in place, without parsing.
+	*
+	* The file is memory mapped unless 'mapFile' is false, in which case it is
+	* read into memory; use that when the file may be rewritten while the
+	* Manifest is alive (see HotReloader).
+	*/
 	class Manifest
 	{
 	public:
-		explicit Manifest(const std::filesystem::path& manifestPath);
+		explicit Manifest(const std::filesystem::path& manifestPath, bool mapFile = true);
+
+		Manifest(const Manifest&) = delete;
+		Manifest& operator=(const Manifest&) = delete;
+		Manifest(Manifest&&) = default;
+		Manifest& operator=(Manifest&&) = default;
+
+		/**
+		* @brief Look up an asset by name.
+		* Accepts any string type without allocating; the lookup is one hash
+		* of 'name' against a perfect hash over the manifest's names.
+		* @throws std::out_of_range if the asset does not exist
+		*/
+		const AssetDescriptor& get(std::string_view name) const;
 
-		const AssetDescriptor& get(const std::string& name) const;
+		// @throws std::out_of_range if 'id' does not belong to this manifest
+		const AssetDescriptor& get(AssetId id) const;
+
+		// Id of the named asset, or an invalid AssetId if there is none.
+		AssetId find(std::string_view name) const;
+
+		/**
+		* @brief All assets, grouped by type.
+		* Types appear in order of first appearance in the manifest; assets keep
+		* their manifest order within a type.
+		*/
 		std::span<const AssetDescriptor> getAll() const;
-		std::span<const AssetDescriptor> getByType(const std::string& type) const;
+
+		/**
+		* @brief All assets of the given type, or an empty span if there are none.
+		* Views are precomputed at construction and stay valid for the Manifest's
+		* lifetime. The Manifest is immutable after construction, so views may be
+		* read from several threads at once.
+		*/
+		std::span<const AssetDescriptor> getByType(std::string_view type) const;
+
+		// Directory containing the manifest; asset paths are relative to it.
+		const std::filesystem::path& getRoot() const { return root; }
+
+		// Path the manifest was loaded from.
+		const std::filesystem::path& getPath() const { return path; }
+
+		// Full path of an asset's file.
+		std::filesystem::path resolvePath(const AssetDescriptor& asset) const { return root / asset.path; }
+
+		/**
+		* @brief Write this manifest in the compiled binary format.
+		* With 'embedNameHash' the perfect hash over asset names is stored in
+		* the file, so loading it does not hash any names.
+		* @throws std::runtime_error if the file cannot be written
+		*/
+		void writeCompiled(const std::filesystem::path& outputPath, bool embedNameHash = true) const;
+
+		// True if 'data' starts with the compiled manifest header.
+		static bool isCompiled(std::string_view data);
 
 	private:
+		struct TypeRange {
+			size_t offset = 0;
+			size_t count = 0;
+		};
+
+		void parseText();
+		void loadCompiled();
+		std::pmr::vector<uint32_t> groupByType(std::pmr::memory_resource* scratch);
+		void buildNameHash(std::span<const std::size_t> lineNumbers);
+
+		std::filesystem::path path;
 		std::filesystem::path root;
+		detail::MappedFile source;
 		std::vector<AssetDescriptor> assets;
-		std::unordered_map<std::string, size_t> index;
+		std::vector<AssetFlag> flags;
+		detail::PerfectHash ownedNameHash; // Empty when the compiled file embeds one
+		detail::PerfectHashView nameHash;
+		std::unordered_map<std::string_view, TypeRange> types;
 	};
 
 
-} // namespace blaze
\ No newline at end of file
+} // namespace blaze
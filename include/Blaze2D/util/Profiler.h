@@ -0,0 +1,170 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*
+    Profiling zones are compiled in when BLAZE2D_PROFILE is 1 (the
+    BLAZE2D_PROFILE CMake option). Otherwise the macros expand to nothing
+    and the library's own zones cost nothing; the Profiler class itself is
+    always available.
+*/
+#ifndef BLAZE2D_PROFILE
+#define BLAZE2D_PROFILE 0
+#endif
+
+#if BLAZE2D_PROFILE
+#define BLAZE_PROFILE_CONCAT_(a, b) a##b
+#define BLAZE_PROFILE_CONCAT(a, b) BLAZE_PROFILE_CONCAT_(a, b)
+
+// Times the rest of the enclosing scope. 'name' must be a string literal.
+#define BLAZE_PROFILE_SCOPE(name) ::blaze::ProfileZone BLAZE_PROFILE_CONCAT(blaze_profile_zone_, __LINE__)(name)
+
+// Names the calling thread in exported traces.
+#define BLAZE_PROFILE_THREAD(name) ::blaze::Profiler::shared().setThreadName(name)
+#else
+#define BLAZE_PROFILE_SCOPE(name) ((void)0)
+#define BLAZE_PROFILE_THREAD(name) ((void)0)
+#endif
+
+namespace blaze
+{
+	namespace detail {
+		struct ProfileBuffer;
+	}
+
+	struct ProfileEvent
+	{
+		const char* name = nullptr; // Zone name; a string literal
+		uint64_t start_ns = 0;      // Since Profiler::now()'s epoch
+		uint64_t end_ns = 0;
+		uint32_t thread = 0;        // Profiler-assigned thread number, from 1
+
+		double durationMs() const { return static_cast<double>(end_ns - start_ns) * 1e-6; }
+	};
+
+	/**
+	* @brief Collects timed zones from every thread.
+	*
+	* Each thread records into its own fixed-size ring buffer, which only that
+	* thread writes and only collect() reads, so recording takes no lock and
+	* never allocates. collect() moves the recorded zones into the capture;
+	* App::frame() calls it once per frame, other programs must call it
+	* often enough that the buffers (buffer_capacity zones per thread) do
+	* not fill up. Zones recorded into a full buffer are dropped and counted.
+	*
+	* The capture can be exported in the Chrome trace-event format, which
+	* chrome://tracing and Perfetto open.
+	*/
+	class Profiler
+	{
+	public:
+		static constexpr std::size_t buffer_capacity = 1 << 14;
+		static constexpr std::size_t default_capture_limit = 1 << 20;
+
+		// The profiler all zones record into.
+		static Profiler& shared();
+
+		Profiler();
+		~Profiler();
+
+		Profiler(const Profiler&) = delete;
+		Profiler& operator=(const Profiler&) = delete;
+
+		// Nanoseconds on the monotonic clock zones are timed with.
+		static uint64_t now()
+		{
+			return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now().time_since_epoch()).count());
+		}
+
+		// Zones are only recorded while enabled (the default).
+		void setEnabled(bool enabled) { active.store(enabled, std::memory_order_relaxed); }
+		bool isEnabled() const { return active.load(std::memory_order_relaxed); }
+
+		// Records a finished zone for the calling thread. 'name' must outlive the profiler.
+		void record(const char* name, uint64_t startNs, uint64_t endNs);
+
+		void setThreadName(std::string name);
+
+		/**
+		* @brief Moves the zones recorded by all threads into the capture.
+		* Once the capture holds its limit, further zones are dropped.
+		* @return the number of zones moved
+		*/
+		std::size_t collect();
+
+		// Collected zones, per thread in the order they ended.
+		std::span<const ProfileEvent> getEvents() const { return events; }
+
+		// Empties the capture. Zones still in thread buffers are kept.
+		void clear();
+
+		void setCaptureLimit(std::size_t maxEvents) { capture_limit = maxEvents; }
+
+		// Zones lost to full thread buffers or the capture limit.
+		uint64_t getDroppedCount() const;
+
+		/**
+		* @brief The capture as Chrome trace-event JSON: one complete ("X")
+		* event per zone, with thread names as metadata.
+		*/
+		std::string toChromeTrace() const;
+
+		// @throws std::runtime_error if the file cannot be written
+		void writeChromeTrace(const std::filesystem::path& path) const;
+
+	private:
+		detail::ProfileBuffer& threadBuffer();
+
+		std::atomic<bool> active = true;
+		uint32_t id;
+
+		mutable std::mutex mutex; // Guards buffers and thread_names
+		std::vector<std::shared_ptr<detail::ProfileBuffer>> buffers;
+		std::unordered_map<uint32_t, std::string> thread_names;
+		uint32_t next_thread = 1;
+
+		// Main thread only.
+		std::vector<ProfileEvent> events;
+		std::size_t capture_limit = default_capture_limit;
+		uint64_t capture_dropped = 0;
+		uint64_t retired_dropped = 0; // Dropped by buffers of threads that exited
+	};
+
+	/**
+	* @brief Records the lifetime of a scope as a profiling zone.
+	* Usually created through BLAZE_PROFILE_SCOPE.
+	*/
+	class ProfileZone
+	{
+	public:
+		explicit ProfileZone(const char* name, Profiler& profiler = Profiler::shared())
+			: profiler(profiler), name(name), start(profiler.isEnabled() ? Profiler::now() : 0)
+		{
+		}
+
+		~ProfileZone()
+		{
+			if (start)
+				profiler.record(name, start, Profiler::now());
+		}
+
+		ProfileZone(const ProfileZone&) = delete;
+		ProfileZone& operator=(const ProfileZone&) = delete;
+
+	private:
+		Profiler& profiler;
+		const char* name;
+		uint64_t start;
+	};
+
+} // namespace blaze
@@ -0,0 +1,81 @@
+#pragma once
+#include "Blaze2D/util/Rect.h"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+/*
+    Batched Rect / Vec2 kernels for culling and hit testing large sets.
+
+    Each function applies the matching scalar Rect method to every element
+    of a span and produces bit-identical results (including NaN and signed
+    zero behavior). Predicates write one byte per element (1 = true, 0 =
+    false) and return the number of true results; outputs must be at least
+    as long as the inputs.
+
+    The implementation is picked once at runtime: AVX2 or SSE2 on x86-64,
+    NEON on ARM64, plain loops elsewhere.
+*/
+
+namespace blaze
+{
+    enum class SimdLevel : uint8_t
+    {
+        Scalar,
+        SSE2,
+        AVX2,
+        NEON
+    };
+
+    namespace batch
+    {
+        /* =========================
+           Predicates
+           ========================= */
+
+        // out[i] = rects[i].intersects(area)
+        std::size_t intersects(std::span<const Rect> rects, const Rect& area, std::span<uint8_t> out);
+
+        // out[i] = rects[i].contains(inner)
+        std::size_t contains(std::span<const Rect> rects, const Rect& inner, std::span<uint8_t> out);
+
+        // out[i] = rects[i].contains(point)
+        std::size_t contains(std::span<const Rect> rects, const Vec2& point, std::span<uint8_t> out);
+
+        // out[i] = rect.contains(points[i])
+        std::size_t pointsInRect(const Rect& rect, std::span<const Vec2> points, std::span<uint8_t> out);
+
+        /* =========================
+           Transforms
+           ========================= */
+
+        // out[i] = rects[i].intersection(clip); 'out' may alias 'rects'
+        void intersection(std::span<const Rect> rects, const Rect& clip, std::span<Rect> out);
+
+        // out[i] = rects[i].united(other); 'out' may alias 'rects'
+        void united(std::span<const Rect> rects, const Rect& other, std::span<Rect> out);
+
+        // rects[i] = rects[i].translated(delta)
+        void translate(std::span<Rect> rects, const Vec2& delta);
+
+        // points[i] += delta
+        void translate(std::span<Vec2> points, const Vec2& delta);
+
+        /* =========================
+           Dispatch
+           ========================= */
+
+        // Implementation in use.
+        SimdLevel level();
+
+        /**
+        * @brief Restricts dispatch to 'level' (used by tests and benchmarks to
+        * compare paths). Levels the CPU does not support fall back to the best
+        * supported one below them. Returns the level actually selected.
+        */
+        SimdLevel forceLevel(SimdLevel level);
+
+        const char* levelName(SimdLevel level);
+    }
+
+} // namespace blaze
@@ -0,0 +1,164 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace blaze
+{
+	/**
+	* @brief Weak reference to an object kept in a SlotMap (or a store built
+	* the same way): the slot's index plus the generation the slot had when
+	* the object was added.
+	*
+	* Removing the object bumps the slot's generation, so a handle kept past
+	* that is recognised as stale instead of reaching whatever reuses the
+	* slot. The null handle never refers to anything.
+	*/
+	template <typename T>
+	struct Handle
+	{
+		static constexpr uint32_t npos = UINT32_MAX;
+
+		uint32_t index = npos;
+		uint32_t generation = 0;
+
+		bool isNull() const { return index == npos; }
+		explicit operator bool() const { return index != npos; }
+
+		bool operator==(const Handle&) const = default;
+	};
+
+	/**
+	* @brief Objects stored contiguously and reached in O(1) through
+	* generational handles.
+	*
+	* Values live in one dense array in no particular order; removal moves
+	* the last value into the hole. A separate slot array maps handle
+	* indices to dense positions and keeps the generations. Slots of removed
+	* values are reused, their generation telling old handles from new ones.
+	*
+	* Pointers to values are invalidated by insertions and removals; keep
+	* handles instead. 'Tag' sets the handle type, so e.g. a map of
+	* std::unique_ptr<Window> can hand out Handle<Window>.
+	*/
+	template <typename T, typename Tag = T>
+	class SlotMap
+	{
+	public:
+		using HandleType = Handle<Tag>;
+
+		HandleType insert(T value)
+		{
+			uint32_t index;
+			if (free_head != npos) {
+				index = free_head;
+				free_head = slots[index].dense;
+			}
+			else {
+				index = static_cast<uint32_t>(slots.size());
+				slots.push_back({ 0, 0 });
+			}
+
+			// Odd generations are live, even ones free.
+			Slot& slot = slots[index];
+			++slot.generation;
+			slot.dense = static_cast<uint32_t>(values.size());
+
+			values.push_back(std::move(value));
+			owners.push_back(index);
+			return { index, slot.generation };
+		}
+
+		// Removes the value 'handle' refers to. Returns false if it was stale.
+		bool erase(HandleType handle)
+		{
+			if (!contains(handle))
+				return false;
+
+			Slot& slot = slots[handle.index];
+			const uint32_t dense = slot.dense;
+			const uint32_t last = static_cast<uint32_t>(values.size() - 1);
+			if (dense != last) {
+				values[dense] = std::move(values[last]);
+				owners[dense] = owners[last];
+				slots[owners[dense]].dense = dense;
+			}
+			values.pop_back();
+			owners.pop_back();
+
+			++slot.generation;
+			slot.dense = free_head;
+			free_head = handle.index;
+			return true;
+		}
+
+		bool contains(HandleType handle) const
+		{
+			return handle.index < slots.size() && slots[handle.index].generation == handle.generation
+				&& (handle.generation & 1);
+		}
+
+		// Value 'handle' refers to, or nullptr if it is stale or null.
+		T* get(HandleType handle) { return contains(handle) ? &values[slots[handle.index].dense] : nullptr; }
+		const T* get(HandleType handle) const { return contains(handle) ? &values[slots[handle.index].dense] : nullptr; }
+
+		// Handle of the value at 'position' in iteration order.
+		HandleType handleAt(std::size_t position) const
+		{
+			const uint32_t index = owners[position];
+			return { index, slots[index].generation };
+		}
+
+		std::size_t size() const { return values.size(); }
+		bool empty() const { return values.empty(); }
+
+		void reserve(std::size_t count)
+		{
+			values.reserve(count);
+			owners.reserve(count);
+			slots.reserve(count);
+		}
+
+		// Removes every value; all handles handed out so far become stale.
+		void clear()
+		{
+			while (!values.empty())
+				erase(handleAt(values.size() - 1));
+		}
+
+		// Values in storage order, which removals change.
+		auto begin() { return values.begin(); }
+		auto end() { return values.end(); }
+		auto begin() const { return values.begin(); }
+		auto end() const { return values.end(); }
+
+		T* data() { return values.data(); }
+		const T* data() const { return values.data(); }
+
+	private:
+		static constexpr uint32_t npos = UINT32_MAX;
+
+		struct Slot
+		{
+			uint32_t dense;      // Position in 'values', or the next free slot
+			uint32_t generation;
+		};
+
+		std::vector<T> values;
+		std::vector<uint32_t> owners; // Slot of each value
+		std::vector<Slot> slots;
+		uint32_t free_head = npos;
+	};
+
+} // namespace blaze
+
+template <typename T>
+struct std::hash<blaze::Handle<T>>
+{
+	std::size_t operator()(const blaze::Handle<T>& handle) const noexcept
+	{
+		return std::hash<uint64_t>()((uint64_t(handle.generation) << 32) | handle.index);
+	}
+};
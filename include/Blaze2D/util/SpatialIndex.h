@@ -0,0 +1,208 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Blaze2D/util/Rect.h"
+
+namespace blaze
+{
+	/*
+		Spatial indices over Rect bounds for culling, hit testing and
+		broad-phase overlap tests.
+
+		Objects are added with insert(), which returns a proxy id used to
+		move or remove them, and carry a caller-chosen 32-bit value that the
+		queries report. Queries append to caller-provided vectors (nothing is
+		cleared) and return how many results they added. Results are exact:
+		they match Rect::intersects / Rect::contains on the bounds passed in,
+		whatever the internal padding.
+
+		AabbTree suits scenes with uneven density and widely varying sizes.
+		SpatialGrid is cheaper to update when objects are of similar size and
+		spread evenly; pick its cell size around the typical object size.
+	*/
+
+	struct SpatialPair
+	{
+		uint32_t a; // Value of the object with the lower proxy id
+		uint32_t b;
+
+		bool operator==(const SpatialPair&) const = default;
+	};
+
+	/**
+	* @brief Dynamic bounding volume hierarchy with fat AABBs.
+	*
+	* Leaves store their bounds grown by a margin (plus the predicted motion
+	* passed to move()), so objects moving a little stay in place and only
+	* re-insert once they leave their fat box. Insertion picks the sibling by
+	* surface-area (perimeter) cost and the tree is kept height-balanced with
+	* AVL rotations.
+	*/
+	class AabbTree
+	{
+	public:
+		static constexpr uint32_t npos = UINT32_MAX;
+
+		explicit AabbTree(float margin = 4.0f);
+
+		uint32_t insert(const Rect& bounds, uint32_t value);
+		void remove(uint32_t proxy);
+
+		/**
+		* @brief Updates the bounds of a proxy.
+		* @param displacement Expected motion until the next update; the fat box
+		* is stretched in that direction.
+		* @return true if the leaf was re-inserted, false if it still fit.
+		*/
+		bool move(uint32_t proxy, const Rect& bounds, const Vec2& displacement = {});
+
+		const Rect& getBounds(uint32_t proxy) const { return nodes[proxy].bounds; }
+		Rect getFatBounds(uint32_t proxy) const;
+		uint32_t getValue(uint32_t proxy) const { return nodes[proxy].value; }
+
+		std::size_t query(const Rect& area, std::vector<uint32_t>& out) const;
+		std::size_t queryPoint(const Vec2& point, std::vector<uint32_t>& out) const;
+		// Every intersecting pair once.
+		std::size_t queryPairs(std::vector<SpatialPair>& out) const;
+
+		std::size_t size() const { return count; }
+		int height() const;
+		void clear();
+
+	private:
+		// Fat box as min/max corners.
+		struct Box
+		{
+			float minX, minY, maxX, maxY;
+		};
+
+		struct Node
+		{
+			Box box;
+			Rect bounds;     // Exact bounds (leaves)
+			uint32_t parent; // Next free node while unused
+			uint32_t child1; // npos for leaves
+			uint32_t child2;
+			int32_t height;  // 0 for leaves, -1 while unused
+			uint32_t value;
+
+			bool isLeaf() const { return child1 == npos; }
+		};
+
+		uint32_t allocate();
+		void release(uint32_t node);
+
+		void insertLeaf(uint32_t leaf);
+		void removeLeaf(uint32_t leaf);
+		uint32_t balance(uint32_t a);
+		void refit(uint32_t node);
+
+		Box fatten(const Rect& bounds, const Vec2& displacement) const;
+
+		std::vector<Node> nodes;
+		uint32_t root = npos;
+		uint32_t free_list = npos;
+		std::size_t count = 0;
+		float margin;
+	};
+
+	/**
+	* @brief Uniform grid hashed by cell coordinates.
+	*
+	* Each object is linked into every cell its bounds touch. Objects covering
+	* more than max_cells_per_axis cells on either axis go to a separate list
+	* that every query scans, so a few huge objects do not flood the grid.
+	* Duplicates across cells are filtered without per-query state: a result
+	* is reported only from the cell holding the top-left corner of its
+	* overlap with the query.
+	*/
+	class SpatialGrid
+	{
+	public:
+		static constexpr uint32_t npos = UINT32_MAX;
+		static constexpr int32_t max_cells_per_axis = 16;
+
+		explicit SpatialGrid(float cellSize = 64.0f);
+
+		uint32_t insert(const Rect& bounds, uint32_t value);
+		void remove(uint32_t proxy);
+		// Re-links the proxy only if the set of cells it covers changed.
+		void move(uint32_t proxy, const Rect& bounds);
+
+		const Rect& getBounds(uint32_t proxy) const { return proxies[proxy].bounds; }
+		uint32_t getValue(uint32_t proxy) const { return proxies[proxy].value; }
+		float getCellSize() const { return cell_size; }
+
+		std::size_t query(const Rect& area, std::vector<uint32_t>& out) const;
+		std::size_t queryPoint(const Vec2& point, std::vector<uint32_t>& out) const;
+		// Every intersecting pair once.
+		std::size_t queryPairs(std::vector<SpatialPair>& out) const;
+
+		std::size_t size() const { return count; }
+		void clear();
+
+	private:
+		struct CellRange
+		{
+			int32_t x0, y0, x1, y1;
+
+			bool operator==(const CellRange&) const = default;
+		};
+
+		struct Proxy
+		{
+			Rect bounds;
+			CellRange cells;
+			uint32_t value;
+			uint32_t large; // Index in large_proxies, npos if linked into cells; next free proxy while unused
+			bool used;
+		};
+
+		struct Cell
+		{
+			int32_t x, y;
+			uint32_t head; // First link, npos if empty
+			bool used;
+		};
+
+		struct Link
+		{
+			uint32_t proxy;
+			uint32_t next; // Next link in the cell or the free list
+		};
+
+		int32_t cellCoord(float v) const;
+		CellRange cellsFor(const Rect& bounds) const;
+		bool isLarge(const CellRange& range) const;
+
+		// Slot of an existing cell, npos if there is none.
+		uint32_t findSlot(int32_t x, int32_t y) const;
+		Cell& getCell(int32_t x, int32_t y);
+		void growCells();
+
+		// Calls fn(cell) for every non-empty cell in 'range'.
+		template <typename Fn>
+		void forEachCell(const CellRange& range, Fn&& fn) const;
+
+		void link(uint32_t proxy);
+		void unlink(uint32_t proxy);
+
+		float cell_size;
+		float inv_cell_size;
+
+		std::vector<Proxy> proxies;
+		uint32_t free_proxies = npos;
+		std::size_t count = 0;
+
+		std::vector<Cell> cells; // Open addressing, power-of-two size
+		std::size_t used_cells = 0;
+
+		std::vector<Link> links;
+		uint32_t free_links = npos;
+
+		std::vector<uint32_t> large_proxies;
+	};
+
+} // namespace blaze
@@ -0,0 +1,49 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace blaze
+{
+	/**
+	* @brief Append-only pool of unique, immutable strings.
+	*
+	* intern() returns a view that stays valid for the lifetime of the pool.
+	* Equal strings always intern to the same view, so interned strings may be
+	* compared by data() pointer.
+	*
+	* The pool is thread-safe.
+	*/
+	class StringPool
+	{
+	public:
+		StringPool() = default;
+
+		StringPool(const StringPool&) = delete;
+		StringPool& operator=(const StringPool&) = delete;
+
+		std::string_view intern(std::string_view str);
+
+		std::size_t size() const;
+
+		/**
+		* @brief Process-wide pool used for asset type names and flag keys.
+		* Strings interned here are never released.
+		*/
+		static StringPool& shared();
+
+	private:
+		static constexpr std::size_t block_size = 4096;
+
+		mutable std::mutex mutex;
+
+		std::vector<std::unique_ptr<char[]>> blocks;
+		std::size_t block_used = block_size;
+
+		std::unordered_set<std::string_view> strings;
+	};
+
+} // namespace blaze
@@ -1,19 +1,51 @@
 #pragma once
 
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
 #include <string>
 
+#include "Blaze2D/graphics/CommandBuffer.h"
+#include "Blaze2D/ui/Container.h"
+#include "Blaze2D/util/Color.h"
+#include "Blaze2D/util/DirtyRegion.h"
+#include "Blaze2D/util/SlotMap.h"
+
 struct SDL_Window;
 struct SDL_Renderer;
+struct SDL_Texture;
+struct SDL_Surface;
 
 namespace blaze {
 
+    class Window;
+    using WindowHandle = Handle<Window>;
+    using TextureHandle = Handle<SDL_Texture>;
+
+    enum class WindowMode {
+        Native,  // An SDL window with the default renderer
+        Headless // No OS window; renders with SDL's software renderer into a memory framebuffer
+    };
+
     class Window {
     public:
+        // Called once per fixed update with the step length in seconds.
+        using UpdateCallback = std::function<void(Window&, double dt)>;
+
+        // Called once per frame; 'alpha' in [0, 1) is how far the frame is between the last two updates.
+        using RenderCallback = std::function<void(Window&, SDL_Renderer*, double alpha)>;
+
+        // Called once per frame to record the frame into 'commands' instead of drawing it; must not call SDL.
+        using RecordCallback = std::function<void(Window&, CommandBuffer& commands, double alpha)>;
+
         /*
         * Constructs window object
         * Initializes SDL if not already
+        * Headless windows need no video driver or display (CI, render farms,
+        * golden-image tests); they receive no events.
         */
-        Window(const std::string _name, const int _width = 100, const int _height = 100, const std::string _title = "");
+        Window(const std::string _name, const int _width = 100, const int _height = 100, const std::string _title = "", WindowMode mode = WindowMode::Native);
 
         ~Window();
 
@@ -22,10 +54,126 @@ namespace blaze {
         int getHeight() const { return height; }
         std::string getName() const { return name; }
         std::string getTitle() const { return title; }
-        SDL_Window* getSDLWindow() const { return window; }
+        SDL_Window* getSDLWindow() const { return window; } // nullptr for headless windows
         SDL_Renderer* getRenderer() const { return renderer; }
+        uint32_t getId() const { return id; }
+
+        // Handle the owning App knows this window by (see App::getWindow(WindowHandle)).
+        WindowHandle getHandle() const { return handle; }
+
+        // Root of the container tree; always covers the whole window.
+        // Containers must be destroyed before their window.
+        Container& getRoot() { return *root; }
+
+        // Container 'handle' refers to, or nullptr if it has been destroyed.
+        Container* getContainer(ContainerHandle handle) const { return containers.get(handle); }
+
+        Container* getFocus() const { return focusContainer; }
+        Container* getPointerCapture() const { return captureContainer; }
+
+        void onUpdate(UpdateCallback callback) { updateCallback = std::move(callback); }
+        void onRender(RenderCallback callback) { renderCallback = std::move(callback); }
+
+        /*
+        * Sets a record callback, used instead of the render callback. When
+        * the frame loop is pipelined (FrameLoopOptions::pipelined) frames
+        * are recorded on the update thread and replayed on the main thread
+        * one frame later, repainting the whole window; otherwise render()
+        * records and replays them right away. The window clears to the
+        * clear color before replaying. With dirty tracking the recording is
+        * replayed into each dirty rect, and its clears and clips stay inside it.
+        */
+        void onRecord(RecordCallback callback) { recordCallback = std::move(callback); }
+        bool hasRecordCallback() const { return static_cast<bool>(recordCallback); }
+
+        void setClearColor(const Color& color) { clearColor = color; }
+        const Color& getClearColor() const { return clearColor; }
+
+        /*
+        * Enables dirty-rectangle rendering.
+        * The window then draws into a persistent texture and repaints only
+        * what was invalidated: render() clears each dirty rect and runs the
+        * render callback once per rect, clipped to it (see getPaintRect()),
+        * and present() is skipped while nothing was drawn. Layout changes,
+        * resizes and expose events invalidate the whole window; other changes
+        * must call invalidate().
+        */
+        void setDirtyTracking(bool enabled);
+        bool getDirtyTracking() const { return dirtyTracking; }
+
+        // Marks part of the window, or all of it, for repainting.
+        void invalidate(const Rect& rect) { dirty.add(rect); }
+        void invalidate() { dirty.addAll(); }
+
+        const DirtyRegion& getDirtyRegion() const { return dirty; }
+
+        // Area the render callback is painting; the whole window without dirty tracking.
+        const Rect& getPaintRect() const { return paintRect; }
+
+        // Runs the update callback. Called by App::update().
+        void update(double dt);
+
+        // Lays out the container tree, clears the back buffer and runs the render callback. Called by App::render().
+        void render(double alpha);
+
+        // Presents the back buffer. Called by App::present(). Returns false if skipped because nothing was drawn.
+        bool present();
+
+        /*
+        * Lays out the container tree and records the next frame into the
+        * back command buffer. Touches no SDL state, so it may run on
+        * another thread while replay() runs. Called by pipelined App frames.
+        */
+        void record(double alpha);
+
+        // Makes the last recorded frame the one replay() draws. Not concurrent with record() or replay().
+        void swapCommands() { frontCommands ^= 1; }
+
+        // Draws the front command buffer and presents it. Called by pipelined App frames.
+        bool replay();
+
+        /*
+        * Creates a texture owned by the window's renderer from 'surface'
+        * (which the caller keeps). It lives until destroyTexture() or the
+        * window's destruction; getTexture() returns nullptr after either.
+        * Throws std::runtime_error if SDL cannot create it.
+        */
+        TextureHandle createTexture(SDL_Surface* surface);
+        SDL_Texture* getTexture(TextureHandle handle) const;
+
+        // Returns false if the handle was already stale.
+        bool destroyTexture(TextureHandle handle);
+
+        std::size_t getTextureCount() const { return textures.size(); }
+
+        bool isHeadless() const { return framebuffer != nullptr; }
+
+        /*
+        * Framebuffer of a headless window, nullptr otherwise. RGBA32 (bytes
+        * R, G, B, A), getHeight() rows of 'pitch' bytes. Holds the frame
+        * as of the last present(); read it in place, no copy is made.
+        */
+        SDL_Surface* getFramebuffer() const { return framebuffer; }
+
+        // Framebuffer bytes of a headless window, empty otherwise.
+        std::span<const uint8_t> getPixels() const;
+
+        // Pixel of a headless window's framebuffer. Throws std::out_of_range outside the window or if not headless.
+        Color32 readPixel(int x, int y) const;
 
     private:
+        friend class App;
+        friend class Container;
+        friend class EventRouter;
+
+        // Keeps the size and root rect in sync with SDL resize events.
+        void resized(int newWidth, int newHeight);
+
+        void createNative();
+        void paint(double alpha);
+        void createCanvas();
+        void destroyCanvas();
+
         std::string name;
         std::string title;
         int width;
@@ -33,6 +181,32 @@ namespace blaze {
 
         SDL_Window* window = nullptr;
         SDL_Renderer* renderer = nullptr;
+        SDL_Surface* framebuffer = nullptr; // Headless windows only
+        uint32_t id = 0;
+        WindowHandle handle;
+        bool removed = false; // Removed from the app mid-frame, destroyed once the frame is over
+
+        SlotMap<SDL_Texture*, SDL_Texture> textures;
+
+        ContainerStore containers;
+        std::unique_ptr<Container> root;
+        Container* focusContainer = nullptr;
+        Container* captureContainer = nullptr;
+
+        UpdateCallback updateCallback;
+        RenderCallback renderCallback;
+        RecordCallback recordCallback;
+
+        // Double-buffered frames for pipelined rendering.
+        CommandBuffer commands[2];
+        int frontCommands = 0;
+        Color clearColor = Color(0.f, 0.f, 0.f, 1.f);
+
+        bool dirtyTracking = false;
+        bool drawn = false;
+        SDL_Texture* canvas = nullptr; // Persistent target while dirty tracking is on
+        DirtyRegion dirty;
+        Rect paintRect;
     };
 
 } // namespace blaze
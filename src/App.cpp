@@ -1,48 +1,399 @@
 
 #include <Blaze2D/App.h>
+#include <algorithm>
 #include <stdexcept>
+#include <utility>
 
 #include "Blaze2D/internal/SDLManager.h"
+#include "Blaze2D/util/FrameArena.h"
+#include "Blaze2D/util/Profiler.h"
 
 
 namespace blaze {
 
+    struct App::WindowLoop
+    {
+        App& app;
+
+        explicit WindowLoop(App& app) : app(app) { ++app.window_loops; }
+
+        ~WindowLoop()
+        {
+            if (--app.window_loops == 0)
+                app.eraseRemovedWindows();
+        }
+    };
+
     App::App() {
-        // Nothing to initialize yet.
         // SDL is initialized lazily by subsystems.
     }
 
     App::~App() {
+        stopWorker();
         blaze::detail::shutdown_sdl();
     }
 
-    Window& App::createWindow(const std::string name, const int width, const int height, const std::string title)
+    Window& App::createWindow(const std::string name, const int width, const int height, const std::string title, WindowMode mode)
     {
-        windows.push_back(std::make_unique<Window>(name, width, height, title));
-        return *windows.back();
+        auto owned = std::make_unique<Window>(name, width, height, title, mode);
+        Window& window = *owned;
+        window.handle = windows.insert(std::move(owned));
+        windows_by_name.try_emplace(window.getName(), window.handle);
+
+        if (mode == WindowMode::Native)
+            router.addWindow(window);
+        return window;
     }
 
     Window& App::getWindow(const std::string& name)
     {
-        for (auto& win : windows) {
-            if (win->getName() == name)
-                return *win;
-        }
+        if (Window* window = getWindow(findWindow(name)))
+            return *window;
         throw std::runtime_error("Window not found: " + name);
     }
 
+    Window* App::getWindow(WindowHandle handle)
+    {
+        std::unique_ptr<Window>* window = windows.get(handle);
+        return window && !(*window)->removed ? window->get() : nullptr;
+    }
+
+    WindowHandle App::findWindow(const std::string& name) const
+    {
+        auto it = windows_by_name.find(name);
+        return it != windows_by_name.end() ? it->second : WindowHandle{};
+    }
+
     void App::removeWindow(Window& window)
     {
-        windows.erase(
-            std::remove_if(
-                windows.begin(),
-                windows.end(),
-                [&](const std::unique_ptr<Window>& w) {
-                    return w.get() == &window;
+        removeWindow(window.getHandle());
+    }
+
+    bool App::removeWindow(WindowHandle handle)
+    {
+        Window* window = getWindow(handle);
+        if (!window)
+            return false;
+
+        router.removeWindow(*window);
+
+        /*
+            Names are not unique. If this window was the one its name
+            resolved to, hand the name to another window sharing it; only
+            then is the window list searched.
+        */
+        const std::string name = window->getName();
+        auto it = windows_by_name.find(name);
+        if (it != windows_by_name.end() && it->second == handle) {
+            windows_by_name.erase(it);
+            for (auto& other : windows) {
+                if (other.get() != window && !other->removed && other->getName() == name) {
+                    windows_by_name.emplace(name, other->getHandle());
+                    break;
+                }
+            }
+        }
+
+        /*
+            Erasing moves another window into this one's place, which would
+            break the loop that called back into here. Mid-loop the window
+            is only marked; the last loop to finish erases it. A pipelined
+            update removing a window runs while the main thread replays,
+            which touches neither the mark, the names nor the router.
+        */
+        if (window_loops > 0) {
+            window->removed = true;
+            removed_windows.push_back(handle);
+            return true;
+        }
+        return windows.erase(handle);
+    }
+
+    void App::eraseRemovedWindows()
+    {
+        for (WindowHandle handle : removed_windows)
+            windows.erase(handle);
+        removed_windows.clear();
+    }
+
+    std::span<const SDL_Event> App::get_input()
+    {
+        BLAZE_PROFILE_SCOPE("App::get_input");
+        std::span<const SDL_Event> remaining = router.poll();
+
+        for (const SDL_Event& event : remaining) {
+            if (event.type == SDL_EVENT_QUIT)
+                running = false;
+        }
+
+        return remaining;
+    }
+
+    void App::update(double dt)
+    {
+        BLAZE_PROFILE_SCOPE("App::update");
+        WindowLoop loop(*this);
+        for (auto& win : windows) {
+            if (!win->removed)
+                win->update(dt);
+        }
+    }
+
+    void App::render(double alpha)
+    {
+        BLAZE_PROFILE_SCOPE("App::render");
+        WindowLoop loop(*this);
+        for (auto& win : windows) {
+            if (!win->removed)
+                win->render(alpha);
+        }
+    }
+
+    std::size_t App::present()
+    {
+        BLAZE_PROFILE_SCOPE("App::present");
+        WindowLoop loop(*this);
+        std::size_t presented = 0;
+        for (auto& win : windows) {
+            if (!win->removed)
+                presented += win->present();
+        }
+        return presented;
+    }
+
+    void App::run(const FrameLoopOptions& loopOptions)
+    {
+        options = loopOptions;
+        timestep = FixedTimestep(1.0 / options.update_hz, options.max_updates_per_frame);
+        stats = FrameStats{};
+        running = true;
+        lastFrame = 0;
+
+        while (frame()) {
+        }
+        stopWorker();
+    }
+
+    bool App::frame()
+    {
+#if BLAZE2D_PROFILE
+        // Drain the previous frame's zones from all threads so their buffers do not fill up.
+        Profiler::shared().collect();
+#endif
+        BLAZE_PROFILE_SCOPE("App::frame");
+        WindowLoop loop(*this);
+
+        if (frequency == 0)
+            frequency = SDL_GetPerformanceFrequency();
+
+        const double toMs = 1000.0 / static_cast<double>(frequency);
+
+        const uint64_t start = SDL_GetPerformanceCounter();
+
+        /*
+            The first frame has no previous frame to measure against; it
+            runs no updates and only renders the initial state.
+        */
+        const double elapsed = lastFrame ? static_cast<double>(start - lastFrame) / static_cast<double>(frequency) : 0.0;
+        lastFrame = start;
+
+        get_input();
+        const uint64_t afterInput = SDL_GetPerformanceCounter();
+
+        const uint64_t droppedBefore = timestep.getDroppedSteps();
+        const int updates = timestep.advance(elapsed);
+
+        uint64_t updateTicks = 0;
+        uint64_t renderTicks = 0;
+        std::size_t presented = 0;
+        if (options.pipelined) {
+            /*
+                The worker updates and records frame N while this thread
+                replays frame N-1. Input was dispatched above, before the
+                worker started, so containers are never touched by both.
+            */
+            for (auto& win : windows) {
+                if (win->hasRecordCallback())
+                    win->swapCommands();
+            }
+            startWorkerFrame(updates, timestep.alpha());
+
+            // Not checking 'removed': pipelined updates may be setting it.
+            for (auto& win : windows) {
+                if (win->hasRecordCallback())
+                    presented += win->replay();
+            }
+            finishWorkerFrame();
+            updateTicks = worker_update_ticks;
+            renderTicks = worker_record_ticks;
+
+            // Windows drawn by render callbacks cannot overlap; draw them now.
+            for (auto& win : windows) {
+                if (!win->hasRecordCallback() && !win->removed) {
+                    win->render(timestep.alpha());
+                    presented += win->present();
+                }
+            }
+        }
+        else {
+            for (int i = 0; i < updates; ++i)
+                update(timestep.step());
+            const uint64_t afterUpdate = SDL_GetPerformanceCounter();
+
+            render(timestep.alpha());
+            const uint64_t afterRender = SDL_GetPerformanceCounter();
+
+            presented = present();
+            updateTicks = afterUpdate - afterInput;
+            renderTicks = afterRender - afterUpdate;
+        }
+        const uint64_t afterPresent = SDL_GetPerformanceCounter();
+
+        /*
+            The budget is the frame-cap period, or one fixed step when the
+            frame rate is left to vsync. Overrunning it means this frame
+            was shown late.
+        */
+        const double budget = options.max_fps > 0.0 ? 1.0 / options.max_fps : timestep.step();
+        const uint64_t budgetTicks = static_cast<uint64_t>(budget * static_cast<double>(frequency));
+
+        /*
+            Nothing was presented, so there is no vsync to block on: sleep
+            until an event arrives or the next fixed update is due, either
+            of which may invalidate a window.
+        */
+        const bool idle = presented == 0 && getWindowCount() > 0;
+        if (idle) {
+            const double untilUpdate = (1.0 - timestep.alpha()) * timestep.step();
+            SDL_WaitEventTimeout(nullptr, std::max(1, static_cast<int>(untilUpdate * 1000.0)));
+        }
+        else if (options.max_fps > 0.0) {
+            waitUntil(start + budgetTicks);
+        }
+        const uint64_t end = SDL_GetPerformanceCounter();
+
+        // Frame memory handed out on this thread is dead from here on.
+        FrameArena& arena = FrameArena::local();
+        arena.reset();
+
+        stats.input_ms = static_cast<double>(afterInput - start) * toMs;
+        stats.update_ms = static_cast<double>(updateTicks) * toMs;
+        stats.render_ms = static_cast<double>(renderTicks) * toMs;
+        stats.present_ms = options.pipelined
+            ? static_cast<double>(afterPresent - afterInput) * toMs
+            : static_cast<double>(afterPresent - afterInput - updateTicks - renderTicks) * toMs;
+        stats.wait_ms = static_cast<double>(end - afterPresent) * toMs;
+        stats.frame_ms = static_cast<double>(end - start) * toMs;
+        stats.alpha = timestep.alpha();
+        stats.updates = updates;
+        stats.arena_peak_bytes = arena.getFramePeak() + (options.pipelined ? worker_arena_peak : 0);
+        stats.dropped_updates += timestep.getDroppedSteps() - droppedBefore;
+        if (idle)
+            ++stats.idle_frames;
+        else if (afterPresent - start > budgetTicks)
+            ++stats.dropped_frames;
+        ++stats.frame_index;
+
+        return running && getWindowCount() > 0;
+    }
+
+    void App::startWorkerFrame(int updates, double alpha)
+    {
+        {
+            std::lock_guard lock(worker_mutex);
+            if (!worker.joinable()) {
+                worker_stopping = false;
+                worker = std::thread([this] { workerLoop(); });
+            }
+            worker_updates = updates;
+            worker_alpha = alpha;
+            worker_busy = true;
+        }
+        worker_wake.notify_one();
+    }
+
+    void App::finishWorkerFrame()
+    {
+        std::unique_lock lock(worker_mutex);
+        worker_done.wait(lock, [this] { return !worker_busy; });
+        if (worker_error)
+            std::rethrow_exception(std::exchange(worker_error, nullptr));
+    }
+
+    void App::stopWorker()
+    {
+        {
+            std::lock_guard lock(worker_mutex);
+            if (!worker.joinable())
+                return;
+            worker_stopping = true;
+        }
+        worker_wake.notify_one();
+        worker.join();
+    }
+
+    void App::workerLoop()
+    {
+        BLAZE_PROFILE_THREAD("App worker");
+
+        std::unique_lock lock(worker_mutex);
+        for (;;) {
+            worker_wake.wait(lock, [this] { return worker_busy || worker_stopping; });
+            if (worker_stopping)
+                return;
+
+            const int updates = worker_updates;
+            const double alpha = worker_alpha;
+            lock.unlock();
+
+            const uint64_t start = SDL_GetPerformanceCounter();
+            uint64_t afterUpdate = start;
+            std::exception_ptr error;
+            try {
+                for (int i = 0; i < updates; ++i)
+                    update(timestep.step());
+                afterUpdate = SDL_GetPerformanceCounter();
+
+                for (auto& win : windows) {
+                    if (win->hasRecordCallback() && !win->removed)
+                        win->record(alpha);
                 }
-            ),
-            windows.end()
-        );
+            }
+            catch (...) {
+                error = std::current_exception();
+            }
+            const uint64_t end = SDL_GetPerformanceCounter();
+
+            FrameArena& arena = FrameArena::local();
+            arena.reset();
+
+            lock.lock();
+            worker_arena_peak = arena.getFramePeak();
+            worker_error = std::move(error);
+            worker_update_ticks = afterUpdate - start;
+            worker_record_ticks = end - afterUpdate;
+            worker_busy = false;
+            worker_done.notify_one();
+        }
+    }
+
+    void App::waitUntil(uint64_t deadline) const
+    {
+        /*
+            OS sleeps overshoot by up to a scheduler tick, so sleep until
+            'spin_ms' before the deadline and spin on the performance
+            counter for the rest.
+        */
+        const uint64_t spinTicks = static_cast<uint64_t>(options.spin_ms * 0.001 * static_cast<double>(frequency));
+
+        uint64_t now = SDL_GetPerformanceCounter();
+        if (now + spinTicks < deadline) {
+            const uint64_t sleepTicks = deadline - spinTicks - now;
+            SDL_DelayNS(static_cast<Uint64>(static_cast<double>(sleepTicks) * 1e9 / static_cast<double>(frequency)));
+        }
+
+        while (SDL_GetPerformanceCounter() < deadline) {
+        }
     }
 
 
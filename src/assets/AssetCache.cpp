@@ -0,0 +1,210 @@
+#include "Blaze2D/assets/AssetCache.h"
+
+#include <stdexcept>
+#include <string>
+
+namespace blaze
+{
+    AssetCache::AssetCache(AssetLoader& loader, std::size_t budgetBytes)
+        : loader(loader), budget(budgetBytes), entries(loader.getManifest().getAll().size()),
+          generation(loader.getManifestGeneration()), reloads(loader.getReloadCount())
+    {
+    }
+
+    AssetHandle AssetCache::get(AssetId id)
+    {
+        sync();
+        if (!id || id.value >= entries.size())
+            throw std::out_of_range("AssetCache: asset id " + std::to_string(id.value) + " is not in the manifest");
+
+        Entry& entry = entries[id.value];
+        if (entry.handle) {
+            ++stats.hits;
+            unlink(id.value);
+            link(id.value);
+            return entry.handle;
+        }
+
+        ++stats.misses;
+        entry.handle = loader.load(id);
+        ++stats.entries;
+        link(id.value);
+        loading.push_back(id.value);
+        return entry.handle;
+    }
+
+    AssetHandle AssetCache::get(std::string_view name)
+    {
+        const AssetId id = loader.getManifest().find(name);
+        if (!id)
+            throw std::out_of_range("AssetCache: no asset named '" + std::string(name) + "'");
+        return get(id);
+    }
+
+    bool AssetCache::contains(AssetId id) const
+    {
+        return id && id.value < entries.size() && entries[id.value].handle;
+    }
+
+    std::size_t AssetCache::update()
+    {
+        sync();
+
+        std::size_t kept = 0;
+        for (uint32_t index : loading) {
+            Entry& entry = entries[index];
+            const AssetState state = entry.handle.getState();
+            if (state == AssetState::Ready || state == AssetState::Failed) {
+                entry.bytes = entry.handle.getMemorySize();
+                entry.accounted = true;
+                stats.bytes_resident += entry.bytes;
+            }
+            else {
+                loading[kept++] = index;
+            }
+        }
+        loading.resize(kept);
+
+        return trim();
+    }
+
+    std::size_t AssetCache::trim()
+    {
+        return stats.bytes_resident > budget ? evictUntil(budget) : 0;
+    }
+
+    std::size_t AssetCache::clear()
+    {
+        return evictUntil(0);
+    }
+
+    void AssetCache::setBudget(std::size_t budgetBytes)
+    {
+        budget = budgetBytes;
+        trim();
+    }
+
+    void AssetCache::sync()
+    {
+        if (loader.getManifestGeneration() != generation) {
+            generation = loader.getManifestGeneration();
+            rekey();
+        }
+        if (loader.getReloadCount() != reloads) {
+            reloads = loader.getReloadCount();
+            recount();
+        }
+    }
+
+    void AssetCache::rekey()
+    {
+        /*
+            Ids changed with the manifest; handles know their asset's new
+            id. Relinking from the least recently used end keeps the order.
+        */
+        std::vector<Entry> previous = std::move(entries);
+        const uint32_t oldTail = tail;
+        entries.assign(loader.getManifest().getAll().size(), Entry());
+        head = none;
+        tail = none;
+        loading.clear();
+
+        for (uint32_t index = oldTail; index != none; index = previous[index].prev) {
+            Entry& entry = previous[index];
+            const AssetId id = entry.handle.getId();
+            if (!id) {
+                if (entry.accounted)
+                    stats.bytes_resident -= entry.bytes;
+                --stats.entries;
+                ++stats.evictions;
+                continue;
+            }
+
+            Entry& moved = entries[id.value];
+            moved.handle = std::move(entry.handle);
+            moved.bytes = entry.bytes;
+            moved.accounted = entry.accounted;
+            link(id.value);
+            if (!moved.accounted)
+                loading.push_back(id.value);
+        }
+    }
+
+    void AssetCache::recount()
+    {
+        // Reloaded assets may have changed size.
+        for (uint32_t index = head; index != none; index = entries[index].next) {
+            Entry& entry = entries[index];
+            if (!entry.accounted)
+                continue;
+            const std::size_t bytes = entry.handle.getMemorySize();
+            stats.bytes_resident = stats.bytes_resident - entry.bytes + bytes;
+            entry.bytes = bytes;
+        }
+    }
+
+    void AssetCache::link(uint32_t index)
+    {
+        Entry& entry = entries[index];
+        entry.prev = none;
+        entry.next = head;
+        if (head != none)
+            entries[head].prev = index;
+        head = index;
+        if (tail == none)
+            tail = index;
+    }
+
+    void AssetCache::unlink(uint32_t index)
+    {
+        Entry& entry = entries[index];
+        if (entry.prev != none)
+            entries[entry.prev].next = entry.next;
+        else
+            head = entry.next;
+
+        if (entry.next != none)
+            entries[entry.next].prev = entry.prev;
+        else
+            tail = entry.prev;
+
+        entry.prev = none;
+        entry.next = none;
+    }
+
+    void AssetCache::evict(uint32_t index)
+    {
+        Entry& entry = entries[index];
+        unlink(index);
+        if (entry.accounted)
+            stats.bytes_resident -= entry.bytes;
+
+        // Last handle: frees the texture / surface / mapping.
+        entry = Entry();
+        --stats.entries;
+        ++stats.evictions;
+    }
+
+    std::size_t AssetCache::evictUntil(std::size_t limit)
+    {
+        /*
+            Walk from the least recently used end. Entries that are still
+            loading or that callers hold handles to are skipped; loading
+            ones are not counted yet, and evicting a held one would not
+            free anything.
+        */
+        std::size_t evicted = 0;
+        uint32_t index = tail;
+        while (index != none && (stats.bytes_resident > limit || limit == 0)) {
+            const uint32_t prev = entries[index].prev;
+            const Entry& entry = entries[index];
+            if (entry.accounted && entry.handle.getUseCount() == 1) {
+                evict(index);
+                ++evicted;
+            }
+            index = prev;
+        }
+        return evicted;
+    }
+
+} // namespace blaze
@@ -0,0 +1,468 @@
+#include "Blaze2D/assets/AssetLoader.h"
+#include "Blaze2D/internal/MappedFile.h"
+#include "Blaze2D/util/Profiler.h"
+
+#include <SDL3/SDL.h>
+#include <SDL3_image/SDL_image.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <stdexcept>
+#include <utility>
+
+namespace blaze
+{
+    namespace detail {
+
+        struct AssetSlot
+        {
+            // Main thread only.
+            AssetId id;
+            std::filesystem::path path;
+            bool image = false;
+
+            std::atomic<AssetState> state = AssetState::Queued;
+
+            // Main thread only; set when a DecodeResult is applied.
+            SDL_Surface* surface = nullptr;
+            SDL_Texture* texture = nullptr;
+            MappedFile data;
+            std::string error;
+            std::size_t bytes = 0;
+            uint32_t version = 0;
+
+            ~AssetSlot()
+            {
+                if (texture)
+                    SDL_DestroyTexture(texture);
+                if (surface)
+                    SDL_DestroySurface(surface);
+            }
+        };
+
+        // Output of one worker decode, applied to its slot on the main thread.
+        struct DecodeResult
+        {
+            std::shared_ptr<AssetSlot> slot;
+            SDL_Surface* surface = nullptr;
+            MappedFile data;
+            std::string error;
+
+            DecodeResult() = default;
+            DecodeResult(const DecodeResult&) = delete;
+            DecodeResult& operator=(const DecodeResult&) = delete;
+
+            ~DecodeResult()
+            {
+                if (surface)
+                    SDL_DestroySurface(surface);
+            }
+        };
+
+    } // namespace detail
+
+    namespace {
+
+        const std::string no_error;
+
+        std::size_t default_thread_count()
+        {
+            const unsigned hardware = std::thread::hardware_concurrency();
+            return hardware > 1 ? hardware - 1 : 1;
+        }
+
+        bool same_flags(const AssetFlags& a, const AssetFlags& b)
+        {
+            return std::equal(a.begin(), a.end(), b.begin(), b.end(), [](const AssetFlag& x, const AssetFlag& y) {
+                return x.key == y.key && x.value == y.value;
+            });
+        }
+
+    } // namespace
+
+    /* =========================
+       AssetHandle
+       ========================= */
+
+    AssetId AssetHandle::getId() const
+    {
+        return slot ? slot->id : AssetId{};
+    }
+
+    AssetState AssetHandle::getState() const
+    {
+        return slot ? slot->state.load(std::memory_order_acquire) : AssetState::Failed;
+    }
+
+    SDL_Texture* AssetHandle::getTexture() const
+    {
+        return ready() ? slot->texture : nullptr;
+    }
+
+    SDL_Surface* AssetHandle::getSurface() const
+    {
+        return ready() ? slot->surface : nullptr;
+    }
+
+    std::string_view AssetHandle::getData() const
+    {
+        return ready() ? slot->data.view() : std::string_view();
+    }
+
+    const std::string& AssetHandle::getError() const
+    {
+        return failed() && slot ? slot->error : no_error;
+    }
+
+    std::size_t AssetHandle::getMemorySize() const
+    {
+        return ready() ? slot->bytes : 0;
+    }
+
+    uint32_t AssetHandle::getVersion() const
+    {
+        return slot ? slot->version : 0;
+    }
+
+    /* =========================
+       AssetLoader
+       ========================= */
+
+    AssetLoader::AssetLoader(const Manifest& manifest, SDL_Renderer* renderer, const AssetLoaderOptions& options)
+        : manifest(&manifest), renderer(renderer), options(options), slots(manifest.getAll().size())
+    {
+        const std::size_t count = options.threads ? options.threads : default_thread_count();
+        workers.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+            workers.emplace_back([this] { workerLoop(); });
+    }
+
+    AssetLoader::~AssetLoader()
+    {
+        {
+            std::lock_guard lock(mutex);
+            stopping = true;
+        }
+        work_available.notify_all();
+        for (std::thread& worker : workers)
+            worker.join();
+    }
+
+    AssetHandle AssetLoader::load(AssetId id)
+    {
+        const AssetDescriptor& asset = manifest->get(id);
+
+        std::weak_ptr<detail::AssetSlot>& existing = slots[id.value];
+        if (std::shared_ptr<detail::AssetSlot> slot = existing.lock())
+            return AssetHandle(std::move(slot));
+
+        auto slot = std::make_shared<detail::AssetSlot>();
+        slot->id = id;
+        slot->path = manifest->resolvePath(asset);
+        slot->image = isImagePath(slot->path);
+        existing = slot;
+
+        enqueue(slot);
+        return AssetHandle(std::move(slot));
+    }
+
+    AssetHandle AssetLoader::load(std::string_view name)
+    {
+        const AssetId id = manifest->find(name);
+        if (!id)
+            throw std::out_of_range("AssetLoader: no asset named '" + std::string(name) + "'");
+        return load(id);
+    }
+
+    std::vector<AssetHandle> AssetLoader::loadType(std::string_view type)
+    {
+        std::span<const AssetDescriptor> assets = manifest->getByType(type);
+
+        std::vector<AssetHandle> handles;
+        handles.reserve(assets.size());
+        for (const AssetDescriptor& asset : assets)
+            handles.push_back(load(asset.id));
+        return handles;
+    }
+
+    std::size_t AssetLoader::update()
+    {
+        BLAZE_PROFILE_SCOPE("AssetLoader::update");
+        const uint64_t frequency = SDL_GetPerformanceFrequency();
+        const uint64_t start = SDL_GetPerformanceCounter();
+        const uint64_t budget = static_cast<uint64_t>(options.upload_budget_ms * 0.001 * static_cast<double>(frequency));
+
+        std::size_t finished = 0;
+        for (;;) {
+            std::unique_ptr<detail::DecodeResult> result;
+            {
+                std::lock_guard lock(mutex);
+                if (decoded.empty())
+                    break;
+                result = std::move(decoded.front());
+                decoded.pop_front();
+            }
+
+            // Nobody holds a handle any more; skip the upload.
+            if (result->slot.use_count() > 1)
+                finish(*result);
+            result.reset();
+
+            {
+                std::lock_guard lock(mutex);
+                --pending;
+            }
+            ++finished;
+
+            if (SDL_GetPerformanceCounter() - start >= budget)
+                break;
+        }
+        return finished;
+    }
+
+    void AssetLoader::wait(const AssetHandle& handle)
+    {
+        if (!handle)
+            throw std::invalid_argument("AssetLoader::wait: empty handle");
+
+        detail::AssetSlot& slot = *handle.slot;
+        if (slot.state.load(std::memory_order_acquire) >= AssetState::Ready)
+            return;
+
+        std::unique_ptr<detail::DecodeResult> result;
+        {
+            std::unique_lock lock(mutex);
+            decoded_available.wait(lock, [&] {
+                return slot.state.load(std::memory_order_acquire) == AssetState::Decoded;
+            });
+
+            auto it = std::find_if(decoded.begin(), decoded.end(), [&](const auto& r) { return r->slot == handle.slot; });
+            result = std::move(*it);
+            decoded.erase(it);
+            --pending;
+        }
+        finish(*result);
+    }
+
+    void AssetLoader::waitAll()
+    {
+        std::unique_lock lock(mutex);
+        while (pending > 0) {
+            decoded_available.wait(lock, [&] { return !decoded.empty() || pending == 0; });
+
+            while (!decoded.empty()) {
+                std::unique_ptr<detail::DecodeResult> result = std::move(decoded.front());
+                decoded.pop_front();
+                --pending;
+
+                lock.unlock();
+                if (result->slot.use_count() > 1)
+                    finish(*result);
+                result.reset();
+                lock.lock();
+            }
+        }
+    }
+
+    bool AssetLoader::reload(AssetId id)
+    {
+        manifest->get(id);
+
+        std::shared_ptr<detail::AssetSlot> slot = slots[id.value].lock();
+        if (!slot)
+            return false;
+
+        enqueue(slot);
+        return true;
+    }
+
+    ManifestDiff AssetLoader::setManifest(Manifest&& next)
+    {
+        auto owned = std::make_unique<Manifest>(std::move(next));
+        const Manifest& current = *manifest;
+
+        ManifestDiff diff;
+        std::vector<std::weak_ptr<detail::AssetSlot>> nextSlots(owned->getAll().size());
+        std::vector<uint8_t> kept(slots.size(), 0);
+
+        for (const AssetDescriptor& asset : owned->getAll()) {
+            const AssetId previous = current.find(asset.name);
+            if (!previous) {
+                diff.added.push_back(asset.id);
+                continue;
+            }
+            kept[previous.value] = 1;
+
+            const AssetDescriptor& old = current.get(previous);
+            const bool changed = old.type != asset.type || old.path != asset.path || !same_flags(old.flags, asset.flags);
+            if (changed)
+                diff.changed.push_back(asset.id);
+            else
+                ++diff.unchanged;
+
+            std::shared_ptr<detail::AssetSlot> slot = slots[previous.value].lock();
+            if (!slot)
+                continue;
+
+            slot->id = asset.id;
+            if (changed) {
+                slot->path = owned->resolvePath(asset);
+                slot->image = isImagePath(slot->path);
+                enqueue(slot);
+            }
+            nextSlots[asset.id.value] = std::move(slot);
+        }
+
+        for (std::size_t i = 0; i < kept.size(); ++i) {
+            if (kept[i])
+                continue;
+
+            const AssetDescriptor& removed = current.getAll()[i];
+            diff.removed.emplace_back(removed.name);
+            if (std::shared_ptr<detail::AssetSlot> slot = slots[i].lock())
+                slot->id = AssetId{};
+        }
+
+        slots = std::move(nextSlots);
+        owned_manifest = std::move(owned);
+        manifest = owned_manifest.get();
+        ++generation;
+        return diff;
+    }
+
+    std::size_t AssetLoader::getPendingCount() const
+    {
+        std::lock_guard lock(mutex);
+        return pending;
+    }
+
+    bool AssetLoader::isImagePath(const std::filesystem::path& path)
+    {
+        static constexpr std::array<std::string_view, 10> extensions = {
+            ".png", ".jpg", ".jpeg", ".bmp", ".gif", ".tga", ".webp", ".qoi", ".tif", ".tiff"
+        };
+
+        std::string extension = path.extension().string();
+        for (char& c : extension)
+            c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        return std::find(extensions.begin(), extensions.end(), extension) != extensions.end();
+    }
+
+    void AssetLoader::enqueue(const std::shared_ptr<detail::AssetSlot>& slot)
+    {
+        {
+            std::lock_guard lock(mutex);
+            queue.push_back({ slot, slot->path, slot->image });
+            ++pending;
+        }
+        work_available.notify_one();
+    }
+
+    void AssetLoader::workerLoop()
+    {
+        BLAZE_PROFILE_THREAD("AssetLoader worker");
+
+        for (;;) {
+            Job job;
+            auto result = std::make_unique<detail::DecodeResult>();
+            {
+                std::unique_lock lock(mutex);
+                work_available.wait(lock, [this] { return stopping || !queue.empty(); });
+                if (stopping)
+                    return;
+
+                job = std::move(queue.front());
+                queue.pop_front();
+                result->slot = job.slot.lock();
+
+                // Every handle was dropped before the load started.
+                if (!result->slot) {
+                    --pending;
+                    decoded_available.notify_all();
+                    continue;
+                }
+            }
+
+            // Only a first load reports progress; a reload keeps the slot Ready.
+            std::atomic<AssetState>& state = result->slot->state;
+            AssetState expected = AssetState::Queued;
+            state.compare_exchange_strong(expected, AssetState::Decoding, std::memory_order_relaxed);
+
+            try {
+                BLAZE_PROFILE_SCOPE("AssetLoader::decode");
+                if (job.image) {
+                    result->surface = IMG_Load(job.path.string().c_str());
+                    if (!result->surface)
+                        result->error = "Failed to decode image '" + job.path.string() + "': " + SDL_GetError();
+                }
+                else {
+                    result->data = options.map_files ? detail::MappedFile(job.path) : detail::MappedFile::read(job.path);
+                }
+            }
+            catch (const std::exception& e) {
+                result->error = e.what();
+            }
+
+            {
+                std::lock_guard lock(mutex);
+                expected = AssetState::Decoding;
+                state.compare_exchange_strong(expected, AssetState::Decoded, std::memory_order_release);
+                decoded.push_back(std::move(result));
+            }
+            decoded_available.notify_all();
+        }
+    }
+
+    void AssetLoader::finish(detail::DecodeResult& result)
+    {
+        BLAZE_PROFILE_SCOPE("AssetLoader::finish");
+        detail::AssetSlot& slot = *result.slot;
+        const AssetState previous = slot.state.load(std::memory_order_relaxed);
+
+        /*
+            Textures can only be created on the renderer's thread, which is
+            why decoding stops at a surface and this part runs here.
+        */
+        SDL_Texture* texture = nullptr;
+        if (result.error.empty() && result.surface && renderer) {
+            texture = SDL_CreateTextureFromSurface(renderer, result.surface);
+            if (!texture)
+                result.error = "Failed to create texture for '" + slot.path.string() + "': " + SDL_GetError();
+        }
+
+        if (!result.error.empty()) {
+            // A failed reload keeps the contents handles already use.
+            if (previous == AssetState::Ready) {
+                SDL_Log("Blaze2D: reloading '%s' failed: %s", slot.path.string().c_str(), result.error.c_str());
+                return;
+            }
+            slot.error = std::move(result.error);
+            slot.state.store(AssetState::Failed, std::memory_order_release);
+            return;
+        }
+
+        if (slot.texture)
+            SDL_DestroyTexture(slot.texture);
+        if (slot.surface)
+            SDL_DestroySurface(slot.surface);
+
+        slot.bytes = result.surface
+            ? static_cast<std::size_t>(result.surface->pitch) * static_cast<std::size_t>(result.surface->h)
+            : result.data.size();
+
+        slot.texture = texture;
+        slot.surface = nullptr;
+        if (!texture)
+            slot.surface = std::exchange(result.surface, nullptr);
+        slot.data = std::move(result.data);
+        slot.error.clear();
+        ++slot.version;
+
+        if (previous >= AssetState::Ready)
+            ++reloads;
+        slot.state.store(AssetState::Ready, std::memory_order_release);
+    }
+
+} // namespace blaze
@@ -0,0 +1,103 @@
+#include "Blaze2D/assets/HotReloader.h"
+#include "Blaze2D/util/Profiler.h"
+
+#include <SDL3/SDL.h>
+
+#include <algorithm>
+#include <exception>
+#include <vector>
+
+namespace blaze
+{
+    HotReloader::HotReloader(AssetLoader& loader)
+        : loader(loader), manifest_path(FileWatcher::normalize(loader.getManifest().getPath()))
+    {
+        watcher.watch(manifest_path);
+        for (const AssetDescriptor& asset : loader.getManifest().getAll())
+            watchAsset(asset);
+    }
+
+    std::size_t HotReloader::update()
+    {
+        std::span<const std::filesystem::path> files = watcher.poll();
+        if (files.empty())
+            return 0;
+
+        /*
+            The manifest goes first, so asset files changed in the same
+            frame are looked up by their new ids.
+        */
+        std::size_t count = 0;
+        if (std::find(files.begin(), files.end(), manifest_path) != files.end())
+            count += reloadManifest();
+
+        const Manifest& manifest = loader.getManifest();
+        for (const std::filesystem::path& file : files) {
+            auto [first, last] = names_by_file.equal_range(file.string());
+            for (auto it = first; it != last; ++it) {
+                const AssetId id = manifest.find(it->second);
+                if (id && loader.reload(id))
+                    ++count;
+            }
+        }
+        return count;
+    }
+
+    std::size_t HotReloader::reloadManifest()
+    {
+        BLAZE_PROFILE_SCOPE("HotReloader::reloadManifest");
+        try {
+            last_diff = loader.setManifest(Manifest(manifest_path, false));
+        }
+        catch (const std::exception& e) {
+            SDL_Log("Blaze2D: reloading manifest '%s' failed: %s", manifest_path.string().c_str(), e.what());
+            return 0;
+        }
+        ++manifest_reloads;
+
+        const Manifest& manifest = loader.getManifest();
+        for (const std::string& name : last_diff.removed)
+            unwatchAsset(name);
+        for (AssetId id : last_diff.changed) {
+            const AssetDescriptor& asset = manifest.get(id);
+            unwatchAsset(std::string(asset.name));
+            watchAsset(asset);
+        }
+        for (AssetId id : last_diff.added)
+            watchAsset(manifest.get(id));
+
+        return last_diff.added.size() + last_diff.changed.size() + last_diff.removed.size();
+    }
+
+    void HotReloader::watchAsset(const AssetDescriptor& asset)
+    {
+        std::string file = FileWatcher::normalize(loader.getManifest().resolvePath(asset)).string();
+        watcher.watch(file);
+        names_by_file.emplace(file, asset.name);
+        file_by_name.emplace(std::string(asset.name), std::move(file));
+    }
+
+    void HotReloader::unwatchAsset(const std::string& name)
+    {
+        auto entry = file_by_name.find(name);
+        if (entry == file_by_name.end())
+            return;
+
+        const std::string& file = entry->second;
+        auto [first, last] = names_by_file.equal_range(file);
+        std::size_t sharing = 0;
+        for (auto it = first; it != last;) {
+            if (it->second == name) {
+                it = names_by_file.erase(it);
+            }
+            else {
+                ++sharing;
+                ++it;
+            }
+        }
+        if (sharing == 0)
+            watcher.unwatch(file);
+        file_by_name.erase(entry);
+    }
+
+} // namespace blaze
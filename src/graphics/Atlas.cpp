@@ -1,10 +1,197 @@
 #include "Blaze2D/graphics/Atlas.h"
 #include "Blaze2D/util/Rect.h"
 #include "Blaze2D/internal/SDLManager.h"
+#include "Blaze2D/internal/JsonReader.h"
+#include "Blaze2D/internal/MappedFile.h"
 
+#include <SDL3_image/SDL_image.h>
+
+#include <stdexcept>
+#include <utility>
 
 namespace blaze
 {
+    using Token = detail::JsonReader::Token;
+
+    Atlas::Atlas(SDL_Renderer* renderer, const std::filesystem::path& jsonPath)
+    {
+        if (!renderer) {
+            throw std::runtime_error("Atlas requires a renderer");
+        }
+
+        /*
+            Parse the description straight from the mapped file.
+        */
+        std::filesystem::path imagePath;
+        {
+            detail::MappedFile file(jsonPath);
+            try {
+                parse(file.view(), imagePath);
+            }
+            catch (const std::runtime_error& e) {
+                throw std::runtime_error("Invalid atlas '" + jsonPath.string() + "': " + e.what());
+            }
+        }
+
+        /*
+            Create the single texture backing every sprite.
+        */
+        imagePath = jsonPath.parent_path() / imagePath;
+
+        SDL_Texture* texture = IMG_LoadTexture(renderer, imagePath.string().c_str());
+        if (!texture) {
+            throw std::runtime_error(
+                "Failed to load atlas image '" + imagePath.string() + "': " + SDL_GetError()
+            );
+        }
+
+        pages.push_back(texture);
+        SDL_GetTextureSize(texture, &width, &height);
+        spritePages.assign(rects.size(), 0);
+
+        try {
+            finalize();
+        }
+        catch (const std::runtime_error& e) {
+            release();
+            throw std::runtime_error(std::string(e.what()) + " in atlas: " + jsonPath.string());
+        }
+    }
+
+    void Atlas::finalize()
+    {
+        uvs.resize(rects.size());
+        for (std::size_t i = 0; i < rects.size(); ++i) {
+            const Rect& r = rects[i];
+            uvs[i] = Rect(r.x / width, r.y / height, r.w / width, r.h / height);
+        }
+
+        /*
+            Name lookup is only used to resolve ids, but keep it allocation-free
+            so tools can still look sprites up at runtime.
+        */
+        std::vector<std::string_view> keys(names.begin(), names.end());
+        try {
+            nameHash = detail::build_perfect_hash(keys);
+        }
+        catch (const detail::DuplicateKeyError& e) {
+            throw std::runtime_error("Duplicate sprite name '" + names[e.second] + "'");
+        }
+    }
+
+    /**
+ * @brief Read the atlas description in a single streaming pass.
+ *
+ * Unknown keys are skipped so descriptions may carry tool-specific data.
+ */
+    void Atlas::parse(std::string_view json, std::filesystem::path& imagePath)
+    {
+        detail::JsonReader reader(json);
+        reader.expect(Token::BeginObject);
+
+        for (Token token = reader.next(); token != Token::EndObject; token = reader.next()) {
+            std::string_view key = reader.string();
+
+            if (key == "image") {
+                reader.expect(Token::String);
+                imagePath = std::filesystem::path(reader.string());
+            }
+            else if (key == "sprites") {
+                reader.expect(Token::BeginObject);
+
+                for (Token sprite = reader.next(); sprite != Token::EndObject; sprite = reader.next()) {
+                    names.emplace_back(reader.string());
+
+                    Rect rect;
+                    reader.expect(Token::BeginObject);
+                    for (Token field = reader.next(); field != Token::EndObject; field = reader.next()) {
+                        std::string_view name = reader.string();
+                        if (name == "x")      rect.x = static_cast<float>(reader.expectNumber());
+                        else if (name == "y") rect.y = static_cast<float>(reader.expectNumber());
+                        else if (name == "w") rect.w = static_cast<float>(reader.expectNumber());
+                        else if (name == "h") rect.h = static_cast<float>(reader.expectNumber());
+                        else reader.skipValue();
+                    }
+
+                    rects.push_back(rect);
+                }
+            }
+            else {
+                reader.skipValue();
+            }
+        }
+
+        reader.expect(Token::End);
+
+        if (imagePath.empty()) {
+            throw std::runtime_error("missing \"image\"");
+        }
+    }
+
+    void Atlas::release()
+    {
+        for (SDL_Texture* page : pages)
+            SDL_DestroyTexture(page);
+        pages.clear();
+    }
+
+    Atlas::~Atlas()
+    {
+        release();
+    }
+
+    Atlas::Atlas(Atlas&& other) noexcept
+        : pages(std::move(other.pages)),
+          width(other.width),
+          height(other.height),
+          rects(std::move(other.rects)),
+          uvs(std::move(other.uvs)),
+          spritePages(std::move(other.spritePages)),
+          names(std::move(other.names)),
+          nameHash(std::move(other.nameHash))
+    {
+        other.pages.clear();
+    }
+
+    Atlas& Atlas::operator=(Atlas&& other) noexcept
+    {
+        if (this != &other) {
+            release();
+
+            pages = std::move(other.pages);
+            other.pages.clear();
+            width = other.width;
+            height = other.height;
+            rects = std::move(other.rects);
+            uvs = std::move(other.uvs);
+            spritePages = std::move(other.spritePages);
+            names = std::move(other.names);
+            nameHash = std::move(other.nameHash);
+        }
+        return *this;
+    }
+
+    SpriteId Atlas::find(std::string_view name) const
+    {
+        if (names.empty()) {
+            return {};
+        }
+
+        uint32_t id = nameHash.view().candidate(name);
+        if (names[id] != name) {
+            return {};
+        }
+
+        return SpriteId{ id };
+    }
+
+    void Atlas::draw(SDL_Renderer* renderer, SpriteId id, const Rect& dst) const
+    {
+        const Rect& src = rects[id.value];
+        const SDL_FRect srcRect{ src.x, src.y, src.w, src.h };
+        const SDL_FRect dstRect{ dst.x, dst.y, dst.w, dst.h };
 
+        SDL_RenderTexture(renderer, pages[spritePages[id.value]], &srcRect, &dstRect);
+    }
 
-} // namespace blaze
\ No newline at end of file
+} // namespace blaze
@@ -0,0 +1,191 @@
+#include "Blaze2D/graphics/AtlasBuilder.h"
+#include "Blaze2D/graphics/RectPacker.h"
+#include "Blaze2D/util/Manifest.h"
+#include "Blaze2D/internal/SDLManager.h"
+
+#include <SDL3_image/SDL_image.h>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace blaze
+{
+    namespace {
+
+        /*
+            Copy a w x h RGBA image to (dx, dy) and repeat its outermost
+            pixels 'extrude' times in every direction. Both images use
+            32-bit pixels; pitches are in pixels.
+        */
+        void blit_extruded(const uint32_t* src, int srcPitch, int w, int h,
+            uint32_t* dst, int dstPitch, int dx, int dy, int extrude)
+        {
+            for (int row = -extrude; row < h + extrude; ++row) {
+                const uint32_t* srcRow = src + std::clamp(row, 0, h - 1) * srcPitch;
+                uint32_t* dstRow = dst + (dy + row) * dstPitch + dx;
+
+                std::memcpy(dstRow, srcRow, sizeof(uint32_t) * w);
+                std::fill(dstRow - extrude, dstRow, srcRow[0]);
+                std::fill(dstRow + w, dstRow + w + extrude, srcRow[w - 1]);
+            }
+        }
+
+    } // namespace
+
+    AtlasBuilder::AtlasBuilder(AtlasBuilderOptions options)
+        : options(options)
+    {
+        if (options.page_width <= 0 || options.page_height <= 0 || options.padding < 0 || options.extrude < 0) {
+            throw std::invalid_argument("Invalid AtlasBuilder options");
+        }
+    }
+
+    AtlasBuilder::~AtlasBuilder()
+    {
+        for (Entry& entry : entries)
+            SDL_DestroySurface(entry.surface);
+    }
+
+    void AtlasBuilder::add(std::string_view name, SDL_Surface* surface)
+    {
+        if (!surface) {
+            throw std::invalid_argument("AtlasBuilder::add: null surface for '" + std::string(name) + "'");
+        }
+        entries.push_back({ std::string(name), surface });
+    }
+
+    void AtlasBuilder::addFile(std::string_view name, const std::filesystem::path& path)
+    {
+        SDL_Surface* surface = IMG_Load(path.string().c_str());
+        if (!surface) {
+            throw std::runtime_error("Failed to load image '" + path.string() + "': " + SDL_GetError());
+        }
+        add(name, surface);
+    }
+
+    void AtlasBuilder::addManifest(const Manifest& manifest, std::string_view type)
+    {
+        auto assets = manifest.getByType(type);
+        entries.reserve(entries.size() + assets.size());
+
+        for (const AssetDescriptor& asset : assets)
+            addFile(asset.name, manifest.resolvePath(asset));
+    }
+
+    Atlas AtlasBuilder::build(SDL_Renderer* renderer) const
+    {
+        if (!renderer) {
+            throw std::runtime_error("AtlasBuilder::build requires a renderer");
+        }
+
+        /*
+            Pack cells: each sprite plus its extrusion border, plus padding
+            on the right and bottom. The page is packed as if it were
+            'padding' larger so that cells on the far edges may drop their
+            trailing padding.
+        */
+        const int border = options.extrude;
+        std::vector<PackSize> sizes(entries.size());
+        for (std::size_t i = 0; i < entries.size(); ++i) {
+            sizes[i] = {
+                entries[i].surface->w + 2 * border + options.padding,
+                entries[i].surface->h + 2 * border + options.padding
+            };
+        }
+
+        std::vector<PackedRect> placements(entries.size());
+        uint32_t pageCount = 0;
+        try {
+            pageCount = pack_rects(sizes,
+                options.page_width + options.padding, options.page_height + options.padding, placements);
+        }
+        catch (const std::invalid_argument& e) {
+            throw std::runtime_error(std::string("AtlasBuilder: ") + e.what());
+        }
+
+        /*
+            Compose the pages on the CPU.
+        */
+        std::vector<SDL_Surface*> pageSurfaces;
+        auto destroyPages = [&pageSurfaces]() {
+            for (SDL_Surface* page : pageSurfaces)
+                SDL_DestroySurface(page);
+        };
+
+        for (uint32_t p = 0; p < pageCount; ++p) {
+            SDL_Surface* page = SDL_CreateSurface(options.page_width, options.page_height, SDL_PIXELFORMAT_RGBA32);
+            if (!page) {
+                destroyPages();
+                throw std::runtime_error(std::string("Failed to create atlas page: ") + SDL_GetError());
+            }
+            SDL_FillSurfaceRect(page, nullptr, 0);
+            pageSurfaces.push_back(page);
+        }
+
+        Atlas atlas;
+        atlas.width = static_cast<float>(options.page_width);
+        atlas.height = static_cast<float>(options.page_height);
+        atlas.rects.resize(entries.size());
+        atlas.spritePages.resize(entries.size());
+        atlas.names.reserve(entries.size());
+
+        for (std::size_t i = 0; i < entries.size(); ++i) {
+            const PackedRect& placed = placements[i];
+            SDL_Surface* source = entries[i].surface;
+            const int w = source->w;
+            const int h = source->h;
+
+            atlas.names.push_back(entries[i].name);
+            atlas.spritePages[i] = placed.page;
+            atlas.rects[i] = Rect(
+                static_cast<float>(placed.x + border), static_cast<float>(placed.y + border),
+                static_cast<float>(w), static_cast<float>(h)
+            );
+
+            if (w == 0 || h == 0)
+                continue;
+
+            SDL_Surface* rgba = source->format == SDL_PIXELFORMAT_RGBA32
+                ? source
+                : SDL_ConvertSurface(source, SDL_PIXELFORMAT_RGBA32);
+            if (!rgba) {
+                destroyPages();
+                throw std::runtime_error("Failed to convert sprite '" + entries[i].name + "': " + SDL_GetError());
+            }
+
+            SDL_Surface* page = pageSurfaces[placed.page];
+            SDL_LockSurface(rgba);
+            SDL_LockSurface(page);
+
+            blit_extruded(
+                static_cast<const uint32_t*>(rgba->pixels), rgba->pitch / 4, w, h,
+                static_cast<uint32_t*>(page->pixels), page->pitch / 4,
+                placed.x + border, placed.y + border, border
+            );
+
+            SDL_UnlockSurface(page);
+            SDL_UnlockSurface(rgba);
+
+            if (rgba != source)
+                SDL_DestroySurface(rgba);
+        }
+
+        /*
+            Upload one texture per page.
+        */
+        for (SDL_Surface* page : pageSurfaces) {
+            SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, page);
+            if (!texture) {
+                destroyPages();
+                throw std::runtime_error(std::string("Failed to upload atlas page: ") + SDL_GetError());
+            }
+            atlas.pages.push_back(texture);
+        }
+        destroyPages();
+
+        atlas.finalize();
+        return atlas;
+    }
+
+} // namespace blaze
@@ -0,0 +1,297 @@
+#include "Blaze2D/graphics/CommandBuffer.h"
+#include "Blaze2D/internal/SDLManager.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <type_traits>
+
+namespace blaze
+{
+    namespace {
+
+        struct ClearCommand
+        {
+            Color color;
+        };
+
+        struct FillRectCommand
+        {
+            Color color;
+            Rect rect;
+        };
+
+        // Followed by 'count' Rects.
+        struct FillRectsCommand
+        {
+            Color color;
+            uint32_t count;
+        };
+
+        struct TextureCommand
+        {
+            SDL_Texture* texture;
+            Rect src;
+            Rect dst;
+            bool whole;
+        };
+
+        // Followed by 'count' Vertices.
+        struct QuadsCommand
+        {
+            SDL_Texture* texture;
+            uint32_t count;
+        };
+
+        struct ClipCommand
+        {
+            Rect rect;
+            bool enabled;
+        };
+
+        struct BlendModeCommand
+        {
+            uint32_t mode;
+        };
+
+        constexpr std::size_t align8(std::size_t bytes)
+        {
+            return (bytes + 7) & ~std::size_t(7);
+        }
+
+        SDL_FRect to_sdl(const Rect& rect)
+        {
+            return { rect.x, rect.y, rect.w, rect.h };
+        }
+
+        // Clip rects are whole pixels, so round outwards.
+        SDL_Rect to_pixels(const Rect& rect)
+        {
+            const float left = std::floor(rect.left());
+            const float top = std::floor(rect.top());
+            return { int(left), int(top), int(std::ceil(rect.right()) - left), int(std::ceil(rect.bottom()) - top) };
+        }
+
+        // Empty, but still a clip, when they do not overlap.
+        SDL_Rect intersect(const SDL_Rect& a, const SDL_Rect& b)
+        {
+            const int left = std::max(a.x, b.x);
+            const int top = std::max(a.y, b.y);
+            const int right = std::min(a.x + a.w, b.x + b.w);
+            const int bottom = std::min(a.y + a.h, b.y + b.h);
+            return { left, top, std::max(right - left, 0), std::max(bottom - top, 0) };
+        }
+
+    } // namespace
+
+    template <typename T>
+    void CommandBuffer::push(Op op, const T& command, const void* extra, std::size_t extraBytes)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+
+        /*
+            Header, command and trailing data are laid out back to back,
+            each starting on an 8 byte boundary, so replay can read them in
+            place. The vector's storage comes from operator new and is
+            aligned for anything stored here.
+        */
+        const std::size_t commandOffset = align8(sizeof(Header));
+        const std::size_t extraOffset = commandOffset + align8(sizeof(T));
+        const std::size_t size = align8(extraOffset + extraBytes);
+
+        const std::size_t start = data.size();
+        data.resize(start + size);
+
+        std::byte* out = data.data() + start;
+        const Header header{ op, static_cast<uint32_t>(size) };
+        std::memcpy(out, &header, sizeof(header));
+        std::memcpy(out + commandOffset, &command, sizeof(T));
+        if (extraBytes)
+            std::memcpy(out + extraOffset, extra, extraBytes);
+        ++count;
+    }
+
+    void CommandBuffer::reset()
+    {
+        data.clear();
+        count = 0;
+    }
+
+    void CommandBuffer::clear(const Color& color)
+    {
+        push(Op::Clear, ClearCommand{ color });
+    }
+
+    void CommandBuffer::fillRect(const Rect& rect, const Color& color)
+    {
+        push(Op::FillRect, FillRectCommand{ color, rect });
+    }
+
+    void CommandBuffer::fillRects(std::span<const Rect> rects, const Color& color)
+    {
+        if (rects.empty())
+            return;
+        push(Op::FillRects, FillRectsCommand{ color, static_cast<uint32_t>(rects.size()) }, rects.data(), rects.size_bytes());
+    }
+
+    void CommandBuffer::drawTexture(SDL_Texture* texture, const Rect& dst)
+    {
+        push(Op::Texture, TextureCommand{ texture, Rect(), dst, true });
+    }
+
+    void CommandBuffer::drawTexture(SDL_Texture* texture, const Rect& src, const Rect& dst)
+    {
+        push(Op::Texture, TextureCommand{ texture, src, dst, false });
+    }
+
+    void CommandBuffer::drawQuads(SDL_Texture* texture, std::span<const Vertex> vertices)
+    {
+        if (vertices.size() < 4)
+            return;
+        const std::size_t used = vertices.size() - vertices.size() % 4;
+        push(Op::Quads, QuadsCommand{ texture, static_cast<uint32_t>(used) }, vertices.data(), used * sizeof(Vertex));
+    }
+
+    void CommandBuffer::setClip(const Rect& rect)
+    {
+        push(Op::Clip, ClipCommand{ rect, true });
+    }
+
+    void CommandBuffer::resetClip()
+    {
+        push(Op::Clip, ClipCommand{ Rect(), false });
+    }
+
+    void CommandBuffer::setBlendMode(uint32_t mode)
+    {
+        push(Op::BlendMode, BlendModeCommand{ mode });
+    }
+
+    std::size_t CommandBuffer::replay(SDL_Renderer* renderer)
+    {
+        return replayInto(renderer, nullptr);
+    }
+
+    std::size_t CommandBuffer::replay(SDL_Renderer* renderer, const Rect& paintRect)
+    {
+        const SDL_Rect bound = to_pixels(paintRect);
+        SDL_SetRenderClipRect(renderer, &bound);
+        return replayInto(renderer, &bound);
+    }
+
+    std::size_t CommandBuffer::replayInto(SDL_Renderer* renderer, const SDL_Rect* bound)
+    {
+        static_assert(sizeof(Vertex) == sizeof(SDL_Vertex));
+        static_assert(offsetof(Vertex, r) == offsetof(SDL_Vertex, color));
+        static_assert(offsetof(Vertex, u) == offsetof(SDL_Vertex, tex_coord));
+        static_assert(sizeof(Rect) == sizeof(SDL_FRect));
+
+        constexpr std::size_t commandOffset = align8(sizeof(Header));
+
+        // Clip in effect while painting into 'bound'.
+        SDL_Rect clip = bound ? *bound : SDL_Rect{};
+
+        const std::byte* at = data.data();
+        const std::byte* end = at + data.size();
+        while (at < end) {
+            Header header;
+            std::memcpy(&header, at, sizeof(header));
+            const std::byte* command = at + commandOffset;
+
+            switch (header.op) {
+            case Op::Clear: {
+                const auto& clear = *reinterpret_cast<const ClearCommand*>(command);
+                set_render_draw_color(renderer, clear.color);
+                if (!bound) {
+                    SDL_RenderClear(renderer);
+                    break;
+                }
+
+                /*
+                    SDL_RenderClear ignores the clip rect and would wipe the
+                    whole target. Overwrite the paint rect instead, whatever
+                    clip and blend mode were recorded before.
+                */
+                const SDL_FRect fill = { float(bound->x), float(bound->y), float(bound->w), float(bound->h) };
+                SDL_BlendMode blend = SDL_BLENDMODE_NONE;
+                SDL_GetRenderDrawBlendMode(renderer, &blend);
+                SDL_SetRenderClipRect(renderer, bound);
+                SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+                SDL_RenderFillRect(renderer, &fill);
+                SDL_SetRenderDrawBlendMode(renderer, blend);
+                SDL_SetRenderClipRect(renderer, &clip);
+                break;
+            }
+            case Op::FillRect: {
+                const auto& fill = *reinterpret_cast<const FillRectCommand*>(command);
+                const SDL_FRect rect = to_sdl(fill.rect);
+                set_render_draw_color(renderer, fill.color);
+                SDL_RenderFillRect(renderer, &rect);
+                break;
+            }
+            case Op::FillRects: {
+                const auto& fill = *reinterpret_cast<const FillRectsCommand*>(command);
+                const auto* rects = reinterpret_cast<const SDL_FRect*>(command + align8(sizeof(FillRectsCommand)));
+                set_render_draw_color(renderer, fill.color);
+                SDL_RenderFillRects(renderer, rects, static_cast<int>(fill.count));
+                break;
+            }
+            case Op::Texture: {
+                const auto& draw = *reinterpret_cast<const TextureCommand*>(command);
+                const SDL_FRect src = to_sdl(draw.src);
+                const SDL_FRect dst = to_sdl(draw.dst);
+                SDL_RenderTexture(renderer, draw.texture, draw.whole ? nullptr : &src, &dst);
+                break;
+            }
+            case Op::Quads: {
+                const auto& quads = *reinterpret_cast<const QuadsCommand*>(command);
+                const auto* vertices = reinterpret_cast<const SDL_Vertex*>(command + align8(sizeof(QuadsCommand)));
+
+                // Same pattern for every quad, as in SpriteBatch.
+                const std::size_t quadCount = quads.count / 4;
+                const std::size_t built = quad_indices.size() / 6;
+                if (built < quadCount) {
+                    quad_indices.resize(quadCount * 6);
+                    for (std::size_t quad = built; quad < quadCount; ++quad) {
+                        const int base = static_cast<int>(quad * 4);
+                        int* out = quad_indices.data() + quad * 6;
+                        out[0] = base;
+                        out[1] = base + 1;
+                        out[2] = base + 2;
+                        out[3] = base + 2;
+                        out[4] = base + 3;
+                        out[5] = base;
+                    }
+                }
+                SDL_RenderGeometry(renderer, quads.texture, vertices, static_cast<int>(quads.count),
+                    quad_indices.data(), static_cast<int>(quadCount * 6));
+                break;
+            }
+            case Op::Clip: {
+                const auto& set = *reinterpret_cast<const ClipCommand*>(command);
+                if (bound) {
+                    clip = set.enabled ? intersect(to_pixels(set.rect), *bound) : *bound;
+                    SDL_SetRenderClipRect(renderer, &clip);
+                }
+                else if (set.enabled) {
+                    const SDL_Rect rect = to_pixels(set.rect);
+                    SDL_SetRenderClipRect(renderer, &rect);
+                }
+                else {
+                    SDL_SetRenderClipRect(renderer, nullptr);
+                }
+                break;
+            }
+            case Op::BlendMode: {
+                const auto& blend = *reinterpret_cast<const BlendModeCommand*>(command);
+                SDL_SetRenderDrawBlendMode(renderer, static_cast<SDL_BlendMode>(blend.mode));
+                break;
+            }
+            }
+
+            at += header.size;
+        }
+        return count;
+    }
+
+} // namespace blaze
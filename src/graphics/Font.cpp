@@ -0,0 +1,342 @@
+#include "Blaze2D/graphics/Font.h"
+#include "Blaze2D/internal/SDLManager.h"
+#include "Blaze2D/internal/MappedFile.h"
+
+#include <SDL3_image/SDL_image.h>
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cstdlib>
+#include <stdexcept>
+
+namespace blaze
+{
+    namespace {
+
+        std::atomic<uint64_t> next_font_id{ 1 };
+
+        inline bool is_blank(char c)
+        {
+            return c == ' ' || c == '\t' || c == '\r';
+        }
+
+        inline uint64_t kerning_pair(char32_t first, char32_t second)
+        {
+            return (uint64_t(first) << 32) | uint64_t(second);
+        }
+
+        /*
+            Splits the next 'key=value' out of 'line', advancing past it.
+            Quoted values may contain spaces; the quotes are dropped.
+            Returns false at the end of the line.
+        */
+        bool next_attribute(std::string_view& line, std::string_view& key, std::string_view& value)
+        {
+            std::size_t pos = 0;
+            while (pos < line.size() && is_blank(line[pos]))
+                ++pos;
+            if (pos == line.size())
+                return false;
+
+            const std::size_t keyStart = pos;
+            while (pos < line.size() && line[pos] != '=' && !is_blank(line[pos]))
+                ++pos;
+            key = line.substr(keyStart, pos - keyStart);
+
+            value = {};
+            if (pos < line.size() && line[pos] == '=') {
+                ++pos;
+                if (pos < line.size() && line[pos] == '"') {
+                    const std::size_t close = line.find('"', pos + 1);
+                    if (close == std::string_view::npos)
+                        throw std::runtime_error("unterminated string");
+                    value = line.substr(pos + 1, close - pos - 1);
+                    pos = close + 1;
+                }
+                else {
+                    const std::size_t valueStart = pos;
+                    while (pos < line.size() && !is_blank(line[pos]))
+                        ++pos;
+                    value = line.substr(valueStart, pos - valueStart);
+                }
+            }
+
+            line.remove_prefix(pos);
+            return true;
+        }
+
+        int to_int(std::string_view key, std::string_view value)
+        {
+            int result = 0;
+            auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), result);
+            if (error != std::errc() || end != value.data() + value.size())
+                throw std::runtime_error("invalid number for '" + std::string(key) + "'");
+            return result;
+        }
+
+    } // namespace
+
+    Font::Font(const std::filesystem::path& fntPath)
+        : id(next_font_id.fetch_add(1, std::memory_order_relaxed))
+    {
+        std::vector<std::string> files;
+        {
+            detail::MappedFile file(fntPath);
+            try {
+                parse(file.view(), &files);
+            }
+            catch (const std::runtime_error& e) {
+                throw std::runtime_error("Invalid font '" + fntPath.string() + "': " + e.what());
+            }
+        }
+
+        try {
+            for (const std::string& name : files) {
+                if (name.empty())
+                    throw std::runtime_error("Font '" + fntPath.string() + "' has a page without a file");
+
+                const std::filesystem::path pagePath = fntPath.parent_path() / name;
+                SDL_Surface* surface = IMG_Load(pagePath.string().c_str());
+                if (!surface) {
+                    throw std::runtime_error(
+                        "Failed to load font page '" + pagePath.string() + "': " + SDL_GetError()
+                    );
+                }
+                adoptPage(surface);
+            }
+            finalize();
+        }
+        catch (...) {
+            release();
+            throw;
+        }
+    }
+
+    Font::Font(std::string_view description, std::vector<SDL_Surface*> surfaces)
+        : id(next_font_id.fetch_add(1, std::memory_order_relaxed))
+    {
+        try {
+            parse(description, nullptr);
+        }
+        catch (const std::runtime_error& e) {
+            for (SDL_Surface* surface : surfaces)
+                SDL_DestroySurface(surface);
+            throw std::runtime_error(std::string("Invalid font: ") + e.what());
+        }
+
+        try {
+            for (std::size_t i = 0; i < surfaces.size(); ++i) {
+                SDL_Surface* surface = surfaces[i];
+                surfaces[i] = nullptr;
+                adoptPage(surface);
+            }
+            finalize();
+        }
+        catch (...) {
+            for (SDL_Surface* surface : surfaces)
+                SDL_DestroySurface(surface);
+            release();
+            throw;
+        }
+    }
+
+    Font::~Font()
+    {
+        release();
+    }
+
+    void Font::release()
+    {
+        for (SDL_Surface* page : pages)
+            SDL_DestroySurface(page);
+        pages.clear();
+    }
+
+    /**
+     * @brief Read the description line by line.
+     *
+     * Unknown tags and attributes are skipped, so files from any BMFont
+     * exporter load; only the text format is supported, not the binary one.
+     */
+    void Font::parse(std::string_view text, std::vector<std::string>* files)
+    {
+        std::size_t lineNumber = 0;
+        std::size_t pos = 0;
+        while (pos < text.size()) {
+            std::size_t end = text.find('\n', pos);
+            if (end == std::string_view::npos)
+                end = text.size();
+            std::string_view line = text.substr(pos, end - pos);
+            pos = end + 1;
+            ++lineNumber;
+
+            try {
+                std::string_view tag;
+                std::string_view key;
+                std::string_view value;
+                if (!next_attribute(line, tag, value))
+                    continue;
+
+                if (tag == "info") {
+                    while (next_attribute(line, key, value)) {
+                        if (key == "face")      face = std::string(value);
+                        else if (key == "size") size = float(std::abs(to_int(key, value)));
+                    }
+                }
+                else if (tag == "common") {
+                    while (next_attribute(line, key, value)) {
+                        if (key == "lineHeight") lineHeight = float(to_int(key, value));
+                        else if (key == "base")  base = float(to_int(key, value));
+                    }
+                }
+                else if (tag == "page") {
+                    int pageId = -1;
+                    std::string_view file;
+                    while (next_attribute(line, key, value)) {
+                        if (key == "id")        pageId = to_int(key, value);
+                        else if (key == "file") file = value;
+                    }
+                    if (pageId < 0)
+                        throw std::runtime_error("page without an id");
+                    if (files) {
+                        if (files->size() <= std::size_t(pageId))
+                            files->resize(std::size_t(pageId) + 1);
+                        (*files)[pageId] = std::string(file);
+                    }
+                }
+                else if (tag == "char") {
+                    Glyph glyph;
+                    int codepoint = -1;
+                    while (next_attribute(line, key, value)) {
+                        if (key == "id")            codepoint = to_int(key, value);
+                        else if (key == "x")        glyph.src.x = float(to_int(key, value));
+                        else if (key == "y")        glyph.src.y = float(to_int(key, value));
+                        else if (key == "width")    glyph.src.w = float(to_int(key, value));
+                        else if (key == "height")   glyph.src.h = float(to_int(key, value));
+                        else if (key == "xoffset")  glyph.offset.x = float(to_int(key, value));
+                        else if (key == "yoffset")  glyph.offset.y = float(to_int(key, value));
+                        else if (key == "xadvance") glyph.advance = float(to_int(key, value));
+                        else if (key == "page")     glyph.page = uint32_t(to_int(key, value));
+                    }
+                    if (codepoint < 0)
+                        throw std::runtime_error("char without an id");
+                    glyph.codepoint = char32_t(codepoint);
+                    glyphs.push_back(glyph);
+                }
+                else if (tag == "kerning") {
+                    int first = -1;
+                    int second = -1;
+                    int amount = 0;
+                    while (next_attribute(line, key, value)) {
+                        if (key == "first")       first = to_int(key, value);
+                        else if (key == "second") second = to_int(key, value);
+                        else if (key == "amount") amount = to_int(key, value);
+                    }
+                    if (first < 0 || second < 0)
+                        throw std::runtime_error("kerning without a pair");
+                    if (amount != 0)
+                        kernings.push_back({ kerning_pair(char32_t(first), char32_t(second)), float(amount) });
+                }
+            }
+            catch (const std::runtime_error& e) {
+                throw std::runtime_error(std::string(e.what()) + " on line " + std::to_string(lineNumber));
+            }
+        }
+
+        if (lineHeight <= 0.0f)
+            throw std::runtime_error("missing \"common lineHeight\"");
+    }
+
+    void Font::adoptPage(SDL_Surface* surface)
+    {
+        if (!surface)
+            throw std::runtime_error("Font page is null");
+
+        if (surface->format != SDL_PIXELFORMAT_RGBA32) {
+            const bool hasAlpha = SDL_ISPIXELFORMAT_ALPHA(surface->format);
+            SDL_Surface* converted = SDL_ConvertSurface(surface, SDL_PIXELFORMAT_RGBA32);
+            SDL_DestroySurface(surface);
+            if (!converted)
+                throw std::runtime_error(std::string("SDL_ConvertSurface failed: ") + SDL_GetError());
+            surface = converted;
+
+            /*
+                Opaque pages hold coverage in their brightness. Move it to
+                alpha over white so glyphs blend and take the tint color.
+            */
+            if (!hasAlpha) {
+                for (int y = 0; y < surface->h; ++y) {
+                    uint8_t* pixel = static_cast<uint8_t*>(surface->pixels) + std::size_t(y) * std::size_t(surface->pitch);
+                    for (int x = 0; x < surface->w; ++x, pixel += 4) {
+                        pixel[3] = pixel[0];
+                        pixel[0] = pixel[1] = pixel[2] = 255;
+                    }
+                }
+            }
+        }
+
+        pages.push_back(surface);
+    }
+
+    void Font::finalize()
+    {
+        for (const Glyph& glyph : glyphs) {
+            if (glyph.page >= pages.size())
+                throw std::runtime_error("Font glyph " + std::to_string(uint32_t(glyph.codepoint)) + " is on a missing page");
+
+            const SDL_Surface* page = pages[glyph.page];
+            if (glyph.src.x < 0.0f || glyph.src.y < 0.0f || glyph.src.w < 0.0f || glyph.src.h < 0.0f
+                || glyph.src.right() > float(page->w) || glyph.src.bottom() > float(page->h))
+                throw std::runtime_error("Font glyph " + std::to_string(uint32_t(glyph.codepoint)) + " lies outside its page");
+        }
+
+        // Later duplicates win, as in the exporters that produce them.
+        std::stable_sort(glyphs.begin(), glyphs.end(), [](const Glyph& a, const Glyph& b) {
+            return a.codepoint < b.codepoint;
+        });
+        auto last = std::unique(glyphs.rbegin(), glyphs.rend(), [](const Glyph& a, const Glyph& b) {
+            return a.codepoint == b.codepoint;
+        });
+        glyphs.erase(glyphs.begin(), last.base());
+
+        std::sort(kernings.begin(), kernings.end(), [](const Kerning& a, const Kerning& b) {
+            return a.pair < b.pair;
+        });
+
+        std::fill(std::begin(ascii), std::end(ascii), no_glyph);
+        for (std::size_t i = 0; i < glyphs.size() && glyphs[i].codepoint < 128; ++i)
+            ascii[glyphs[i].codepoint] = uint32_t(i);
+
+        fallback = no_glyph;
+        fallback = findGlyph(U'?');
+    }
+
+    uint32_t Font::findGlyph(char32_t codepoint) const
+    {
+        if (codepoint < 128) {
+            const uint32_t index = ascii[codepoint];
+            return index != no_glyph ? index : fallback;
+        }
+
+        auto it = std::lower_bound(glyphs.begin(), glyphs.end(), codepoint, [](const Glyph& glyph, char32_t value) {
+            return glyph.codepoint < value;
+        });
+        if (it == glyphs.end() || it->codepoint != codepoint)
+            return fallback;
+        return uint32_t(it - glyphs.begin());
+    }
+
+    float Font::getKerning(char32_t first, char32_t second) const
+    {
+        if (kernings.empty())
+            return 0.0f;
+
+        const uint64_t pair = kerning_pair(first, second);
+        auto it = std::lower_bound(kernings.begin(), kernings.end(), pair, [](const Kerning& kerning, uint64_t value) {
+            return kerning.pair < value;
+        });
+        return (it != kernings.end() && it->pair == pair) ? it->amount : 0.0f;
+    }
+
+} // namespace blaze
@@ -0,0 +1,86 @@
+#include "Blaze2D/graphics/FrameTimeGraph.h"
+#include "Blaze2D/internal/SDLManager.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+
+namespace blaze
+{
+    FrameTimeGraph::FrameTimeGraph(std::size_t frames, double budgetMs)
+        : samples(frames), budget_ms(budgetMs)
+    {
+        if (frames == 0)
+            throw std::invalid_argument("FrameTimeGraph: frame count must be positive");
+
+        under.reserve(frames);
+        over.reserve(frames);
+    }
+
+    void FrameTimeGraph::push(double frameMs)
+    {
+        samples[next] = frameMs;
+        next = (next + 1) % samples.size();
+        count = std::min(count + 1, samples.size());
+    }
+
+    double FrameTimeGraph::getAverage() const
+    {
+        if (count == 0)
+            return 0.0;
+
+        double sum = 0.0;
+        for (std::size_t i = 0; i < count; ++i)
+            sum += samples[i];
+        return sum / static_cast<double>(count);
+    }
+
+    double FrameTimeGraph::getMax() const
+    {
+        return count ? *std::max_element(samples.begin(), samples.begin() + count) : 0.0;
+    }
+
+    void FrameTimeGraph::draw(SDL_Renderer* renderer, const Rect& area)
+    {
+        static_assert(sizeof(Rect) == sizeof(SDL_FRect));
+        static_assert(offsetof(Rect, w) == offsetof(SDL_FRect, w));
+
+        /*
+            Twice the budget fills the height, so the budget line sits in
+            the middle; longer frames are clipped to the top.
+        */
+        const float scale = budget_ms > 0.0 ? area.h / static_cast<float>(budget_ms * 2.0) : 0.0f;
+        const float barWidth = area.w / static_cast<float>(samples.size());
+
+        under.clear();
+        over.clear();
+        const std::size_t oldest = count < samples.size() ? 0 : next;
+        const float firstBar = area.right() - barWidth * static_cast<float>(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            const double ms = samples[(oldest + i) % samples.size()];
+            const float height = std::min(area.h, static_cast<float>(ms) * scale);
+            const Rect bar(firstBar + barWidth * static_cast<float>(i), area.bottom() - height, barWidth, height);
+            (ms > budget_ms ? over : under).push_back(bar);
+        }
+
+        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+
+        const SDL_FRect background = { area.x, area.y, area.w, area.h };
+        set_render_draw_color(renderer, background_color);
+        SDL_RenderFillRect(renderer, &background);
+
+        if (!under.empty()) {
+            set_render_draw_color(renderer, under_color);
+            SDL_RenderFillRects(renderer, reinterpret_cast<const SDL_FRect*>(under.data()), static_cast<int>(under.size()));
+        }
+        if (!over.empty()) {
+            set_render_draw_color(renderer, over_color);
+            SDL_RenderFillRects(renderer, reinterpret_cast<const SDL_FRect*>(over.data()), static_cast<int>(over.size()));
+        }
+
+        const SDL_FRect budgetLine = { area.x, area.y + area.h * 0.5f, area.w, 1.0f };
+        set_render_draw_color(renderer, budget_color);
+        SDL_RenderFillRect(renderer, &budgetLine);
+    }
+
+} // namespace blaze
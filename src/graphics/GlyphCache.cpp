@@ -0,0 +1,164 @@
+#include "Blaze2D/graphics/GlyphCache.h"
+#include "Blaze2D/graphics/Font.h"
+#include "Blaze2D/internal/SDLManager.h"
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace blaze
+{
+    GlyphCache::GlyphCache(SDL_Renderer* renderer, GlyphCacheOptions options)
+        : renderer(renderer), options(options)
+    {
+        if (!renderer) {
+            throw std::runtime_error("GlyphCache requires a renderer");
+        }
+        if (options.page_size <= 0 || options.max_pages == 0 || options.padding < 0) {
+            throw std::invalid_argument("Invalid GlyphCache options");
+        }
+        pages.reserve(options.max_pages);
+    }
+
+    GlyphCache::~GlyphCache()
+    {
+        for (Page& page : pages) {
+            SDL_DestroyTexture(page.texture);
+            SDL_DestroySurface(page.surface);
+        }
+    }
+
+    CachedGlyph GlyphCache::get(const Font& font, uint32_t glyph)
+    {
+        const Key key{ font.getId(), glyph };
+        if (auto it = glyphs.find(key); it != glyphs.end()) {
+            ++stats.hits;
+            pages[it->second.page].last_used = frame;
+            return it->second;
+        }
+
+        const Rect& src = font.getGlyph(glyph).src;
+        const int w = int(src.w) + options.padding;
+        const int h = int(src.h) + options.padding;
+        if (src.empty())
+            throw std::invalid_argument("GlyphCache::get: glyph " + std::to_string(glyph) + " is empty");
+        if (w > options.page_size || h > options.page_size)
+            throw std::invalid_argument("GlyphCache::get: glyph " + std::to_string(glyph) + " is larger than a page");
+
+        ++stats.misses;
+
+        int x = 0;
+        int y = 0;
+        for (uint32_t i = 0; i < pages.size(); ++i) {
+            if (pages[i].packer.insert(w, h, x, y))
+                return upload(font, glyph, i, x, y);
+        }
+
+        /*
+            Every page is full. Below the limit add one; at it recycle the
+            page that went unused the longest, unless all of them are in use
+            this frame.
+        */
+        Page* victim = nullptr;
+        if (pages.size() >= options.max_pages) {
+            for (Page& page : pages) {
+                if (page.last_used < frame && (!victim || page.last_used < victim->last_used))
+                    victim = &page;
+            }
+        }
+
+        uint32_t index;
+        if (victim) {
+            recycle(*victim);
+            ++stats.evictions;
+            index = uint32_t(victim - pages.data());
+        }
+        else {
+            addPage();
+            index = uint32_t(pages.size() - 1);
+        }
+
+        pages[index].packer.insert(w, h, x, y);
+        return upload(font, glyph, index, x, y);
+    }
+
+    CachedGlyph GlyphCache::upload(const Font& font, uint32_t glyph, uint32_t index, int x, int y)
+    {
+        const Rect& src = font.getGlyph(glyph).src;
+        const SDL_Surface* from = font.getPage(font.getGlyph(glyph).page);
+        Page& page = pages[index];
+
+        const int w = int(src.w);
+        const int h = int(src.h);
+        const uint8_t* in = static_cast<const uint8_t*>(from->pixels)
+            + std::size_t(src.y) * std::size_t(from->pitch) + std::size_t(src.x) * 4;
+        uint8_t* out = static_cast<uint8_t*>(page.surface->pixels)
+            + std::size_t(y) * std::size_t(page.surface->pitch) + std::size_t(x) * 4;
+        for (int row = 0; row < h; ++row) {
+            std::memcpy(out, in, std::size_t(w) * 4);
+            in += from->pitch;
+            out += page.surface->pitch;
+        }
+
+        const SDL_Rect rect{ x, y, w, h };
+        SDL_UpdateTexture(page.texture, &rect,
+            static_cast<const uint8_t*>(page.surface->pixels) + std::size_t(y) * std::size_t(page.surface->pitch) + std::size_t(x) * 4,
+            page.surface->pitch);
+
+        const float size = float(options.page_size);
+        CachedGlyph cached;
+        cached.texture = page.texture;
+        cached.uv = Rect(float(x) / size, float(y) / size, float(w) / size, float(h) / size);
+        cached.page = index;
+        cached.generation = page.generation;
+
+        const Key key{ font.getId(), glyph };
+        glyphs.emplace(key, cached);
+        page.keys.push_back(key);
+        page.last_used = frame;
+        return cached;
+    }
+
+    void GlyphCache::addPage()
+    {
+        const int size = options.page_size;
+        SDL_Surface* surface = SDL_CreateSurface(size, size, SDL_PIXELFORMAT_RGBA32);
+        if (!surface) {
+            throw std::runtime_error(std::string("SDL_CreateSurface failed: ") + SDL_GetError());
+        }
+
+        SDL_Texture* texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, size, size);
+        if (!texture) {
+            SDL_DestroySurface(surface);
+            throw std::runtime_error(std::string("SDL_CreateTexture failed: ") + SDL_GetError());
+        }
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+
+        pages.push_back({ surface, texture, SkylinePacker(size, size), 0, 1, {} });
+        recycle(pages.back());
+    }
+
+    void GlyphCache::recycle(Page& page)
+    {
+        /*
+            Textures start undefined, and the padding around new glyphs
+            must not show what an evicted one left there.
+        */
+        std::memset(page.surface->pixels, 0, std::size_t(page.surface->pitch) * std::size_t(page.surface->h));
+        SDL_UpdateTexture(page.texture, nullptr, page.surface->pixels, page.surface->pitch);
+
+        for (const Key& key : page.keys)
+            glyphs.erase(key);
+        page.keys.clear();
+        page.packer.reset();
+        ++page.generation;
+        page.last_used = 0;
+    }
+
+    void GlyphCache::clear()
+    {
+        for (Page& page : pages)
+            recycle(page);
+    }
+
+} // namespace blaze
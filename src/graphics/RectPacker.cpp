@@ -0,0 +1,164 @@
+#include "Blaze2D/graphics/RectPacker.h"
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+namespace blaze
+{
+    SkylinePacker::SkylinePacker(int width, int height)
+        : width(width), height(height)
+    {
+        reset();
+    }
+
+    void SkylinePacker::reset()
+    {
+        skyline.clear();
+        skyline.push_back({ 0, 0, width });
+        usedArea = 0;
+    }
+
+    float SkylinePacker::occupancy() const
+    {
+        return static_cast<float>(static_cast<double>(usedArea) / (static_cast<double>(width) * height));
+    }
+
+    int SkylinePacker::fit(std::size_t i, int w, int h) const
+    {
+        if (skyline[i].x + w > width)
+            return -1;
+
+        int y = 0;
+        int remaining = w;
+        for (std::size_t j = i; remaining > 0; ++j) {
+            y = std::max(y, skyline[j].y);
+            if (y + h > height)
+                return -1;
+            remaining -= skyline[j].w;
+        }
+        return y;
+    }
+
+    bool SkylinePacker::insert(int w, int h, int& x, int& y)
+    {
+        if (w <= 0 || h <= 0) {
+            x = y = 0;
+            return w >= 0 && h >= 0 && w <= width && h <= height;
+        }
+
+        /*
+            Bottom-left rule: lowest resting position wins, ties go to the
+            narrower gap left behind (less wasted width).
+        */
+        std::size_t best = skyline.size();
+        int bestY = height;
+        int bestWidth = width + 1;
+
+        for (std::size_t i = 0; i < skyline.size(); ++i) {
+            int candidate = fit(i, w, h);
+            if (candidate < 0)
+                continue;
+
+            if (candidate < bestY || (candidate == bestY && skyline[i].w < bestWidth)) {
+                best = i;
+                bestY = candidate;
+                bestWidth = skyline[i].w;
+            }
+        }
+
+        if (best == skyline.size())
+            return false;
+
+        x = skyline[best].x;
+        y = bestY;
+
+        /*
+            Raise the skyline: insert the new segment, then trim or remove
+            the segments it now covers.
+        */
+        skyline.insert(skyline.begin() + best, Segment{ x, y + h, w });
+
+        for (std::size_t i = best + 1; i < skyline.size();) {
+            Segment& seg = skyline[i];
+            const int covered = x + w - seg.x;
+            if (covered <= 0)
+                break;
+
+            if (covered >= seg.w) {
+                skyline.erase(skyline.begin() + i);
+                continue;
+            }
+
+            seg.x += covered;
+            seg.w -= covered;
+            break;
+        }
+
+        // Merge with neighbours of equal height; only the new segment changed.
+        if (best + 1 < skyline.size() && skyline[best + 1].y == skyline[best].y) {
+            skyline[best].w += skyline[best + 1].w;
+            skyline.erase(skyline.begin() + best + 1);
+        }
+        if (best > 0 && skyline[best - 1].y == skyline[best].y) {
+            skyline[best - 1].w += skyline[best].w;
+            skyline.erase(skyline.begin() + best);
+        }
+
+        usedArea += int64_t(w) * h;
+        return true;
+    }
+
+    uint32_t pack_rects(std::span<const PackSize> sizes, int width, int height, std::span<PackedRect> out)
+    {
+        if (out.size() < sizes.size()) {
+            throw std::invalid_argument("pack_rects: output span too small");
+        }
+
+        std::vector<uint32_t> order(sizes.size());
+        std::iota(order.begin(), order.end(), 0u);
+        std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+            if (sizes[a].h != sizes[b].h)
+                return sizes[a].h > sizes[b].h;
+            return sizes[a].w > sizes[b].w;
+        });
+
+        /*
+            Fill pages in order. Earlier pages keep accepting smaller rects
+            that still fit, so only the newest few pages are worth retrying.
+        */
+        constexpr std::size_t open_pages = 4;
+        std::vector<SkylinePacker> pages;
+
+        for (uint32_t index : order) {
+            const PackSize& size = sizes[index];
+            if (size.w > width || size.h > height) {
+                throw std::invalid_argument(
+                    "pack_rects: " + std::to_string(size.w) + "x" + std::to_string(size.h) +
+                    " rect does not fit on a " + std::to_string(width) + "x" + std::to_string(height) + " page"
+                );
+            }
+
+            PackedRect& placed = out[index];
+            bool done = false;
+
+            std::size_t first = pages.size() > open_pages ? pages.size() - open_pages : 0;
+            for (std::size_t p = first; p < pages.size() && !done; ++p) {
+                if (pages[p].insert(size.w, size.h, placed.x, placed.y)) {
+                    placed.page = static_cast<uint32_t>(p);
+                    done = true;
+                }
+            }
+
+            if (!done) {
+                pages.emplace_back(width, height);
+                pages.back().insert(size.w, size.h, placed.x, placed.y);
+                placed.page = static_cast<uint32_t>(pages.size() - 1);
+            }
+        }
+
+        return static_cast<uint32_t>(pages.size());
+    }
+
+} // namespace blaze
@@ -0,0 +1,203 @@
+#include "Blaze2D/graphics/SpriteBatch.h"
+#include "Blaze2D/internal/SDLManager.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+
+namespace blaze
+{
+    SpriteBatch::SpriteBatch(std::size_t reserveSprites)
+    {
+        sprites.reserve(reserveSprites);
+        order.reserve(reserveSprites);
+    }
+
+    void SpriteBatch::begin(SpriteSortMode sortMode)
+    {
+        mode = sortMode;
+        sprites.clear();
+        order.clear();
+        sizedTexture = nullptr;
+    }
+
+    void SpriteBatch::draw(SDL_Texture* texture, const Rect& dst, const Color& tint, int layer)
+    {
+        push(texture, dst, Rect(0.0f, 0.0f, 1.0f, 1.0f), tint, layer);
+    }
+
+    void SpriteBatch::draw(SDL_Texture* texture, const Rect& src, const Rect& dst, const Color& tint, int layer)
+    {
+        /*
+            Pixel rects need the texture size to become UVs. Sprites are
+            usually drawn in runs from the same texture, so remember the
+            last size instead of asking SDL for every sprite.
+        */
+        if (texture != sizedTexture) {
+            if (!SDL_GetTextureSize(texture, &sizedWidth, &sizedHeight)) {
+                sizedTexture = nullptr;
+                return;
+            }
+            sizedTexture = texture;
+        }
+
+        Rect uv(src.x / sizedWidth, src.y / sizedHeight, src.w / sizedWidth, src.h / sizedHeight);
+        push(texture, dst, uv, tint, layer);
+    }
+
+    void SpriteBatch::drawUV(SDL_Texture* texture, const Rect& uv, const Rect& dst, const Color& tint, int layer)
+    {
+        push(texture, dst, uv, tint, layer);
+    }
+
+    void SpriteBatch::draw(const Atlas& atlas, SpriteId id, const Rect& dst, const Color& tint, int layer)
+    {
+        push(atlas.getTexture(id), dst, atlas.getUV(id), tint, layer);
+    }
+
+    void SpriteBatch::draw(const Atlas& atlas, SpriteId id, const Vec2& position, const Color& tint, int layer)
+    {
+        push(atlas.getTexture(id), Rect(position, atlas.getRect(id).size()), atlas.getUV(id), tint, layer);
+    }
+
+    void SpriteBatch::fill(const Rect& dst, const Color& color, int layer)
+    {
+        push(nullptr, dst, Rect(), color, layer);
+    }
+
+    void SpriteBatch::push(SDL_Texture* texture, const Rect& dst, const Rect& uv, const Color& color, int layer)
+    {
+        order.push_back({ layer, static_cast<uint32_t>(sprites.size()), texture });
+        sprites.push_back({ dst, uv, color });
+    }
+
+    void SpriteBatch::sort()
+    {
+        /*
+            Sprites are commonly submitted already grouped (tile layers,
+            particle systems), so check before paying for the sort. The
+            index breaks ties, which keeps the result deterministic and
+            equal to a stable sort.
+        */
+        auto byLayer = [](const SortEntry& a, const SortEntry& b) {
+            if (a.layer != b.layer)
+                return a.layer < b.layer;
+            return a.index < b.index;
+        };
+
+        auto byLayerAndTexture = [](const SortEntry& a, const SortEntry& b) {
+            if (a.layer != b.layer)
+                return a.layer < b.layer;
+            if (a.texture != b.texture)
+                return std::less<SDL_Texture*>()(a.texture, b.texture);
+            return a.index < b.index;
+        };
+
+        if (mode == SpriteSortMode::Texture) {
+            if (!std::is_sorted(order.begin(), order.end(), byLayerAndTexture))
+                std::sort(order.begin(), order.end(), byLayerAndTexture);
+        }
+        else {
+            if (!std::is_sorted(order.begin(), order.end(), byLayer))
+                std::sort(order.begin(), order.end(), byLayer);
+        }
+    }
+
+    std::size_t SpriteBatch::build()
+    {
+        const std::size_t count = sprites.size();
+        lastSpriteCount = count;
+        lastDrawCalls = 0;
+
+        if (count == 0) {
+            return 0;
+        }
+
+        sort();
+
+        vertices.resize(count * 4);
+        Vertex* vertex = vertices.data();
+        for (const SortEntry& entry : order) {
+            const Sprite& sprite = sprites[entry.index];
+            const Rect& d = sprite.dst;
+            const Rect& t = sprite.uv;
+            const Color& c = sprite.color;
+
+            // Clockwise from the top-left corner.
+            vertex[0] = { d.left(),  d.top(),    c.r, c.g, c.b, c.a, t.left(),  t.top() };
+            vertex[1] = { d.right(), d.top(),    c.r, c.g, c.b, c.a, t.right(), t.top() };
+            vertex[2] = { d.right(), d.bottom(), c.r, c.g, c.b, c.a, t.right(), t.bottom() };
+            vertex[3] = { d.left(),  d.bottom(), c.r, c.g, c.b, c.a, t.left(),  t.bottom() };
+            vertex += 4;
+        }
+        return count;
+    }
+
+    template <typename Submit>
+    void SpriteBatch::submitRuns(std::size_t count, Submit&& submit)
+    {
+        std::size_t runStart = 0;
+        while (runStart < count) {
+            SDL_Texture* texture = order[runStart].texture;
+
+            std::size_t runEnd = runStart + 1;
+            while (runEnd < count && order[runEnd].texture == texture)
+                ++runEnd;
+
+            submit(texture, runStart, runEnd - runStart);
+            ++lastDrawCalls;
+            runStart = runEnd;
+        }
+    }
+
+    std::size_t SpriteBatch::end(SDL_Renderer* renderer)
+    {
+        static_assert(sizeof(Vertex) == sizeof(SDL_Vertex));
+        static_assert(offsetof(Vertex, r) == offsetof(SDL_Vertex, color));
+        static_assert(offsetof(Vertex, u) == offsetof(SDL_Vertex, tex_coord));
+
+        const std::size_t count = build();
+        if (count == 0)
+            return 0;
+
+        /*
+            Every quad uses the same index pattern relative to its first
+            vertex, and each run is submitted with the vertex pointer at the
+            start of the run, so the index buffer only grows and is never
+            rewritten.
+        */
+        const std::size_t builtQuads = indices.size() / 6;
+        if (builtQuads < count) {
+            indices.resize(count * 6);
+            for (std::size_t quad = builtQuads; quad < count; ++quad) {
+                int base = static_cast<int>(quad * 4);
+                int* out = indices.data() + quad * 6;
+                out[0] = base;
+                out[1] = base + 1;
+                out[2] = base + 2;
+                out[3] = base + 2;
+                out[4] = base + 3;
+                out[5] = base;
+            }
+        }
+
+        const SDL_Vertex* sdlVertices = reinterpret_cast<const SDL_Vertex*>(vertices.data());
+        submitRuns(count, [&](SDL_Texture* texture, std::size_t first, std::size_t quads) {
+            SDL_RenderGeometry(renderer, texture,
+                sdlVertices + first * 4, static_cast<int>(quads * 4),
+                indices.data(), static_cast<int>(quads * 6));
+        });
+
+        return lastDrawCalls;
+    }
+
+    std::size_t SpriteBatch::end(CommandBuffer& commands)
+    {
+        const std::size_t count = build();
+        submitRuns(count, [&](SDL_Texture* texture, std::size_t first, std::size_t quads) {
+            commands.drawQuads(texture, std::span<const Vertex>(vertices).subspan(first * 4, quads * 4));
+        });
+        return lastDrawCalls;
+    }
+
+} // namespace blaze
@@ -0,0 +1,285 @@
+#include "Blaze2D/graphics/TextRenderer.h"
+#include "Blaze2D/graphics/Font.h"
+#include "Blaze2D/graphics/SpriteBatch.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+namespace blaze
+{
+    namespace {
+
+        constexpr char32_t replacement_character = 0xFFFD;
+
+        /*
+            Decodes the code point at 'pos' and advances past it. A byte
+            that does not start a valid, shortest-form sequence decodes to
+            U+FFFD on its own, so decoding always moves on.
+        */
+        char32_t decode_utf8(std::string_view text, std::size_t& pos)
+        {
+            const unsigned char lead = static_cast<unsigned char>(text[pos]);
+            if (lead < 0x80) {
+                ++pos;
+                return lead;
+            }
+
+            int length;
+            char32_t codepoint;
+            char32_t minimum;
+            if ((lead & 0xE0) == 0xC0)      { length = 2; codepoint = lead & 0x1F; minimum = 0x80; }
+            else if ((lead & 0xF0) == 0xE0) { length = 3; codepoint = lead & 0x0F; minimum = 0x800; }
+            else if ((lead & 0xF8) == 0xF0) { length = 4; codepoint = lead & 0x07; minimum = 0x10000; }
+            else {
+                ++pos;
+                return replacement_character;
+            }
+
+            if (pos + length > text.size()) {
+                ++pos;
+                return replacement_character;
+            }
+            for (int i = 1; i < length; ++i) {
+                const unsigned char next = static_cast<unsigned char>(text[pos + i]);
+                if ((next & 0xC0) != 0x80) {
+                    ++pos;
+                    return replacement_character;
+                }
+                codepoint = (codepoint << 6) | (next & 0x3F);
+            }
+
+            if (codepoint < minimum || codepoint > 0x10FFFF || (codepoint >= 0xD800 && codepoint <= 0xDFFF)) {
+                ++pos;
+                return replacement_character;
+            }
+            pos += length;
+            return codepoint;
+        }
+
+        void check_options(const TextOptions& options)
+        {
+            if (!(options.scale > 0.0f) || !std::isfinite(options.scale)) {
+                throw std::invalid_argument("TextOptions::scale must be positive and finite, got " + std::to_string(options.scale));
+            }
+        }
+
+        /*
+            Keys hash the bits of their options but compare them as floats;
+            the two only agree without -0 and NaN. Every max_width that does
+            not wrap means the same layout, so make it 0.
+        */
+        TextOptions canonical(const TextOptions& options)
+        {
+            check_options(options);
+            TextOptions out = options;
+            if (!(out.max_width > 0.0f))
+                out.max_width = 0.0f;
+            return out;
+        }
+
+        inline std::size_t hash_combine(std::size_t seed, std::size_t value)
+        {
+            return seed ^ (value + 0x9E3779B97F4A7C15ull + (seed << 6) + (seed >> 2));
+        }
+
+    } // namespace
+
+    void layout_text(const Font& font, std::string_view text, const TextOptions& options, TextLayout& out)
+    {
+        check_options(options);
+        out.quads.clear();
+        out.lines.clear();
+        out.size = Vec2();
+        if (text.empty())
+            return;
+
+        /*
+            Lay out in font units and scale at the end. Wrapping happens
+            after the fact: when a glyph passes the width, the quads after
+            the last space move down to a new line.
+        */
+        constexpr uint32_t no_break = UINT32_MAX;
+        const float lineHeight = font.getLineHeight();
+        const float wrapWidth = options.max_width > 0.0f ? options.max_width / options.scale : 0.0f;
+
+        float pen = 0.0f;
+        float y = 0.0f;
+        float lineWidth = 0.0f;       // Pen after the last glyph that is not a space
+        uint32_t lineFirst = 0;
+        uint32_t breakQuad = no_break; // First quad after the last space
+        float breakPen = 0.0f;
+        float breakWidth = 0.0f;
+        char32_t previous = 0;
+
+        auto endLine = [&](uint32_t end, float width) {
+            out.lines.push_back({ lineFirst, end - lineFirst, width });
+        };
+
+        for (std::size_t pos = 0; pos < text.size();) {
+            const char32_t codepoint = decode_utf8(text, pos);
+
+            if (codepoint == U'\n') {
+                endLine(uint32_t(out.quads.size()), lineWidth);
+                y += lineHeight;
+                pen = 0.0f;
+                lineWidth = 0.0f;
+                lineFirst = uint32_t(out.quads.size());
+                breakQuad = no_break;
+                previous = 0;
+                continue;
+            }
+
+            const uint32_t index = font.findGlyph(codepoint);
+            if (index == Font::no_glyph) {
+                previous = 0;
+                continue;
+            }
+            const Glyph& glyph = font.getGlyph(index);
+
+            if (previous)
+                pen += font.getKerning(previous, codepoint);
+            previous = codepoint;
+
+            if (codepoint == U' ') {
+                breakWidth = lineWidth;
+                pen += glyph.advance;
+                breakQuad = uint32_t(out.quads.size());
+                breakPen = pen;
+                continue;
+            }
+
+            if (wrapWidth > 0.0f && breakQuad != no_break && pen + glyph.offset.x + glyph.src.w > wrapWidth) {
+                endLine(breakQuad, breakWidth);
+                for (std::size_t i = breakQuad; i < out.quads.size(); ++i) {
+                    out.quads[i].dst.x -= breakPen;
+                    out.quads[i].dst.y += lineHeight;
+                }
+                y += lineHeight;
+                pen -= breakPen;
+                lineWidth -= breakPen;
+                lineFirst = breakQuad;
+                breakQuad = no_break;
+            }
+
+            if (!glyph.src.empty()) {
+                out.quads.push_back({ Rect(pen + glyph.offset.x, y + glyph.offset.y, glyph.src.w, glyph.src.h), index });
+            }
+            pen += glyph.advance;
+            lineWidth = pen;
+        }
+        endLine(uint32_t(out.quads.size()), lineWidth);
+
+        float widest = 0.0f;
+        for (const TextLine& line : out.lines)
+            widest = std::max(widest, line.width);
+
+        const float alignWidth = wrapWidth > 0.0f ? wrapWidth : widest;
+        const float scale = options.scale;
+        for (TextLine& line : out.lines) {
+            float shift = 0.0f;
+            if (options.align == TextAlign::Center)
+                shift = (alignWidth - line.width) * 0.5f;
+            else if (options.align == TextAlign::Right)
+                shift = alignWidth - line.width;
+
+            for (uint32_t i = line.first; i < line.first + line.count; ++i) {
+                Rect& dst = out.quads[i].dst;
+                dst = Rect((dst.x + shift) * scale, dst.y * scale, dst.w * scale, dst.h * scale);
+            }
+            line.width *= scale;
+        }
+
+        out.size = Vec2(widest * scale, float(out.lines.size()) * lineHeight * scale);
+    }
+
+    std::size_t TextRenderer::KeyHash::operator()(const Key& key) const noexcept
+    {
+        std::size_t seed = std::hash<std::string_view>()(key.text);
+        seed = hash_combine(seed, std::size_t(key.font));
+        seed = hash_combine(seed, std::bit_cast<uint32_t>(key.options.max_width));
+        seed = hash_combine(seed, std::bit_cast<uint32_t>(key.options.scale));
+        return hash_combine(seed, std::size_t(key.options.align));
+    }
+
+    TextRenderer::TextRenderer(GlyphCache& cache, std::size_t maxLayouts)
+        : cache(cache), maxLayouts(maxLayouts)
+    {
+        if (maxLayouts == 0) {
+            throw std::invalid_argument("TextRenderer needs room for at least one layout");
+        }
+        index.reserve(maxLayouts);
+    }
+
+    TextRenderer::Entry& TextRenderer::find(const Font& font, std::string_view text, const TextOptions& requested)
+    {
+        const TextOptions options = canonical(requested);
+        if (auto it = index.find(Key{ font.getId(), options, text }); it != index.end()) {
+            ++stats.hits;
+            entries.splice(entries.begin(), entries, it->second);
+            return *it->second;
+        }
+
+        ++stats.misses;
+
+        /*
+            Reuse the least recently used entry once the cache is full; its
+            buffers have usually grown to fit another label already.
+        */
+        if (entries.size() >= maxLayouts) {
+            auto last = std::prev(entries.end());
+            index.erase(Key{ last->font, last->options, last->text });
+            entries.splice(entries.begin(), entries, last);
+        }
+        else {
+            entries.emplace_front();
+        }
+
+        Entry& entry = entries.front();
+        entry.text.assign(text);
+        entry.font = font.getId();
+        entry.options = options;
+        layout_text(font, text, options, entry.layout);
+        entry.glyphs.assign(entry.layout.quads.size(), CachedGlyph{});
+
+        index.emplace(Key{ entry.font, entry.options, entry.text }, entries.begin());
+        return entry;
+    }
+
+    Vec2 TextRenderer::draw(SpriteBatch& batch, const Font& font, std::string_view text, const Vec2& position,
+        const Color& color, const TextOptions& options, int layer)
+    {
+        Entry& entry = find(font, text, options);
+
+        const std::vector<GlyphQuad>& quads = entry.layout.quads;
+        for (std::size_t i = 0; i < quads.size(); ++i) {
+            CachedGlyph& cached = entry.glyphs[i];
+            cache.refresh(font, quads[i].glyph, cached);
+
+            const Rect& dst = quads[i].dst;
+            batch.drawUV(cached.texture, cached.uv, Rect(dst.x + position.x, dst.y + position.y, dst.w, dst.h), color, layer);
+        }
+        return entry.layout.size;
+    }
+
+    Vec2 TextRenderer::measure(const Font& font, std::string_view text, const TextOptions& options)
+    {
+        return find(font, text, options).layout.size;
+    }
+
+    const TextLayout& TextRenderer::layout(const Font& font, std::string_view text, const TextOptions& options)
+    {
+        return find(font, text, options).layout;
+    }
+
+    void TextRenderer::clear()
+    {
+        index.clear();
+        entries.clear();
+    }
+
+} // namespace blaze
@@ -0,0 +1,315 @@
+#include "Blaze2D/input/EventRouter.h"
+#include "Blaze2D/window/Window.h"
+#include "Blaze2D/internal/SDLManager.h"
+
+#include <algorithm>
+#include <bit>
+
+namespace blaze
+{
+    namespace {
+
+        constexpr std::size_t batch_size = 64;
+
+        uint32_t window_id_of(const SDL_Event& event)
+        {
+            switch (event.type) {
+            case SDL_EVENT_MOUSE_MOTION:
+                return event.motion.windowID;
+            case SDL_EVENT_MOUSE_BUTTON_DOWN:
+            case SDL_EVENT_MOUSE_BUTTON_UP:
+                return event.button.windowID;
+            case SDL_EVENT_MOUSE_WHEEL:
+                return event.wheel.windowID;
+            case SDL_EVENT_KEY_DOWN:
+            case SDL_EVENT_KEY_UP:
+                return event.key.windowID;
+            case SDL_EVENT_TEXT_INPUT:
+                return event.text.windowID;
+            case SDL_EVENT_FINGER_DOWN:
+            case SDL_EVENT_FINGER_UP:
+            case SDL_EVENT_FINGER_MOTION:
+                return event.tfinger.windowID;
+            default:
+                if (event.type >= SDL_EVENT_WINDOW_FIRST && event.type <= SDL_EVENT_WINDOW_LAST)
+                    return event.window.windowID;
+                return 0;
+            }
+        }
+
+        bool is_pointer_event(uint32_t type)
+        {
+            switch (type) {
+            case SDL_EVENT_MOUSE_MOTION:
+            case SDL_EVENT_MOUSE_BUTTON_DOWN:
+            case SDL_EVENT_MOUSE_BUTTON_UP:
+            case SDL_EVENT_MOUSE_WHEEL:
+            case SDL_EVENT_FINGER_DOWN:
+            case SDL_EVENT_FINGER_UP:
+            case SDL_EVENT_FINGER_MOTION:
+                return true;
+            default:
+                return false;
+            }
+        }
+
+        // Pointer position in window coordinates. Touch positions are normalized by SDL.
+        Vec2 pointer_position(const SDL_Event& event, const Window& window)
+        {
+            switch (event.type) {
+            case SDL_EVENT_MOUSE_MOTION:
+                return { event.motion.x, event.motion.y };
+            case SDL_EVENT_MOUSE_BUTTON_DOWN:
+            case SDL_EVENT_MOUSE_BUTTON_UP:
+                return { event.button.x, event.button.y };
+            case SDL_EVENT_MOUSE_WHEEL:
+                return { event.wheel.mouse_x, event.wheel.mouse_y };
+            default:
+                return { event.tfinger.x * float(window.getWidth()), event.tfinger.y * float(window.getHeight()) };
+            }
+        }
+
+        /*
+            Consecutive motion of the same mouse (with the same buttons held)
+            or the same finger can be folded into the later event: it keeps
+            the final position and receives the summed relative motion.
+        */
+        bool try_coalesce(const SDL_Event& earlier, SDL_Event& later)
+        {
+            if (earlier.type != later.type)
+                return false;
+
+            if (earlier.type == SDL_EVENT_MOUSE_MOTION) {
+                if (earlier.motion.windowID != later.motion.windowID ||
+                    earlier.motion.which != later.motion.which ||
+                    earlier.motion.state != later.motion.state)
+                    return false;
+
+                later.motion.xrel += earlier.motion.xrel;
+                later.motion.yrel += earlier.motion.yrel;
+                return true;
+            }
+
+            if (earlier.type == SDL_EVENT_FINGER_MOTION) {
+                if (earlier.tfinger.windowID != later.tfinger.windowID ||
+                    earlier.tfinger.touchID != later.tfinger.touchID ||
+                    earlier.tfinger.fingerID != later.tfinger.fingerID)
+                    return false;
+
+                later.tfinger.dx += earlier.tfinger.dx;
+                later.tfinger.dy += earlier.tfinger.dy;
+                return true;
+            }
+
+            return false;
+        }
+
+    } // namespace
+
+    /* =========================
+       EventRing
+       ========================= */
+
+    EventRing::EventRing(std::size_t capacity)
+        : storage(std::bit_ceil(std::max<std::size_t>(capacity, 1))),
+        mask(storage.size() - 1)
+    {
+    }
+
+    EventRing::~EventRing() = default;
+
+    bool EventRing::isCritical(const SDL_Event& event)
+    {
+        return event.type == SDL_EVENT_QUIT || event.type == SDL_EVENT_WINDOW_CLOSE_REQUESTED;
+    }
+
+    void EventRing::push(const SDL_Event& event)
+    {
+        if (count == storage.size() && !makeRoom(event)) {
+            ++dropped;
+            return;
+        }
+
+        storage[(head + count) & mask] = event;
+        ++count;
+    }
+
+    bool EventRing::makeRoom(const SDL_Event& event)
+    {
+        /*
+            Drop the oldest event that is not a quit or close request,
+            moving the critical events before it up one slot so the order
+            is kept. Overflow is rare, so the scan does not matter.
+        */
+        std::size_t victim = 0;
+        while (victim < count && isCritical(storage[(head + victim) & mask]))
+            ++victim;
+
+        if (victim < count) {
+            for (std::size_t i = victim; i > 0; --i)
+                storage[(head + i) & mask] = storage[(head + i - 1) & mask];
+            head = (head + 1) & mask;
+            --count;
+            ++dropped;
+            return true;
+        }
+
+        // Only critical events are queued: newcomers that are not critical, or repeat one, go.
+        if (!isCritical(event))
+            return false;
+        for (std::size_t i = 0; i < count; ++i) {
+            const SDL_Event& queued = storage[(head + i) & mask];
+            if (queued.type == event.type && (event.type == SDL_EVENT_QUIT || queued.window.windowID == event.window.windowID))
+                return false;
+        }
+
+        // A distinct close request for every slot: grow rather than lose one.
+        linearize();
+        storage.resize(storage.size() * 2);
+        mask = storage.size() - 1;
+        return true;
+    }
+
+    void EventRing::clear()
+    {
+        head = 0;
+        count = 0;
+    }
+
+    const SDL_Event& EventRing::operator[](std::size_t i) const
+    {
+        return storage[(head + i) & mask];
+    }
+
+    std::span<const SDL_Event> EventRing::linearize()
+    {
+        if (head + count > storage.size()) {
+            std::rotate(storage.begin(), storage.begin() + head, storage.end());
+            head = 0;
+        }
+        return { storage.data() + head, count };
+    }
+
+    /* =========================
+       EventRouter
+       ========================= */
+
+    EventRouter::EventRouter(std::size_t capacity)
+        : batch(batch_size), remaining(capacity)
+    {
+        path.reserve(32);
+    }
+
+    EventRouter::~EventRouter() = default;
+
+    void EventRouter::addWindow(Window& window)
+    {
+        const uint32_t id = window.getId();
+        if (id >= windowsById.size())
+            windowsById.resize(id + 1, nullptr);
+        windowsById[id] = &window;
+    }
+
+    void EventRouter::removeWindow(Window& window)
+    {
+        const uint32_t id = window.getId();
+        if (id < windowsById.size() && windowsById[id] == &window)
+            windowsById[id] = nullptr;
+    }
+
+    Window* EventRouter::findWindow(uint32_t windowId) const
+    {
+        return windowId < windowsById.size() ? windowsById[windowId] : nullptr;
+    }
+
+    std::span<const SDL_Event> EventRouter::poll()
+    {
+        remaining.clear();
+
+        SDL_PumpEvents();
+        for (;;) {
+            int count = SDL_PeepEvents(batch.data(), static_cast<int>(batch.size()), SDL_GETEVENT, SDL_EVENT_FIRST, SDL_EVENT_LAST);
+            if (count <= 0)
+                break;
+
+            routeBatch(static_cast<std::size_t>(count));
+
+            if (static_cast<std::size_t>(count) < batch.size())
+                break;
+        }
+
+        return remaining.linearize();
+    }
+
+    void EventRouter::routeBatch(std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; ++i) {
+            if (coalesceMotion && i + 1 < count && try_coalesce(batch[i], batch[i + 1]))
+                continue;
+
+            if (!dispatch(batch[i]))
+                remaining.push(batch[i]);
+        }
+    }
+
+    bool EventRouter::dispatch(const SDL_Event& event)
+    {
+        Window* window = findWindow(window_id_of(event));
+        if (!window)
+            return false;
+
+        if (event.type == SDL_EVENT_WINDOW_RESIZED)
+            window->resized(event.window.data1, event.window.data2);
+        else if (event.type == SDL_EVENT_WINDOW_EXPOSED)
+            window->invalidate();
+
+        // Hit testing needs current rects; this is a flag check when nothing changed.
+        Container& root = window->getRoot();
+        root.layout();
+        Container* target = &root;
+
+        if (is_pointer_event(event.type)) {
+            if (window->captureContainer) {
+                target = window->captureContainer;
+            }
+            else if (Container* hit = root.hitTest(pointer_position(event, *window))) {
+                target = hit;
+            }
+        }
+        else if (event.type == SDL_EVENT_KEY_DOWN || event.type == SDL_EVENT_KEY_UP || event.type == SDL_EVENT_TEXT_INPUT) {
+            if (window->focusContainer)
+                target = window->focusContainer;
+        }
+
+        const bool consumed = dispatchTo(target, event);
+
+        if (event.type == SDL_EVENT_MOUSE_BUTTON_UP)
+            window->captureContainer = nullptr;
+
+        return consumed;
+    }
+
+    bool EventRouter::dispatchTo(Container* target, const SDL_Event& event)
+    {
+        // path[0] is the target, path.back() the root.
+        path.clear();
+        for (Container* c = target; c; c = c->getParent())
+            path.push_back(c);
+
+        for (std::size_t i = path.size(); i-- > 1;) {
+            if (path[i]->handleEvent(event, EventPhase::Capture) == EventResult::Consumed)
+                return true;
+        }
+
+        if (target->handleEvent(event, EventPhase::Target) == EventResult::Consumed)
+            return true;
+
+        for (std::size_t i = 1; i < path.size(); ++i) {
+            if (path[i]->handleEvent(event, EventPhase::Bubble) == EventResult::Consumed)
+                return true;
+        }
+
+        return false;
+    }
+
+} // namespace blaze
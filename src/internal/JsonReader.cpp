@@ -0,0 +1,342 @@
+#include "Blaze2D/internal/JsonReader.h"
+
+#include <charconv>
+#include <cstdint>
+#include <stdexcept>
+
+namespace blaze::detail {
+
+    void JsonReader::fail(const char* what) const
+    {
+        throw std::runtime_error(
+            std::string("JSON parse error at offset ") + std::to_string(pos) + ": " + what
+        );
+    }
+
+    void JsonReader::skipWhitespace()
+    {
+        while (pos < text.size()) {
+            char c = text[pos];
+            if (c != ' ' && c != '\t' && c != '\n' && c != '\r')
+                break;
+            ++pos;
+        }
+    }
+
+    char JsonReader::peek()
+    {
+        skipWhitespace();
+        if (pos >= text.size())
+            fail("unexpected end of input");
+        return text[pos];
+    }
+
+    JsonReader::Token JsonReader::next()
+    {
+        if (stack.empty()) {
+            if (done) {
+                skipWhitespace();
+                if (pos != text.size())
+                    fail("unexpected data after top-level value");
+                return Token::End;
+            }
+            return readValue();
+        }
+
+        Scope& scope = stack.back();
+        char c = peek();
+
+        switch (scope.state) {
+        case State::Start:
+            if (c == (scope.object ? '}' : ']'))
+                return close(scope.object);
+            if (scope.object)
+                return readKey();
+            scope.state = State::AfterValue;
+            return readValue();
+
+        case State::AfterKey:
+            if (c != ':')
+                fail("expected ':'");
+            ++pos;
+            scope.state = State::AfterValue;
+            return readValue();
+
+        case State::AfterValue:
+        default:
+            if (c == (scope.object ? '}' : ']'))
+                return close(scope.object);
+            if (c != ',')
+                fail(scope.object ? "expected ',' or '}'" : "expected ',' or ']'");
+            ++pos;
+            if (scope.object)
+                return readKey();
+            return readValue();
+        }
+    }
+
+    JsonReader::Token JsonReader::close(bool object)
+    {
+        ++pos;
+        stack.pop_back();
+        done = stack.empty();
+        return object ? Token::EndObject : Token::EndArray;
+    }
+
+    JsonReader::Token JsonReader::readKey()
+    {
+        if (peek() != '"')
+            fail("expected object key");
+
+        str = readString();
+        stack.back().state = State::AfterKey;
+        return Token::Key;
+    }
+
+    JsonReader::Token JsonReader::readValue()
+    {
+        char c = peek();
+        Token token;
+
+        switch (c) {
+        case '{':
+            ++pos;
+            stack.push_back({ true, State::Start });
+            return Token::BeginObject;
+
+        case '[':
+            ++pos;
+            stack.push_back({ false, State::Start });
+            return Token::BeginArray;
+
+        case '"':
+            str = readString();
+            token = Token::String;
+            break;
+
+        case 't':
+            readLiteral("true");
+            token = Token::True;
+            break;
+
+        case 'f':
+            readLiteral("false");
+            token = Token::False;
+            break;
+
+        case 'n':
+            readLiteral("null");
+            token = Token::Null;
+            break;
+
+        default:
+            if (c != '-' && (c < '0' || c > '9'))
+                fail("unexpected character");
+            num = readNumber();
+            token = Token::Number;
+            break;
+        }
+
+        done = stack.empty();
+        return token;
+    }
+
+    std::string_view JsonReader::readString()
+    {
+        ++pos; // Opening quote
+        const std::size_t start = pos;
+
+        /*
+            Fast path: no escapes, return a view into the input.
+        */
+        while (pos < text.size() && text[pos] != '"' && text[pos] != '\\') {
+            if (static_cast<unsigned char>(text[pos]) < 0x20)
+                fail("control character in string");
+            ++pos;
+        }
+
+        if (pos >= text.size())
+            fail("unterminated string");
+
+        if (text[pos] == '"')
+            return text.substr(start, pos++ - start);
+
+        /*
+            Slow path: decode escapes into the scratch buffer.
+        */
+        scratch.assign(text.substr(start, pos - start));
+
+        auto hex4 = [this]() -> uint32_t {
+            if (pos + 4 > text.size())
+                fail("truncated \\u escape");
+            uint32_t value = 0;
+            auto [end, ec] = std::from_chars(text.data() + pos, text.data() + pos + 4, value, 16);
+            if (ec != std::errc() || end != text.data() + pos + 4)
+                fail("invalid \\u escape");
+            pos += 4;
+            return value;
+        };
+
+        while (true) {
+            if (pos >= text.size())
+                fail("unterminated string");
+
+            char c = text[pos++];
+            if (c == '"')
+                break;
+
+            if (static_cast<unsigned char>(c) < 0x20)
+                fail("control character in string");
+
+            if (c != '\\') {
+                scratch.push_back(c);
+                continue;
+            }
+
+            if (pos >= text.size())
+                fail("unterminated string");
+
+            switch (text[pos++]) {
+            case '"': scratch.push_back('"'); break;
+            case '\\': scratch.push_back('\\'); break;
+            case '/': scratch.push_back('/'); break;
+            case 'b': scratch.push_back('\b'); break;
+            case 'f': scratch.push_back('\f'); break;
+            case 'n': scratch.push_back('\n'); break;
+            case 'r': scratch.push_back('\r'); break;
+            case 't': scratch.push_back('\t'); break;
+            case 'u':
+            {
+                uint32_t cp = hex4();
+
+                // Surrogate pair
+                if (cp >= 0xD800 && cp <= 0xDBFF) {
+                    if (pos + 2 > text.size() || text[pos] != '\\' || text[pos + 1] != 'u')
+                        fail("unpaired surrogate");
+                    pos += 2;
+                    uint32_t low = hex4();
+                    if (low < 0xDC00 || low > 0xDFFF)
+                        fail("invalid surrogate pair");
+                    cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                }
+
+                // UTF-8 encode
+                if (cp < 0x80) {
+                    scratch.push_back(static_cast<char>(cp));
+                }
+                else if (cp < 0x800) {
+                    scratch.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+                    scratch.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+                }
+                else if (cp < 0x10000) {
+                    scratch.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+                    scratch.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+                    scratch.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+                }
+                else {
+                    scratch.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+                    scratch.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+                    scratch.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+                    scratch.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+                }
+                break;
+            }
+            default:
+                fail("invalid escape sequence");
+            }
+        }
+
+        return scratch;
+    }
+
+    double JsonReader::readNumber()
+    {
+        const char* first = text.data() + pos;
+        const char* last = text.data() + text.size();
+
+        /*
+            std::from_chars also takes "inf", "nan", "1." and ".5", so
+            match the JSON grammar first:
+            -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?
+        */
+        auto digit = [&](const char* p) { return p < last && *p >= '0' && *p <= '9'; };
+
+        const char* p = first;
+        if (p < last && *p == '-')
+            ++p;
+        if (!digit(p))
+            fail("invalid number");
+        if (*p == '0')
+            ++p;
+        else
+            while (digit(p))
+                ++p;
+
+        if (p < last && *p == '.') {
+            ++p;
+            if (!digit(p))
+                fail("invalid number");
+            while (digit(p))
+                ++p;
+        }
+
+        if (p < last && (*p == 'e' || *p == 'E')) {
+            ++p;
+            if (p < last && (*p == '+' || *p == '-'))
+                ++p;
+            if (!digit(p))
+                fail("invalid number");
+            while (digit(p))
+                ++p;
+        }
+
+        double value = 0.0;
+        auto [end, ec] = std::from_chars(first, p, value);
+        if (ec != std::errc() || end != p)
+            fail("invalid number");
+
+        pos += end - first;
+        return value;
+    }
+
+    void JsonReader::readLiteral(std::string_view literal)
+    {
+        if (text.substr(pos, literal.size()) != literal)
+            fail("invalid literal");
+        pos += literal.size();
+    }
+
+    void JsonReader::skipValue()
+    {
+        std::size_t depth = 0;
+        do {
+            switch (next()) {
+            case Token::BeginObject:
+            case Token::BeginArray:
+                ++depth;
+                break;
+            case Token::EndObject:
+            case Token::EndArray:
+                --depth;
+                break;
+            case Token::End:
+                fail("unexpected end of input");
+            default:
+                break;
+            }
+        } while (depth > 0);
+    }
+
+    void JsonReader::expect(Token expected)
+    {
+        if (next() != expected)
+            fail("unexpected token");
+    }
+
+    double JsonReader::expectNumber()
+    {
+        expect(Token::Number);
+        return num;
+    }
+
+} // namespace blaze::detail
@@ -0,0 +1,193 @@
+#include "Blaze2D/internal/MappedFile.h"
+
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace blaze::detail {
+
+#ifdef _WIN32
+
+    MappedFile::MappedFile(const std::filesystem::path& path)
+    {
+        HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error("Failed to open file: " + path.string());
+        }
+
+        LARGE_INTEGER fileSize{};
+        if (!GetFileSizeEx(file, &fileSize)) {
+            CloseHandle(file);
+            throw std::runtime_error("Failed to query file size: " + path.string());
+        }
+
+        file_handle = file;
+        length = static_cast<std::size_t>(fileSize.QuadPart);
+
+        // Zero-length files cannot be mapped; leave the view empty.
+        if (length == 0)
+            return;
+
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping) {
+            release();
+            throw std::runtime_error("Failed to map file: " + path.string());
+        }
+        mapping_handle = mapping;
+
+        ptr = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+        if (!ptr) {
+            release();
+            throw std::runtime_error("Failed to map file: " + path.string());
+        }
+    }
+
+    void MappedFile::release()
+    {
+        if (buffer) {
+            buffer.reset();
+            ptr = nullptr;
+            length = 0;
+            return;
+        }
+
+        if (ptr)
+            UnmapViewOfFile(ptr);
+        if (mapping_handle)
+            CloseHandle(static_cast<HANDLE>(mapping_handle));
+        if (file_handle)
+            CloseHandle(static_cast<HANDLE>(file_handle));
+
+        ptr = nullptr;
+        length = 0;
+        mapping_handle = nullptr;
+        file_handle = nullptr;
+    }
+
+#else
+
+    MappedFile::MappedFile(const std::filesystem::path& path)
+    {
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            throw std::runtime_error("Failed to open file: " + path.string());
+        }
+
+        struct stat info {};
+        if (::fstat(fd, &info) != 0) {
+            ::close(fd);
+            throw std::runtime_error("Failed to query file size: " + path.string());
+        }
+
+        length = static_cast<std::size_t>(info.st_size);
+
+        // Zero-length files cannot be mapped; leave the view empty.
+        if (length == 0) {
+            ::close(fd);
+            return;
+        }
+
+        void* mapped = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd); // The mapping keeps its own reference to the file.
+
+        if (mapped == MAP_FAILED) {
+            length = 0;
+            throw std::runtime_error("Failed to map file: " + path.string());
+        }
+
+        // Files are tokenized front to back; let the kernel read ahead.
+        ::madvise(mapped, length, MADV_SEQUENTIAL);
+
+        ptr = static_cast<const char*>(mapped);
+    }
+
+    void MappedFile::release()
+    {
+        if (buffer) {
+            buffer.reset();
+            ptr = nullptr;
+            length = 0;
+            return;
+        }
+
+        if (ptr)
+            ::munmap(const_cast<char*>(ptr), length);
+
+        ptr = nullptr;
+        length = 0;
+    }
+
+#endif
+
+    MappedFile::~MappedFile()
+    {
+        release();
+    }
+
+    MappedFile MappedFile::read(const std::filesystem::path& path)
+    {
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        if (!in)
+            throw std::runtime_error("Failed to open file: " + path.string());
+
+        const std::streamoff size = in.tellg();
+        if (size < 0)
+            throw std::runtime_error("Failed to query file size: " + path.string());
+
+        MappedFile file;
+        file.length = static_cast<std::size_t>(size);
+        if (file.length == 0)
+            return file;
+
+        file.buffer = std::make_unique_for_overwrite<char[]>(file.length);
+        in.seekg(0);
+        if (!in.read(file.buffer.get(), static_cast<std::streamsize>(file.length)))
+            throw std::runtime_error("Failed to read file: " + path.string());
+
+        file.ptr = file.buffer.get();
+        return file;
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+        : ptr(std::exchange(other.ptr, nullptr)),
+          length(std::exchange(other.length, 0)),
+          buffer(std::move(other.buffer))
+#ifdef _WIN32
+        , file_handle(std::exchange(other.file_handle, nullptr)),
+          mapping_handle(std::exchange(other.mapping_handle, nullptr))
+#endif
+    {
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+    {
+        if (this != &other) {
+            release();
+            ptr = std::exchange(other.ptr, nullptr);
+            length = std::exchange(other.length, 0);
+            buffer = std::move(other.buffer);
+#ifdef _WIN32
+            file_handle = std::exchange(other.file_handle, nullptr);
+            mapping_handle = std::exchange(other.mapping_handle, nullptr);
+#endif
+        }
+        return *this;
+    }
+
+} // namespace blaze::detail
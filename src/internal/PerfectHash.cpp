@@ -0,0 +1,192 @@
+#include "Blaze2D/internal/PerfectHash.h"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+namespace blaze::detail {
+
+    namespace {
+
+        inline uint64_t read64(const unsigned char* p)
+        {
+            uint64_t v;
+            std::memcpy(&v, p, 8);
+            return v;
+        }
+
+        inline uint64_t read32(const unsigned char* p)
+        {
+            uint32_t v;
+            std::memcpy(&v, p, 4);
+            return v;
+        }
+
+        // 64x64 -> 128 bit multiply, folded back to 64 bits.
+        inline uint64_t fold_multiply(uint64_t a, uint64_t b)
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            uint64_t high;
+            uint64_t low = _umul128(a, b, &high);
+            return low ^ high;
+#else
+            unsigned __int128 r = static_cast<unsigned __int128>(a) * b;
+            return static_cast<uint64_t>(r) ^ static_cast<uint64_t>(r >> 64);
+#endif
+        }
+
+        constexpr uint64_t k0 = 0xa0761d6478bd642fULL;
+        constexpr uint64_t k1 = 0xe7037ed1a0b428dbULL;
+        constexpr uint64_t k2 = 0x8ebc6af09c88c6e3ULL;
+
+    } // namespace
+
+    uint64_t hash_name(std::string_view key, uint64_t seed)
+    {
+        /*
+            Multiply-fold hash over overlapping 8/4-byte reads.
+            Names are short, so the common case is two loads and two
+            128-bit multiplies with no loop and no byte-wise tail.
+        */
+        const unsigned char* p = reinterpret_cast<const unsigned char*>(key.data());
+        std::size_t n = key.size();
+        uint64_t h = (seed * k0) ^ (uint64_t(n) * k2);
+
+        while (n > 16) {
+            h = fold_multiply(read64(p) ^ k1, read64(p + 8) ^ h);
+            p += 16;
+            n -= 16;
+        }
+
+        uint64_t a = 0;
+        uint64_t b = 0;
+        if (n > 8) {
+            a = read64(p);
+            b = read64(p + n - 8);
+        }
+        else if (n >= 4) {
+            a = read32(p);
+            b = read32(p + n - 4);
+        }
+        else if (n > 0) {
+            a = (uint64_t(p[0]) << 16) | (uint64_t(p[n >> 1]) << 8) | p[n - 1];
+        }
+
+        return fold_multiply(a ^ k1 ^ h, fold_multiply(b ^ k2, h ^ k0));
+    }
+
+    namespace {
+
+        constexpr int32_t max_displacement = 1 << 24;
+        constexpr int max_seeds = 16;
+
+        bool try_build(std::span<const std::string_view> keys, uint64_t seed, PerfectHash& out)
+        {
+            const std::size_t n = keys.size();
+            const std::size_t bucketCount = std::max<std::size_t>(1, n / 4);
+
+            std::vector<uint64_t> hashes(n);
+            for (std::size_t i = 0; i < n; ++i)
+                hashes[i] = hash_name(keys[i], seed);
+
+            /*
+                Group keys by bucket (counting sort), then place the
+                largest buckets first while most slots are still free.
+            */
+            std::vector<uint32_t> bucketStart(bucketCount + 1, 0);
+            for (uint64_t h : hashes)
+                ++bucketStart[reduce_hash(h, bucketCount) + 1];
+            std::partial_sum(bucketStart.begin(), bucketStart.end(), bucketStart.begin());
+
+            std::vector<uint32_t> bucketKeys(n);
+            {
+                std::vector<uint32_t> fill(bucketStart.begin(), bucketStart.end() - 1);
+                for (uint32_t i = 0; i < n; ++i)
+                    bucketKeys[fill[reduce_hash(hashes[i], bucketCount)]++] = i;
+            }
+
+            std::vector<uint32_t> order(bucketCount);
+            std::iota(order.begin(), order.end(), 0u);
+            std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+                return bucketStart[a + 1] - bucketStart[a] > bucketStart[b + 1] - bucketStart[b];
+            });
+
+            constexpr uint32_t free_slot = UINT32_MAX;
+            out.seed = seed;
+            out.displacements.assign(bucketCount, 0);
+            out.slots.assign(n, free_slot);
+
+            std::vector<uint64_t> candidate;
+            std::size_t nextFree = 0;
+
+            for (uint32_t bucket : order) {
+                const uint32_t* first = bucketKeys.data() + bucketStart[bucket];
+                const std::size_t size = bucketStart[bucket + 1] - bucketStart[bucket];
+
+                if (size == 0)
+                    break; // Sorted by size, so the rest are empty too.
+
+                if (size == 1) {
+                    while (out.slots[nextFree] != free_slot)
+                        ++nextFree;
+                    out.slots[nextFree] = first[0];
+                    out.displacements[bucket] = -int32_t(nextFree) - 1;
+                    continue;
+                }
+
+                // Equal hashes cannot be separated by any displacement.
+                for (std::size_t a = 0; a < size; ++a) {
+                    for (std::size_t b = a + 1; b < size; ++b) {
+                        if (hashes[first[a]] != hashes[first[b]])
+                            continue;
+                        if (keys[first[a]] == keys[first[b]])
+                            throw DuplicateKeyError(std::min(first[a], first[b]), std::max(first[a], first[b]));
+                        return false; // True 64-bit collision: reseed.
+                    }
+                }
+
+                candidate.resize(size);
+                bool placed = false;
+
+                for (int32_t d = 0; d < max_displacement && !placed; ++d) {
+                    placed = true;
+                    for (std::size_t k = 0; k < size && placed; ++k) {
+                        uint64_t slot = reduce_hash(mix_hash(hashes[first[k]] ^ (uint64_t(d) * 0x9e3779b97f4a7c15ULL)), n);
+                        if (out.slots[slot] != free_slot ||
+                            std::find(candidate.begin(), candidate.begin() + k, slot) != candidate.begin() + k) {
+                            placed = false;
+                        }
+                        candidate[k] = slot;
+                    }
+
+                    if (placed) {
+                        for (std::size_t k = 0; k < size; ++k)
+                            out.slots[candidate[k]] = first[k];
+                        out.displacements[bucket] = d;
+                    }
+                }
+
+                if (!placed)
+                    return false;
+            }
+
+            return true;
+        }
+
+    } // namespace
+
+    PerfectHash build_perfect_hash(std::span<const std::string_view> keys)
+    {
+        PerfectHash result;
+        if (keys.empty())
+            return result;
+
+        for (int attempt = 0; attempt < max_seeds; ++attempt) {
+            if (try_build(keys, uint64_t(attempt + 1), result))
+                return result;
+        }
+
+        throw std::runtime_error("Failed to build perfect hash");
+    }
+
+} // namespace blaze::detail
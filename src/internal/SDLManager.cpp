@@ -19,7 +19,8 @@ namespace blaze::detail {
             if (flags == 0)
                 return true;
 
-            if (SDL_InitSubSystem(flags) != 0)
+            // SDL3 reports success as true
+            if (!SDL_InitSubSystem(flags))
                 return false;
 
             initialized_flags |= flags;
@@ -33,7 +34,7 @@ namespace blaze::detail {
 
         // First-time init (base SDL)
         if (initialized_flags == 0) {
-            if (SDL_Init(0) != 0) {
+            if (!SDL_Init(0)) {
                 SDL_Log("Blaze2D: SDL_Init failed: %s", SDL_GetError());
                 return;
             }
@@ -3,14 +3,174 @@
 
 namespace blaze
 {
-	/*
-	Container::Container(Container& _parent_container) : parent_container(&_parent_container), parent_window(nullptr)
+	Container::Container(Window& _parent_window)
+		: Container(_parent_window.getRoot())
 	{
+	}
+
+	Container::Container(Container& _parent_container)
+	{
+		attach(_parent_container);
+	}
+
+	Container::Container(Window& _parent_window, const Rect& _rect)
+		: Container(_parent_window.getRoot(), _rect)
+	{
+	}
+
+	Container::Container(Container& _parent_container, const Rect& _rect)
+	{
+		attach(_parent_container);
+		store->rect(id) = _rect;
+		store->size(id) = _rect.size();
+		store->anchor(id) = OVERRIDE;
+	}
+
+	Container::Container(Window& _window, const Rect& _rect, std::nullptr_t)
+		: store(&_window.containers), parent_window(&_window)
+	{
+		id = store->create(this, ContainerStore::npos);
+		store->rect(id) = _rect;
+		store->size(id) = _rect.size();
+		store->anchor(id) = OVERRIDE;
+	}
+
+	Container::~Container()
+	{
+		if (parent_window->focusContainer == this)
+			parent_window->focusContainer = nullptr;
+		if (parent_window->captureContainer == this)
+			parent_window->captureContainer = nullptr;
+
+		store->destroy(id);
+	}
 
+	void Container::attach(Container& _parent_container)
+	{
+		store = _parent_container.store;
+		parent_window = _parent_container.parent_window;
+		id = store->create(this, _parent_container.id);
 	}
-	Container::Container(Window& _parent_window) : parent_window(&_parent_window), parent_container(nullptr)
+
+	/* =========================
+	   Layout properties
+	   ========================= */
+
+	void Container::setRect(const Rect& _rect)
 	{
+		if (getAnchor() == OVERRIDE && getRect() == _rect)
+			return;
+
+		store->rect(id) = _rect;
+		store->size(id) = _rect.size();
+		store->anchor(id) = OVERRIDE;
+		store->markPlacementDirty(id);
+		store->markChildrenDirty(id);
+	}
+
+	void Container::setAnchor(Anchor _anchor)
+	{
+		if (getAnchor() != _anchor) {
+			store->anchor(id) = static_cast<uint8_t>(_anchor);
+			store->markPlacementDirty(id);
+		}
+	}
+
+	void Container::setSize(const Vec2& _size)
+	{
+		if (getSize() != _size) {
+			store->size(id) = _size;
+			store->markPlacementDirty(id);
+		}
+	}
+
+	void Container::setOffset(const Vec2& _offset)
+	{
+		if (getOffset() != _offset) {
+			store->offset(id) = _offset;
+			store->markPlacementDirty(id);
+		}
+	}
+
+	void Container::setGrow(float _grow)
+	{
+		if (getGrow() != _grow) {
+			store->grow(id) = _grow;
+			store->markPlacementDirty(id);
+		}
+	}
 
+	void Container::setDirection(LayoutDirection _direction)
+	{
+		if (getDirection() != _direction) {
+			store->direction(id) = static_cast<uint8_t>(_direction);
+			store->markChildrenDirty(id);
+		}
+	}
+
+	void Container::setPadding(float _padding)
+	{
+		if (getPadding() != _padding) {
+			store->padding(id) = _padding;
+			store->markChildrenDirty(id);
+		}
+	}
+
+	void Container::setGap(float _gap)
+	{
+		if (getGap() != _gap) {
+			store->gap(id) = _gap;
+			store->markChildrenDirty(id);
+		}
+	}
+
+	void Container::setVisible(bool _visible)
+	{
+		if (isVisible() == _visible)
+			return;
+
+		uint8_t& flags = store->flags(id);
+		flags = _visible ? (flags | ContainerStore::VISIBLE) : (flags & ~ContainerStore::VISIBLE);
+		invalidate();
+	}
+
+	void Container::invalidate()
+	{
+		parent_window->invalidate(getWindowRect());
+	}
+
+	/* =========================
+	   Input
+	   ========================= */
+
+	EventResult Container::handleEvent(const SDL_Event& event, EventPhase phase)
+	{
+		return event_handler ? event_handler(*this, event, phase) : EventResult::Ignored;
+	}
+
+	void Container::focus()
+	{
+		parent_window->focusContainer = this;
+	}
+
+	bool Container::hasFocus() const
+	{
+		return parent_window->focusContainer == this;
+	}
+
+	void Container::capturePointer()
+	{
+		parent_window->captureContainer = this;
+	}
+
+	void Container::releasePointer()
+	{
+		if (parent_window->captureContainer == this)
+			parent_window->captureContainer = nullptr;
+	}
+
+	bool Container::hasPointerCapture() const
+	{
+		return parent_window->captureContainer == this;
 	}
-	*/
-}
\ No newline at end of file
+}
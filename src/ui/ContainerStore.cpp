@@ -0,0 +1,502 @@
+#include "Blaze2D/ui/ContainerStore.h"
+#include "Blaze2D/ui/Container.h"
+#include "Blaze2D/util/FrameArena.h"
+
+#include <algorithm>
+#include <memory_resource>
+#include <span>
+
+namespace blaze
+{
+	namespace {
+
+		// 0 = start, 1 = center, 2 = end
+		int horizontal_align(uint8_t anchor)
+		{
+			switch (anchor) {
+			case TOP_LEFT: case MIDDLE_LEFT: case BOTTOM_LEFT: return 0;
+			case TOP_RIGHT: case MIDDLE_RIGHT: case BOTTOM_RIGHT: return 2;
+			default: return 1;
+			}
+		}
+
+		int vertical_align(uint8_t anchor)
+		{
+			switch (anchor) {
+			case TOP_LEFT: case TOP_CENTER: case TOP_RIGHT: return 0;
+			case BOTTOM_LEFT: case BOTTOM_CENTER: case BOTTOM_RIGHT: return 2;
+			default: return 1;
+			}
+		}
+
+		// Position of an extent of 'length' within [start, start + space).
+		float align(int alignment, float start, float space, float length, float offset)
+		{
+			switch (alignment) {
+			case 0: return start + offset;
+			case 2: return start + space - length - offset;
+			default: return start + (space - length) * 0.5f + offset;
+			}
+		}
+
+		template <typename T>
+		void permute(std::vector<T>& values, std::span<const uint32_t> order)
+		{
+			std::vector<T> sorted;
+			sorted.reserve(order.size());
+			for (uint32_t old : order)
+				sorted.push_back(values[old]);
+			values.swap(sorted);
+		}
+
+		constexpr uint8_t pass_flags = ContainerStore::CHILDREN_DIRTY | ContainerStore::SUBTREE_DIRTY
+			| ContainerStore::RESIZED | ContainerStore::MOVED;
+
+	} // namespace
+
+	/* =========================
+	   Entries
+	   ========================= */
+
+	uint32_t ContainerStore::create(Container* owner, uint32_t parentId)
+	{
+		uint32_t id;
+		if (!free_ids.empty()) {
+			id = free_ids.back();
+			free_ids.pop_back();
+		}
+		else {
+			id = static_cast<uint32_t>(owners.size());
+			owners.push_back(nullptr);
+			index_of.push_back(npos);
+			generations.push_back(0);
+		}
+
+		const uint32_t index = static_cast<uint32_t>(rects.size());
+		const uint32_t parent = parentId == npos ? npos : index_of[parentId];
+
+		rects.emplace_back();
+		world.emplace_back();
+		sizes.emplace_back();
+		offsets.emplace_back();
+		grows.push_back(0.0f);
+		paddings.push_back(0.0f);
+		gaps.push_back(0.0f);
+		anchors.push_back(CENTER);
+		directions.push_back(static_cast<uint8_t>(LayoutDirection::None));
+		flag_bits.push_back(VISIBLE | CHILDREN_DIRTY);
+		parents.push_back(parent);
+		subtree_ends.push_back(index + 1);
+		id_of.push_back(id);
+
+		index_of[id] = index;
+		owners[id] = owner;
+		++live;
+
+		if (parent != npos) {
+			/*
+				Appending right after the parent's subtree keeps the arrays
+				depth-first: extend the subtrees that end here. Anything
+				else needs a re-sort before the next traversal.
+			*/
+			if (!order_dirty && subtree_ends[parent] == index) {
+				for (uint32_t p = parent; p != npos && subtree_ends[p] == index; p = parents[p])
+					subtree_ends[p] = index + 1;
+			}
+			else {
+				order_dirty = true;
+			}
+			markChildrenDirtyAt(parent);
+		}
+
+		return id;
+	}
+
+	void ContainerStore::destroy(uint32_t id)
+	{
+		const uint32_t index = index_of[id];
+		const uint32_t parent = parents[index];
+		if (parent != npos && !(flag_bits[parent] & DEAD))
+			markChildrenDirtyAt(parent);
+
+		flag_bits[index] |= DEAD;
+		owners[id] = nullptr;
+		index_of[id] = npos;
+		++generations[id];
+		free_ids.push_back(id);
+		--live;
+
+		// Compact once holes outnumber live entries.
+		if (++dead > live)
+			order_dirty = true;
+	}
+
+	Container* ContainerStore::parent(uint32_t id) const
+	{
+		const uint32_t p = parents[index_of[id]];
+		if (p == npos || (flag_bits[p] & DEAD))
+			return nullptr;
+		return owners[id_of[p]];
+	}
+
+	/* =========================
+	   Dirty tracking
+	   ========================= */
+
+	void ContainerStore::markPlacementDirty(uint32_t id)
+	{
+		const uint32_t p = parents[index_of[id]];
+		if (p != npos && !(flag_bits[p] & DEAD))
+			markChildrenDirtyAt(p);
+	}
+
+	void ContainerStore::markChildrenDirty(uint32_t id)
+	{
+		markChildrenDirtyAt(index_of[id]);
+	}
+
+	void ContainerStore::markChildrenDirtyAt(uint32_t index)
+	{
+		flag_bits[index] |= CHILDREN_DIRTY;
+
+		/*
+			Stop at the first ancestor that is already marked: everything
+			above it was marked at the same time and is only cleared by a
+			layout pass that also clears this subtree.
+		*/
+		for (uint32_t p = parents[index]; p != npos && !(flag_bits[p] & SUBTREE_DIRTY); p = parents[p])
+			flag_bits[p] |= SUBTREE_DIRTY;
+	}
+
+	/* =========================
+	   Ordering
+	   ========================= */
+
+	void ContainerStore::ensureOrdered()
+	{
+		if (order_dirty)
+			rebuild();
+	}
+
+	void ContainerStore::rebuild()
+	{
+		const uint32_t count = static_cast<uint32_t>(rects.size());
+
+		// Scratch lives in the frame arena; only the permuted arrays are kept.
+		FrameArena::Scope scope(FrameArena::local());
+		std::pmr::memory_resource* scratch = &scope.arena();
+
+		/*
+			Link children in index order. Entries that were already
+			depth-first come before appended ones, so siblings keep the
+			order in which they were created.
+		*/
+		std::pmr::vector<uint32_t> firstChild(count, npos, scratch);
+		std::pmr::vector<uint32_t> lastChild(count, npos, scratch);
+		std::pmr::vector<uint32_t> nextSibling(count, npos, scratch);
+		std::pmr::vector<uint32_t> roots(scratch);
+
+		for (uint32_t i = 0; i < count; ++i) {
+			if (flag_bits[i] & DEAD)
+				continue;
+
+			const uint32_t p = parents[i];
+			if (p == npos || (flag_bits[p] & DEAD)) {
+				roots.push_back(i);
+				continue;
+			}
+
+			if (firstChild[p] == npos)
+				firstChild[p] = i;
+			else
+				nextSibling[lastChild[p]] = i;
+			lastChild[p] = i;
+		}
+
+		// Iterative pre-order walk; 'ends' gets the new end of each old entry's subtree.
+		std::pmr::vector<uint32_t> order(scratch);
+		order.reserve(live);
+		std::pmr::vector<uint32_t> ends(count, npos, scratch);
+		std::pmr::vector<uint32_t> stack(scratch);
+		std::pmr::vector<uint32_t> cursor(scratch);
+
+		for (uint32_t root : roots) {
+			order.push_back(root);
+			stack.push_back(root);
+			cursor.push_back(firstChild[root]);
+
+			while (!stack.empty()) {
+				const uint32_t child = cursor.back();
+				if (child == npos) {
+					ends[stack.back()] = static_cast<uint32_t>(order.size());
+					stack.pop_back();
+					cursor.pop_back();
+					continue;
+				}
+
+				cursor.back() = nextSibling[child];
+				order.push_back(child);
+				stack.push_back(child);
+				cursor.push_back(firstChild[child]);
+			}
+		}
+
+		std::pmr::vector<uint32_t> newIndex(count, npos, scratch);
+		for (uint32_t k = 0; k < order.size(); ++k)
+			newIndex[order[k]] = k;
+
+		std::vector<uint32_t> newParents(order.size());
+		std::vector<uint32_t> newEnds(order.size());
+		for (uint32_t k = 0; k < order.size(); ++k) {
+			const uint32_t old = order[k];
+			const uint32_t p = parents[old];
+			newParents[k] = (p == npos || (flag_bits[p] & DEAD)) ? npos : newIndex[p];
+			newEnds[k] = ends[old];
+		}
+		parents.swap(newParents);
+		subtree_ends.swap(newEnds);
+
+		permute(rects, order);
+		permute(world, order);
+		permute(sizes, order);
+		permute(offsets, order);
+		permute(grows, order);
+		permute(paddings, order);
+		permute(gaps, order);
+		permute(anchors, order);
+		permute(directions, order);
+		permute(flag_bits, order);
+		permute(id_of, order);
+
+		for (uint32_t k = 0; k < id_of.size(); ++k)
+			index_of[id_of[k]] = k;
+
+		dead = 0;
+		order_dirty = false;
+	}
+
+	/* =========================
+	   Traversals
+	   ========================= */
+
+	ContainerStore::ChildIterator::ChildIterator(const ContainerStore* store, uint32_t index, uint32_t limit)
+		: store(store), index(index), limit(limit)
+	{
+		skipDead();
+	}
+
+	void ContainerStore::ChildIterator::skipDead()
+	{
+		while (index < limit && (store->flag_bits[index] & DEAD))
+			index = store->subtree_ends[index];
+	}
+
+	Container* ContainerStore::ChildIterator::operator*() const
+	{
+		return store->owners[store->id_of[index]];
+	}
+
+	ContainerStore::ChildIterator& ContainerStore::ChildIterator::operator++()
+	{
+		index = store->subtree_ends[index];
+		skipDead();
+		return *this;
+	}
+
+	ContainerStore::ChildRange ContainerStore::children(uint32_t id)
+	{
+		ensureOrdered();
+		const uint32_t index = index_of[id];
+		const uint32_t end = subtree_ends[index];
+		return { ChildIterator(this, index + 1, end), ChildIterator(this, end, end) };
+	}
+
+	std::size_t ContainerStore::layout(uint32_t id)
+	{
+		ensureOrdered();
+
+		const uint32_t start = index_of[id];
+		const uint32_t stop = subtree_ends[start];
+
+		// The start entry follows its parent's window rect; nothing above it is touched.
+		const uint32_t p = parents[start];
+		const Vec2 origin = (p != npos && !(flag_bits[p] & DEAD)) ? world[p].position() : Vec2();
+		const Rect startRect = rects[start].translated(origin);
+		if (startRect != world[start]) {
+			world[start] = startRect;
+			flag_bits[start] |= MOVED;
+		}
+
+		/*
+			Pre-order scan: parents come before their children, so each
+			entry's window rect is final by the time its children are
+			placed. Clean subtrees are skipped as a whole.
+		*/
+		std::size_t count = 0;
+		for (uint32_t i = start; i < stop;) {
+			const uint8_t f = flag_bits[i];
+			if ((f & DEAD) || !(f & pass_flags)) {
+				i = subtree_ends[i];
+				continue;
+			}
+
+			if (f & (CHILDREN_DIRTY | RESIZED))
+				count += arrange(i);
+
+			if (f & MOVED) {
+				const Vec2 base = world[i].position();
+				for (uint32_t c = i + 1; c < subtree_ends[i]; c = subtree_ends[c]) {
+					world[c] = rects[c].translated(base);
+					flag_bits[c] |= MOVED;
+				}
+			}
+
+			flag_bits[i] &= static_cast<uint8_t>(~pass_flags);
+			++i;
+		}
+
+		return count;
+	}
+
+	std::size_t ContainerStore::arrange(uint32_t index)
+	{
+		const Rect& rect = rects[index];
+		const float padding = paddings[index];
+		const float gap = gaps[index];
+		const LayoutDirection direction = static_cast<LayoutDirection>(directions[index]);
+		const uint32_t end = subtree_ends[index];
+
+		const float contentW = std::max(0.0f, rect.w - 2.0f * padding);
+		const float contentH = std::max(0.0f, rect.h - 2.0f * padding);
+
+		/*
+			Row/Column: the first pass totals the preferred main-axis sizes
+			and grow factors of the children in the flow, the second hands
+			out the free space in proportion to grow.
+		*/
+		const bool row = direction == LayoutDirection::Row;
+		const float contentMain = row ? contentW : contentH;
+		const float contentCross = row ? contentH : contentW;
+
+		float cursor = padding;
+		float freeSpace = 0.0f;
+		float totalGrow = 0.0f;
+
+		if (direction != LayoutDirection::None) {
+			std::size_t inFlow = 0;
+			float used = 0.0f;
+			for (uint32_t c = index + 1; c < end; c = subtree_ends[c]) {
+				if ((flag_bits[c] & DEAD) || anchors[c] == OVERRIDE)
+					continue;
+				used += row ? sizes[c].x : sizes[c].y;
+				totalGrow += grows[c];
+				++inFlow;
+			}
+			if (inFlow > 1)
+				used += gap * float(inFlow - 1);
+			freeSpace = std::max(0.0f, contentMain - used);
+		}
+
+		const Vec2 base = world[index].position();
+		std::size_t count = 0;
+
+		for (uint32_t c = index + 1; c < end; c = subtree_ends[c]) {
+			if (flag_bits[c] & DEAD)
+				continue;
+
+			const Vec2& size = sizes[c];
+			const Vec2& offset = offsets[c];
+			const uint8_t anchor = anchors[c];
+			Rect next = rects[c];
+
+			if (anchor == OVERRIDE) {
+				// Placed by setRect().
+			}
+			else if (direction == LayoutDirection::None) {
+				next.w = size.x > 0.0f ? size.x : contentW;
+				next.h = size.y > 0.0f ? size.y : contentH;
+				next.x = align(horizontal_align(anchor), padding, contentW, next.w, offset.x);
+				next.y = align(vertical_align(anchor), padding, contentH, next.h, offset.y);
+			}
+			else {
+				float main = row ? size.x : size.y;
+				if (totalGrow > 0.0f)
+					main += freeSpace * grows[c] / totalGrow;
+
+				float cross = row ? size.y : size.x;
+				if (cross <= 0.0f)
+					cross = contentCross;
+
+				if (row) {
+					next = Rect(cursor + offset.x,
+						align(vertical_align(anchor), padding, contentCross, cross, offset.y),
+						main, cross);
+				}
+				else {
+					next = Rect(align(horizontal_align(anchor), padding, contentCross, cross, offset.x),
+						cursor + offset.y,
+						cross, main);
+				}
+				cursor += main + gap;
+			}
+
+			if (next.w != rects[c].w || next.h != rects[c].h)
+				flag_bits[c] |= RESIZED;
+
+			const Rect placed = next.translated(base);
+			if (placed != world[c]) {
+				world[c] = placed;
+				flag_bits[c] |= MOVED;
+			}
+
+			rects[c] = next;
+			++count;
+		}
+
+		return count;
+	}
+
+	Container* ContainerStore::hitTest(uint32_t id, const Vec2& point)
+	{
+		ensureOrdered();
+
+		const uint32_t start = index_of[id];
+		const uint32_t stop = subtree_ends[start];
+
+		/*
+			Descend into every entry containing the point. Later siblings
+			come later in pre-order, so the last hit is the topmost,
+			deepest one.
+		*/
+		Container* hit = nullptr;
+		for (uint32_t i = start; i < stop;) {
+			const uint8_t f = flag_bits[i];
+			if ((f & DEAD) || !(f & VISIBLE) || !world[i].contains(point)) {
+				i = subtree_ends[i];
+				continue;
+			}
+			hit = owners[id_of[i]];
+			++i;
+		}
+		return hit;
+	}
+
+	void ContainerStore::cull(uint32_t id, const Rect& area, std::vector<Container*>& out)
+	{
+		ensureOrdered();
+
+		const uint32_t start = index_of[id];
+		const uint32_t stop = subtree_ends[start];
+
+		for (uint32_t i = start; i < stop;) {
+			const uint8_t f = flag_bits[i];
+			if ((f & DEAD) || !(f & VISIBLE) || !world[i].intersects(area)) {
+				i = subtree_ends[i];
+				continue;
+			}
+			out.push_back(owners[id_of[i]]);
+			++i;
+		}
+	}
+
+} // namespace blaze
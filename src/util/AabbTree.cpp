@@ -0,0 +1,495 @@
+#include "Blaze2D/util/SpatialIndex.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace blaze
+{
+    namespace {
+
+        // Traversal stack that stays on the C++ stack for any balanced tree.
+        class NodeStack
+        {
+        public:
+            void push(uint32_t node)
+            {
+                if (size < local_size)
+                    local[size] = node;
+                else
+                    spill.push_back(node);
+                ++size;
+            }
+
+            uint32_t pop()
+            {
+                --size;
+                if (size < local_size)
+                    return local[size];
+                uint32_t node = spill.back();
+                spill.pop_back();
+                return node;
+            }
+
+            bool empty() const { return size == 0; }
+
+        private:
+            static constexpr std::size_t local_size = 128;
+            uint32_t local[local_size];
+            std::vector<uint32_t> spill;
+            std::size_t size = 0;
+        };
+
+        template <typename Box>
+        Box combine(const Box& a, const Box& b)
+        {
+            return { std::min(a.minX, b.minX), std::min(a.minY, b.minY),
+                std::max(a.maxX, b.maxX), std::max(a.maxY, b.maxY) };
+        }
+
+        template <typename Box>
+        float perimeter(const Box& b)
+        {
+            return 2.0f * ((b.maxX - b.minX) + (b.maxY - b.minY));
+        }
+
+        template <typename Box>
+        bool overlaps(const Box& a, const Box& b)
+        {
+            return a.minX <= b.maxX && b.minX <= a.maxX && a.minY <= b.maxY && b.minY <= a.maxY;
+        }
+
+        template <typename Box>
+        bool encloses(const Box& outer, const Box& inner)
+        {
+            return outer.minX <= inner.minX && outer.minY <= inner.minY
+                && inner.maxX <= outer.maxX && inner.maxY <= outer.maxY;
+        }
+
+        // Normalized corners of a Rect; a superset of what Rect::intersects can match.
+        template <typename Box>
+        Box box_of(const Rect& r)
+        {
+            const float right = r.right();
+            const float bottom = r.bottom();
+            return { std::min(r.x, right), std::min(r.y, bottom), std::max(r.x, right), std::max(r.y, bottom) };
+        }
+
+    } // namespace
+
+    AabbTree::AabbTree(float margin)
+        : margin(margin)
+    {
+        if (margin < 0.0f)
+            throw std::invalid_argument("AabbTree: margin must not be negative");
+    }
+
+    /* =========================
+       Node pool
+       ========================= */
+
+    uint32_t AabbTree::allocate()
+    {
+        uint32_t node;
+        if (free_list != npos) {
+            node = free_list;
+            free_list = nodes[node].parent;
+        }
+        else {
+            node = static_cast<uint32_t>(nodes.size());
+            nodes.emplace_back();
+        }
+
+        Node& n = nodes[node];
+        n.parent = npos;
+        n.child1 = npos;
+        n.child2 = npos;
+        n.height = 0;
+        n.value = 0;
+        return node;
+    }
+
+    void AabbTree::release(uint32_t node)
+    {
+        nodes[node].parent = free_list;
+        nodes[node].height = -1;
+        free_list = node;
+    }
+
+    void AabbTree::clear()
+    {
+        nodes.clear();
+        root = npos;
+        free_list = npos;
+        count = 0;
+    }
+
+    /* =========================
+       Proxies
+       ========================= */
+
+    AabbTree::Box AabbTree::fatten(const Rect& bounds, const Vec2& displacement) const
+    {
+        Box b = box_of<Box>(bounds);
+        b.minX -= margin;
+        b.minY -= margin;
+        b.maxX += margin;
+        b.maxY += margin;
+
+        // Stretch towards the predicted motion only.
+        (displacement.x < 0.0f ? b.minX : b.maxX) += displacement.x;
+        (displacement.y < 0.0f ? b.minY : b.maxY) += displacement.y;
+        return b;
+    }
+
+    uint32_t AabbTree::insert(const Rect& bounds, uint32_t value)
+    {
+        const uint32_t leaf = allocate();
+        nodes[leaf].box = fatten(bounds, {});
+        nodes[leaf].bounds = bounds;
+        nodes[leaf].value = value;
+
+        insertLeaf(leaf);
+        ++count;
+        return leaf;
+    }
+
+    void AabbTree::remove(uint32_t proxy)
+    {
+        if (proxy >= nodes.size() || nodes[proxy].height != 0)
+            throw std::out_of_range("AabbTree: invalid proxy");
+
+        removeLeaf(proxy);
+        release(proxy);
+        --count;
+    }
+
+    bool AabbTree::move(uint32_t proxy, const Rect& bounds, const Vec2& displacement)
+    {
+        if (proxy >= nodes.size() || nodes[proxy].height != 0)
+            throw std::out_of_range("AabbTree: invalid proxy");
+
+        Node& leaf = nodes[proxy];
+        leaf.bounds = bounds;
+
+        /*
+            Keep the leaf while its fat box still encloses the new bounds,
+            unless the box has become much larger than needed (e.g. after
+            a fast move that stopped), which would make queries coarse.
+        */
+        const Box tight = box_of<Box>(bounds);
+        if (encloses(leaf.box, tight)) {
+            Box loose = fatten(bounds, displacement);
+            const float slack = 4.0f * margin;
+            loose.minX -= slack;
+            loose.minY -= slack;
+            loose.maxX += slack;
+            loose.maxY += slack;
+            if (encloses(loose, leaf.box))
+                return false;
+        }
+
+        removeLeaf(proxy);
+        nodes[proxy].box = fatten(bounds, displacement);
+        insertLeaf(proxy);
+        return true;
+    }
+
+    Rect AabbTree::getFatBounds(uint32_t proxy) const
+    {
+        const Box& b = nodes[proxy].box;
+        return Rect(b.minX, b.minY, b.maxX - b.minX, b.maxY - b.minY);
+    }
+
+    int AabbTree::height() const
+    {
+        return root == npos ? 0 : nodes[root].height;
+    }
+
+    /* =========================
+       Tree maintenance
+       ========================= */
+
+    void AabbTree::insertLeaf(uint32_t leaf)
+    {
+        if (root == npos) {
+            root = leaf;
+            nodes[leaf].parent = npos;
+            return;
+        }
+
+        /*
+            Walk down to the cheapest sibling. Pairing with a node costs the
+            perimeter of the new parent; every ancestor on the way grows by
+            the same amount ("inheritance"). Stop when creating the parent
+            here is cheaper than descending into either child.
+        */
+        const Box leafBox = nodes[leaf].box;
+        uint32_t index = root;
+        while (!nodes[index].isLeaf()) {
+            const Node& node = nodes[index];
+            const float area = perimeter(node.box);
+            const float combinedArea = perimeter(combine(node.box, leafBox));
+
+            const float cost = 2.0f * combinedArea;
+            const float inheritance = 2.0f * (combinedArea - area);
+
+            auto descendCost = [&](uint32_t child) {
+                const Node& c = nodes[child];
+                const float grown = perimeter(combine(leafBox, c.box));
+                return (c.isLeaf() ? grown : grown - perimeter(c.box)) + inheritance;
+            };
+            const float cost1 = descendCost(node.child1);
+            const float cost2 = descendCost(node.child2);
+
+            if (cost < cost1 && cost < cost2)
+                break;
+            index = cost1 < cost2 ? node.child1 : node.child2;
+        }
+
+        const uint32_t sibling = index;
+        const uint32_t oldParent = nodes[sibling].parent;
+        const uint32_t newParent = allocate();
+
+        Node& parent = nodes[newParent];
+        parent.parent = oldParent;
+        parent.box = combine(leafBox, nodes[sibling].box);
+        parent.height = nodes[sibling].height + 1;
+        parent.child1 = sibling;
+        parent.child2 = leaf;
+
+        if (oldParent != npos) {
+            if (nodes[oldParent].child1 == sibling)
+                nodes[oldParent].child1 = newParent;
+            else
+                nodes[oldParent].child2 = newParent;
+        }
+        else {
+            root = newParent;
+        }
+        nodes[sibling].parent = newParent;
+        nodes[leaf].parent = newParent;
+
+        for (uint32_t i = nodes[leaf].parent; i != npos; i = nodes[i].parent) {
+            i = balance(i);
+            refit(i);
+        }
+    }
+
+    void AabbTree::removeLeaf(uint32_t leaf)
+    {
+        if (leaf == root) {
+            root = npos;
+            return;
+        }
+
+        const uint32_t parent = nodes[leaf].parent;
+        const uint32_t grandParent = nodes[parent].parent;
+        const uint32_t sibling = nodes[parent].child1 == leaf ? nodes[parent].child2 : nodes[parent].child1;
+
+        release(parent);
+
+        if (grandParent == npos) {
+            root = sibling;
+            nodes[sibling].parent = npos;
+            return;
+        }
+
+        if (nodes[grandParent].child1 == parent)
+            nodes[grandParent].child1 = sibling;
+        else
+            nodes[grandParent].child2 = sibling;
+        nodes[sibling].parent = grandParent;
+
+        for (uint32_t i = grandParent; i != npos; i = nodes[i].parent) {
+            i = balance(i);
+            refit(i);
+        }
+    }
+
+    void AabbTree::refit(uint32_t node)
+    {
+        Node& n = nodes[node];
+        n.box = combine(nodes[n.child1].box, nodes[n.child2].box);
+        n.height = 1 + std::max(nodes[n.child1].height, nodes[n.child2].height);
+    }
+
+    /*
+        AVL rotation: if one child of 'a' is more than one level taller than
+        the other, lift it into a's place and hand its shorter grandchild to
+        'a'. Returns the node now at a's position.
+    */
+    uint32_t AabbTree::balance(uint32_t a)
+    {
+        Node& A = nodes[a];
+        if (A.isLeaf() || A.height < 2)
+            return a;
+
+        const uint32_t b = A.child1;
+        const uint32_t c = A.child2;
+        const int32_t diff = nodes[c].height - nodes[b].height;
+        if (diff >= -1 && diff <= 1)
+            return a;
+
+        // 'up' is the taller child, 'keep' stays under 'a'.
+        const bool rightHeavy = diff > 1;
+        const uint32_t up = rightHeavy ? c : b;
+        const uint32_t keep = rightHeavy ? b : c;
+        Node& U = nodes[up];
+
+        const uint32_t f = U.child1;
+        const uint32_t g = U.child2;
+
+        // Swap 'a' and 'up'.
+        U.child1 = a;
+        U.parent = A.parent;
+        A.parent = up;
+        if (U.parent != npos) {
+            if (nodes[U.parent].child1 == a)
+                nodes[U.parent].child1 = up;
+            else
+                nodes[U.parent].child2 = up;
+        }
+        else {
+            root = up;
+        }
+
+        // The taller grandchild stays with 'up', the shorter one moves to 'a'.
+        const bool fTaller = nodes[f].height > nodes[g].height;
+        const uint32_t stay = fTaller ? f : g;
+        const uint32_t move = fTaller ? g : f;
+
+        U.child2 = stay;
+        if (rightHeavy)
+            A.child2 = move;
+        else
+            A.child1 = move;
+        nodes[move].parent = a;
+
+        A.box = combine(nodes[keep].box, nodes[move].box);
+        A.height = 1 + std::max(nodes[keep].height, nodes[move].height);
+        U.box = combine(A.box, nodes[stay].box);
+        U.height = 1 + std::max(A.height, nodes[stay].height);
+        return up;
+    }
+
+    /* =========================
+       Queries
+       ========================= */
+
+    std::size_t AabbTree::query(const Rect& area, std::vector<uint32_t>& out) const
+    {
+        if (root == npos)
+            return 0;
+
+        const std::size_t before = out.size();
+        const Box box = box_of<Box>(area);
+
+        NodeStack stack;
+        stack.push(root);
+        while (!stack.empty()) {
+            const Node& node = nodes[stack.pop()];
+            if (!overlaps(node.box, box))
+                continue;
+
+            if (node.isLeaf()) {
+                if (node.bounds.intersects(area))
+                    out.push_back(node.value);
+            }
+            else {
+                stack.push(node.child1);
+                stack.push(node.child2);
+            }
+        }
+        return out.size() - before;
+    }
+
+    std::size_t AabbTree::queryPoint(const Vec2& point, std::vector<uint32_t>& out) const
+    {
+        if (root == npos)
+            return 0;
+
+        const std::size_t before = out.size();
+
+        NodeStack stack;
+        stack.push(root);
+        while (!stack.empty()) {
+            const Node& node = nodes[stack.pop()];
+            const Box& b = node.box;
+            if (point.x < b.minX || point.x > b.maxX || point.y < b.minY || point.y > b.maxY)
+                continue;
+
+            if (node.isLeaf()) {
+                if (node.bounds.contains(point))
+                    out.push_back(node.value);
+            }
+            else {
+                stack.push(node.child1);
+                stack.push(node.child2);
+            }
+        }
+        return out.size() - before;
+    }
+
+    std::size_t AabbTree::queryPairs(std::vector<SpatialPair>& out) const
+    {
+        if (root == npos)
+            return 0;
+
+        const std::size_t before = out.size();
+
+        /*
+            Self-collision of the tree: a node paired with itself splits
+            into its children's self pairs plus the pair of its children;
+            two different nodes are compared only while their boxes
+            overlap, descending into the taller one. Each leaf pair is met
+            once.
+        */
+        NodeStack stack;
+        stack.push(root);
+        stack.push(root);
+        while (!stack.empty()) {
+            const uint32_t b = stack.pop();
+            const uint32_t a = stack.pop();
+            const Node& A = nodes[a];
+            const Node& B = nodes[b];
+
+            if (a == b) {
+                if (!A.isLeaf()) {
+                    stack.push(A.child1);
+                    stack.push(A.child1);
+                    stack.push(A.child2);
+                    stack.push(A.child2);
+                    stack.push(A.child1);
+                    stack.push(A.child2);
+                }
+                continue;
+            }
+
+            if (!overlaps(A.box, B.box))
+                continue;
+
+            if (A.isLeaf() && B.isLeaf()) {
+                if (A.bounds.intersects(B.bounds)) {
+                    if (a < b)
+                        out.push_back({ A.value, B.value });
+                    else
+                        out.push_back({ B.value, A.value });
+                }
+            }
+            else if (B.isLeaf() || (!A.isLeaf() && A.height >= B.height)) {
+                stack.push(A.child1);
+                stack.push(b);
+                stack.push(A.child2);
+                stack.push(b);
+            }
+            else {
+                stack.push(a);
+                stack.push(B.child1);
+                stack.push(a);
+                stack.push(B.child2);
+            }
+        }
+        return out.size() - before;
+    }
+
+} // namespace blaze
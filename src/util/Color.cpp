@@ -1,6 +1,10 @@
 #include "Blaze2D/util/Color.h"
+#include "Blaze2D/internal/ColorKernels.h"
 #include "Blaze2D/internal/SDLManager.h"
 
+#include <algorithm>
+#include <cmath>
+
 namespace blaze
 {
 	Color::Color() : r(0.f), g(0.f), b(0.f), a(0.f) {};
@@ -29,18 +33,13 @@ namespace blaze
     {
     }
 
-    inline void set_render_draw_color(SDL_Renderer* renderer, const Color& c)
+    void set_render_draw_color(SDL_Renderer* renderer, const Color& c)
     {
-        SDL_SetRenderDrawColor(
-            renderer,
-            (uint8_t)(c.r * 255),
-            (uint8_t)(c.g * 255),
-            (uint8_t)(c.b * 255),
-            (uint8_t)(c.a * 255)
-        );
+        const Color32 c8 = to_color32(c);
+        SDL_SetRenderDrawColor(renderer, c8.r, c8.g, c8.b, c8.a);
     }
 
-    static Color lerp(const Color& a, const Color& b, float t)
+    Color lerp(const Color& a, const Color& b, float t)
     {
         return {
             a.r + (b.r - a.r) * t,
@@ -49,4 +48,106 @@ namespace blaze
             a.a + (b.a - a.a) * t
         };
     }
-} // namespace blaze
\ No newline at end of file
+
+    /* =========================
+       Conversions
+       ========================= */
+
+    Color32 to_color32(const Color& c)
+    {
+        return {
+            detail::unit_to_byte(c.r),
+            detail::unit_to_byte(c.g),
+            detail::unit_to_byte(c.b),
+            detail::unit_to_byte(c.a)
+        };
+    }
+
+    Color to_color(Color32 c)
+    {
+        return Color(c.r, c.g, c.b, c.a);
+    }
+
+    float srgb_to_linear(float v)
+    {
+        if (v <= 0.04045f)
+            return v / 12.92f;
+        return std::pow((v + 0.055f) / 1.055f, 2.4f);
+    }
+
+    float linear_to_srgb(float v)
+    {
+        if (v <= 0.0031308f)
+            return v * 12.92f;
+        return 1.055f * std::pow(v, 1.0f / 2.4f) - 0.055f;
+    }
+
+    Color to_linear(const Color& c)
+    {
+        return { srgb_to_linear(c.r), srgb_to_linear(c.g), srgb_to_linear(c.b), c.a };
+    }
+
+    Color to_srgb(const Color& c)
+    {
+        return { linear_to_srgb(c.r), linear_to_srgb(c.g), linear_to_srgb(c.b), c.a };
+    }
+
+    /* =========================
+       Packed color math
+       ========================= */
+
+    Color32 lerp(Color32 a, Color32 b, float t)
+    {
+        const unsigned wb = detail::unit_to_byte(t);
+        const unsigned wa = 255 - wb;
+        return {
+            detail::div255(a.r * wa + b.r * wb),
+            detail::div255(a.g * wa + b.g * wb),
+            detail::div255(a.b * wa + b.b * wb),
+            detail::div255(a.a * wa + b.a * wb)
+        };
+    }
+
+    Color32 premultiply(Color32 c)
+    {
+        return { detail::div255(c.r * c.a), detail::div255(c.g * c.a), detail::div255(c.b * c.a), c.a };
+    }
+
+    Color32 modulate(Color32 c, Color32 tint)
+    {
+        return {
+            detail::div255(c.r * tint.r),
+            detail::div255(c.g * tint.g),
+            detail::div255(c.b * tint.b),
+            detail::div255(c.a * tint.a)
+        };
+    }
+
+    Color32 blend(Color32 src, Color32 dst)
+    {
+        const unsigned inv = 255u - src.a;
+        auto channel = [inv](uint8_t s, uint8_t d) {
+            return static_cast<uint8_t>(std::min(255u, s + unsigned(detail::div255(d * inv))));
+        };
+        return { channel(src.r, dst.r), channel(src.g, dst.g), channel(src.b, dst.b), channel(src.a, dst.a) };
+    }
+
+    namespace detail {
+
+        uint8_t unit_to_byte(float v)
+        {
+            // Written so NaN fails both tests and ends up as 0, like the SIMD paths.
+            v = v > 0.0f ? v : 0.0f;
+            v = v < 1.0f ? v : 1.0f;
+            return static_cast<uint8_t>(std::lrint(v * 255.0f));
+        }
+
+        uint8_t div255(unsigned x)
+        {
+            x += 128;
+            return static_cast<uint8_t>((x + (x >> 8)) >> 8);
+        }
+
+    } // namespace detail
+
+} // namespace blaze
@@ -0,0 +1,309 @@
+#include "Blaze2D/util/ColorBatch.h"
+#include "Blaze2D/internal/ColorKernels.h"
+
+#include <array>
+#include <stdexcept>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BLAZE2D_SSE2 1
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define BLAZE2D_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace blaze
+{
+    namespace {
+
+        using detail::ColorKernels;
+
+        /* =========================
+           Scalar
+           ========================= */
+
+        constexpr ColorKernels scalar_kernels = {
+            [](const Color*, std::size_t, Color32*) -> std::size_t { return 0; },
+            [](const Color32*, std::size_t, Color*) -> std::size_t { return 0; },
+            [](const Color32*, const Color32*, std::size_t, unsigned, Color32*) -> std::size_t { return 0; },
+            [](Color32*, std::size_t) -> std::size_t { return 0; },
+            [](Color32*, std::size_t, Color32) -> std::size_t { return 0; },
+            [](const Color32*, Color32*, std::size_t) -> std::size_t { return 0; },
+        };
+
+#if BLAZE2D_SSE2
+        /* =========================
+           SSE2 (x86-64 baseline)
+           ========================= */
+
+        struct Sse2
+        {
+            using V = __m128i;
+            using W = __m128i;
+            static constexpr std::size_t width = 4;
+
+            static V load(const Color32* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+            static void store(Color32* p, V v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+            static W widen_lo(V v) { return _mm_unpacklo_epi8(v, _mm_setzero_si128()); }
+            static W widen_hi(V v) { return _mm_unpackhi_epi8(v, _mm_setzero_si128()); }
+            static V narrow(W lo, W hi) { return _mm_packus_epi16(lo, hi); }
+            static W splat16(uint16_t v) { return _mm_set1_epi16(static_cast<short>(v)); }
+            static W splat64(uint64_t v) { return _mm_set1_epi64x(static_cast<long long>(v)); }
+            static W add16(W a, W b) { return _mm_add_epi16(a, b); }
+            static W sub16(W a, W b) { return _mm_sub_epi16(a, b); }
+            static W mul16(W a, W b) { return _mm_mullo_epi16(a, b); }
+            static W srl8(W a) { return _mm_srli_epi16(a, 8); }
+            static W and_(W a, W b) { return _mm_and_si128(a, b); }
+            static W or_(W a, W b) { return _mm_or_si128(a, b); }
+            static W alpha16(W w) { return _mm_shufflehi_epi16(_mm_shufflelo_epi16(w, 0xFF), 0xFF); }
+            static V adds8(V a, V b) { return _mm_adds_epu8(a, b); }
+        };
+
+        /*
+            maxps / minps return their second operand when either is NaN, so
+            max(v, 0) then min(v, 1) clamps exactly like unit_to_byte, NaN
+            included. cvtps2dq rounds to nearest even, as lrint does in the
+            default rounding mode.
+        */
+        inline __m128i sse2_to_bytes(const Color* c)
+        {
+            const __m128 zero = _mm_setzero_ps();
+            const __m128 one = _mm_set1_ps(1.0f);
+            const __m128 scale = _mm_set1_ps(255.0f);
+            return _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(&c->r), zero), one), scale));
+        }
+
+        std::size_t sse2_pack(const Color* in, std::size_t count, Color32* out)
+        {
+            std::size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                const __m128i c01 = _mm_packs_epi32(sse2_to_bytes(in + i), sse2_to_bytes(in + i + 1));
+                const __m128i c23 = _mm_packs_epi32(sse2_to_bytes(in + i + 2), sse2_to_bytes(in + i + 3));
+                Sse2::store(out + i, _mm_packus_epi16(c01, c23));
+            }
+            return i;
+        }
+
+        std::size_t sse2_unpack(const Color32* in, std::size_t count, Color* out)
+        {
+            // Divide rather than multiply by 1 / 255 so results match Color(r8, g8, b8, a8).
+            const __m128i zero = _mm_setzero_si128();
+            const __m128 scale = _mm_set1_ps(255.0f);
+
+            std::size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                const __m128i v = Sse2::load(in + i);
+                const __m128i lo = _mm_unpacklo_epi8(v, zero);
+                const __m128i hi = _mm_unpackhi_epi8(v, zero);
+                _mm_storeu_ps(&out[i].r, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), scale));
+                _mm_storeu_ps(&out[i + 1].r, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), scale));
+                _mm_storeu_ps(&out[i + 2].r, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), scale));
+                _mm_storeu_ps(&out[i + 3].r, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), scale));
+            }
+            return i;
+        }
+
+        constexpr ColorKernels sse2_kernels = {
+            sse2_pack,
+            sse2_unpack,
+            detail::lerp_blocks<Sse2>,
+            detail::premultiply_blocks<Sse2>,
+            detail::modulate_blocks<Sse2>,
+            detail::blend_blocks<Sse2>,
+        };
+#endif // BLAZE2D_SSE2
+
+#if BLAZE2D_NEON
+        /* =========================
+           NEON (ARM64 baseline)
+           ========================= */
+
+        struct Neon
+        {
+            using V = uint8x16_t;
+            using W = uint16x8_t;
+            static constexpr std::size_t width = 4;
+
+            static V load(const Color32* p) { return vld1q_u8(&p->r); }
+            static void store(Color32* p, V v) { vst1q_u8(&p->r, v); }
+            static W widen_lo(V v) { return vmovl_u8(vget_low_u8(v)); }
+            static W widen_hi(V v) { return vmovl_high_u8(v); }
+            static V narrow(W lo, W hi) { return vcombine_u8(vqmovn_u16(lo), vqmovn_u16(hi)); }
+            static W splat16(uint16_t v) { return vdupq_n_u16(v); }
+            static W splat64(uint64_t v) { return vreinterpretq_u16_u64(vdupq_n_u64(v)); }
+            static W add16(W a, W b) { return vaddq_u16(a, b); }
+            static W sub16(W a, W b) { return vsubq_u16(a, b); }
+            static W mul16(W a, W b) { return vmulq_u16(a, b); }
+            static W srl8(W a) { return vshrq_n_u16(a, 8); }
+            static W and_(W a, W b) { return vandq_u16(a, b); }
+            static W or_(W a, W b) { return vorrq_u16(a, b); }
+            static V adds8(V a, V b) { return vqaddq_u8(a, b); }
+
+            static W alpha16(W w)
+            {
+                static constexpr uint8_t lanes[16] = { 6, 7, 6, 7, 6, 7, 6, 7, 14, 15, 14, 15, 14, 15, 14, 15 };
+                return vreinterpretq_u16_u8(vqtbl1q_u8(vreinterpretq_u8_u16(w), vld1q_u8(lanes)));
+            }
+        };
+
+        // vmaxq / vminq propagate NaN, so clamp with selects to match unit_to_byte.
+        inline uint16x4_t neon_to_bytes(const Color* c)
+        {
+            const float32x4_t zero = vdupq_n_f32(0.0f);
+            const float32x4_t one = vdupq_n_f32(1.0f);
+            float32x4_t v = vld1q_f32(&c->r);
+            v = vbslq_f32(vcgtq_f32(v, zero), v, zero);
+            v = vbslq_f32(vcltq_f32(v, one), v, one);
+            return vmovn_u32(vcvtnq_u32_f32(vmulq_n_f32(v, 255.0f)));
+        }
+
+        std::size_t neon_pack(const Color* in, std::size_t count, Color32* out)
+        {
+            std::size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                const uint16x8_t c01 = vcombine_u16(neon_to_bytes(in + i), neon_to_bytes(in + i + 1));
+                const uint16x8_t c23 = vcombine_u16(neon_to_bytes(in + i + 2), neon_to_bytes(in + i + 3));
+                Neon::store(out + i, vcombine_u8(vmovn_u16(c01), vmovn_u16(c23)));
+            }
+            return i;
+        }
+
+        std::size_t neon_unpack(const Color32* in, std::size_t count, Color* out)
+        {
+            const float32x4_t scale = vdupq_n_f32(255.0f);
+
+            std::size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                const uint8x16_t v = Neon::load(in + i);
+                const uint16x8_t lo = vmovl_u8(vget_low_u8(v));
+                const uint16x8_t hi = vmovl_high_u8(v);
+                vst1q_f32(&out[i].r, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(lo))), scale));
+                vst1q_f32(&out[i + 1].r, vdivq_f32(vcvtq_f32_u32(vmovl_high_u16(lo)), scale));
+                vst1q_f32(&out[i + 2].r, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(hi))), scale));
+                vst1q_f32(&out[i + 3].r, vdivq_f32(vcvtq_f32_u32(vmovl_high_u16(hi)), scale));
+            }
+            return i;
+        }
+
+        constexpr ColorKernels neon_kernels = {
+            neon_pack,
+            neon_unpack,
+            detail::lerp_blocks<Neon>,
+            detail::premultiply_blocks<Neon>,
+            detail::modulate_blocks<Neon>,
+            detail::blend_blocks<Neon>,
+        };
+#endif // BLAZE2D_NEON
+
+        /* =========================
+           Dispatch
+           ========================= */
+
+        // batch::level() only reports levels the CPU supports.
+        const ColorKernels& kernels()
+        {
+            switch (batch::level()) {
+#if BLAZE2D_SSE2
+            case SimdLevel::SSE2: return sse2_kernels;
+#endif
+#if defined(BLAZE2D_HAVE_AVX2)
+            case SimdLevel::AVX2: return detail::avx2_color_kernels;
+#endif
+#if BLAZE2D_NEON
+            case SimdLevel::NEON: return neon_kernels;
+#endif
+            default: return scalar_kernels;
+            }
+        }
+
+        const std::array<float, 256>& linear_table()
+        {
+            static const std::array<float, 256> table = [] {
+                std::array<float, 256> t{};
+                for (std::size_t i = 0; i < t.size(); ++i)
+                    t[i] = srgb_to_linear(to_color(Color32(static_cast<uint8_t>(i), 0, 0)).r);
+                return t;
+            }();
+            return table;
+        }
+
+        void check_output(std::size_t in, std::size_t out)
+        {
+            if (out < in)
+                throw std::invalid_argument("blaze::batch: output span is shorter than the input");
+        }
+
+    } // namespace
+
+    namespace batch
+    {
+        /* =========================
+           Conversions
+           ========================= */
+
+        void pack(std::span<const Color> in, std::span<Color32> out)
+        {
+            check_output(in.size(), out.size());
+            std::size_t i = kernels().pack(in.data(), in.size(), out.data());
+            for (; i < in.size(); ++i)
+                out[i] = to_color32(in[i]);
+        }
+
+        void unpack(std::span<const Color32> in, std::span<Color> out)
+        {
+            check_output(in.size(), out.size());
+            std::size_t i = kernels().unpack(in.data(), in.size(), out.data());
+            for (; i < in.size(); ++i)
+                out[i] = to_color(in[i]);
+        }
+
+        void toLinear(std::span<const Color32> in, std::span<Color> out)
+        {
+            check_output(in.size(), out.size());
+            const std::array<float, 256>& table = linear_table();
+            for (std::size_t i = 0; i < in.size(); ++i) {
+                const Color32 c = in[i];
+                out[i] = Color(table[c.r], table[c.g], table[c.b], to_color(c).a);
+            }
+        }
+
+        /* =========================
+           Packed color math
+           ========================= */
+
+        void lerp(std::span<const Color32> a, std::span<const Color32> b, float t, std::span<Color32> out)
+        {
+            if (b.size() < a.size())
+                throw std::invalid_argument("blaze::batch::lerp: 'b' is shorter than 'a'");
+            check_output(a.size(), out.size());
+
+            const uint8_t weight = detail::unit_to_byte(t);
+            std::size_t i = kernels().lerp(a.data(), b.data(), a.size(), weight, out.data());
+            for (; i < a.size(); ++i)
+                out[i] = blaze::lerp(a[i], b[i], t);
+        }
+
+        void premultiply(std::span<Color32> colors)
+        {
+            std::size_t i = kernels().premultiply(colors.data(), colors.size());
+            for (; i < colors.size(); ++i)
+                colors[i] = blaze::premultiply(colors[i]);
+        }
+
+        void modulate(std::span<Color32> colors, Color32 tint)
+        {
+            std::size_t i = kernels().modulate(colors.data(), colors.size(), tint);
+            for (; i < colors.size(); ++i)
+                colors[i] = blaze::modulate(colors[i], tint);
+        }
+
+        void blend(std::span<const Color32> src, std::span<Color32> dst)
+        {
+            check_output(src.size(), dst.size());
+            std::size_t i = kernels().blend(src.data(), dst.data(), src.size());
+            for (; i < src.size(); ++i)
+                dst[i] = blaze::blend(src[i], dst[i]);
+        }
+    }
+
+} // namespace blaze
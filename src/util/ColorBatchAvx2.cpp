@@ -0,0 +1,86 @@
+// Built with AVX2 enabled (see CMakeLists.txt) and only reached after the
+// runtime CPU check in RectBatch.cpp.
+#include "Blaze2D/internal/ColorKernels.h"
+
+#include <immintrin.h>
+
+namespace blaze::detail
+{
+    namespace {
+
+        /*
+            unpack / pack work within 128-bit lanes, so widening colors
+            0-1 and 4-5 into 'lo' and 2-3 and 6-7 into 'hi' and narrowing
+            them back restores the original order.
+        */
+        struct Avx2
+        {
+            using V = __m256i;
+            using W = __m256i;
+            static constexpr std::size_t width = 8;
+
+            static V load(const Color32* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+            static void store(Color32* p, V v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+            static W widen_lo(V v) { return _mm256_unpacklo_epi8(v, _mm256_setzero_si256()); }
+            static W widen_hi(V v) { return _mm256_unpackhi_epi8(v, _mm256_setzero_si256()); }
+            static V narrow(W lo, W hi) { return _mm256_packus_epi16(lo, hi); }
+            static W splat16(uint16_t v) { return _mm256_set1_epi16(static_cast<short>(v)); }
+            static W splat64(uint64_t v) { return _mm256_set1_epi64x(static_cast<long long>(v)); }
+            static W add16(W a, W b) { return _mm256_add_epi16(a, b); }
+            static W sub16(W a, W b) { return _mm256_sub_epi16(a, b); }
+            static W mul16(W a, W b) { return _mm256_mullo_epi16(a, b); }
+            static W srl8(W a) { return _mm256_srli_epi16(a, 8); }
+            static W and_(W a, W b) { return _mm256_and_si256(a, b); }
+            static W or_(W a, W b) { return _mm256_or_si256(a, b); }
+            static W alpha16(W w) { return _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(w, 0xFF), 0xFF); }
+            static V adds8(V a, V b) { return _mm256_adds_epu8(a, b); }
+        };
+
+        // Two colors per register; same clamping and rounding as the SSE2 path.
+        inline __m256i to_bytes(const Color* c)
+        {
+            const __m256 zero = _mm256_setzero_ps();
+            const __m256 one = _mm256_set1_ps(1.0f);
+            const __m256 scale = _mm256_set1_ps(255.0f);
+            return _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(&c->r), zero), one), scale));
+        }
+
+        std::size_t pack(const Color* in, std::size_t count, Color32* out)
+        {
+            // The in-lane packs leave colors as 0 2 4 6 | 1 3 5 7.
+            const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+            std::size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                const __m256i c0123 = _mm256_packs_epi32(to_bytes(in + i), to_bytes(in + i + 2));
+                const __m256i c4567 = _mm256_packs_epi32(to_bytes(in + i + 4), to_bytes(in + i + 6));
+                const __m256i bytes = _mm256_packus_epi16(c0123, c4567);
+                Avx2::store(out + i, _mm256_permutevar8x32_epi32(bytes, order));
+            }
+            return i;
+        }
+
+        std::size_t unpack(const Color32* in, std::size_t count, Color* out)
+        {
+            const __m256 scale = _mm256_set1_ps(255.0f);
+
+            std::size_t i = 0;
+            for (; i + 2 <= count; i += 2) {
+                const __m128i two = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(in + i));
+                _mm256_storeu_ps(&out[i].r, _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(two)), scale));
+            }
+            return i;
+        }
+
+    } // namespace
+
+    const ColorKernels avx2_color_kernels = {
+        pack,
+        unpack,
+        lerp_blocks<Avx2>,
+        premultiply_blocks<Avx2>,
+        modulate_blocks<Avx2>,
+        blend_blocks<Avx2>,
+    };
+
+} // namespace blaze::detail
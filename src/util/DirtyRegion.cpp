@@ -0,0 +1,117 @@
+#include "Blaze2D/util/DirtyRegion.h"
+
+#include <stdexcept>
+
+namespace blaze
+{
+    namespace {
+
+        float area_of(const Rect& r)
+        {
+            return r.empty() ? 0.0f : r.w * r.h;
+        }
+
+    } // namespace
+
+    DirtyRegion::DirtyRegion(const Rect& bounds, std::size_t maxRects)
+        : bounds(bounds), max_rects(maxRects)
+    {
+        if (maxRects == 0)
+            throw std::invalid_argument("DirtyRegion: maxRects must be at least 1");
+        rects.reserve(maxRects + 1);
+    }
+
+    void DirtyRegion::setBounds(const Rect& newBounds)
+    {
+        bounds = newBounds;
+        addAll();
+    }
+
+    void DirtyRegion::add(const Rect& rect)
+    {
+        if (full)
+            return;
+
+        const Rect clipped = rect.intersection(bounds);
+        if (clipped.empty())
+            return;
+
+        fold(clipped);
+        while (rects.size() > max_rects)
+            mergeCheapestPair();
+
+        if (area() >= full_threshold * area_of(bounds))
+            addAll();
+    }
+
+    void DirtyRegion::addAll()
+    {
+        rects.clear();
+        full = !bounds.empty();
+        if (full)
+            rects.push_back(bounds);
+    }
+
+    void DirtyRegion::clear()
+    {
+        rects.clear();
+        full = false;
+    }
+
+    float DirtyRegion::area() const
+    {
+        float total = 0.0f;
+        for (const Rect& r : rects)
+            total += area_of(r);
+        return total;
+    }
+
+    void DirtyRegion::fold(Rect rect)
+    {
+        /*
+            Grow 'rect' by every existing rect it overlaps or sits close
+            to, starting over after each merge since the larger rect may
+            now reach others. The result is disjoint from all that remain.
+        */
+        for (std::size_t i = 0; i < rects.size();) {
+            const Rect& existing = rects[i];
+            if (existing.contains(rect))
+                return;
+
+            const Rect joined = rect.united(existing);
+            if (rect.intersects(existing) || area_of(joined) <= merge_slack * (area_of(rect) + area_of(existing))) {
+                rect = joined;
+                rects[i] = rects.back();
+                rects.pop_back();
+                i = 0;
+                continue;
+            }
+            ++i;
+        }
+        rects.push_back(rect);
+    }
+
+    void DirtyRegion::mergeCheapestPair()
+    {
+        std::size_t bestA = 0;
+        std::size_t bestB = 1;
+        float bestWaste = -1.0f;
+
+        for (std::size_t a = 0; a < rects.size(); ++a) {
+            for (std::size_t b = a + 1; b < rects.size(); ++b) {
+                const float waste = area_of(rects[a].united(rects[b])) - area_of(rects[a]) - area_of(rects[b]);
+                if (bestWaste < 0.0f || waste < bestWaste) {
+                    bestWaste = waste;
+                    bestA = a;
+                    bestB = b;
+                }
+            }
+        }
+
+        const Rect joined = rects[bestA].united(rects[bestB]);
+        rects.erase(rects.begin() + static_cast<std::ptrdiff_t>(bestB));
+        rects.erase(rects.begin() + static_cast<std::ptrdiff_t>(bestA));
+        fold(joined);
+    }
+
+} // namespace blaze
@@ -0,0 +1,194 @@
+#include "Blaze2D/util/FileWatcher.h"
+
+#include <algorithm>
+#include <array>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace blaze
+{
+    namespace {
+
+        std::filesystem::file_time_type modified_time(const std::filesystem::path& file)
+        {
+            std::error_code error;
+            const auto time = std::filesystem::last_write_time(file, error);
+            return error ? std::filesystem::file_time_type::min() : time;
+        }
+
+    } // namespace
+
+    FileWatcher::FileWatcher()
+    {
+#ifdef __linux__
+        inotify_fd = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+#endif
+    }
+
+    FileWatcher::~FileWatcher()
+    {
+#ifdef __linux__
+        if (inotify_fd >= 0)
+            ::close(inotify_fd);
+#endif
+    }
+
+    std::filesystem::path FileWatcher::normalize(const std::filesystem::path& file)
+    {
+        std::error_code error;
+        std::filesystem::path absolute = std::filesystem::absolute(file, error);
+        return (error ? file : absolute).lexically_normal();
+    }
+
+    bool FileWatcher::isNative() const
+    {
+#ifdef __linux__
+        return inotify_fd >= 0;
+#else
+        return false;
+#endif
+    }
+
+    void FileWatcher::watch(const std::filesystem::path& file)
+    {
+        std::filesystem::path path = normalize(file);
+        auto [it, inserted] = files.try_emplace(path.string());
+        if (!inserted)
+            return;
+
+        File& entry = it->second;
+        entry.path = std::move(path);
+        entry.modified = modified_time(entry.path);
+
+#ifdef __linux__
+        if (inotify_fd >= 0) {
+            const std::filesystem::path directory = entry.path.parent_path();
+            auto dir = std::find_if(directories.begin(), directories.end(), [&](const Directory& d) { return d.path == directory; });
+            if (dir == directories.end()) {
+                /*
+                    Editors often save by writing a new file and renaming it
+                    over the old one, which would drop a watch on the file
+                    itself; watching the directory sees both kinds of save.
+                */
+                const int wd = ::inotify_add_watch(inotify_fd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+                if (wd >= 0)
+                    dir = directories.insert(directories.end(), { wd, directory, 0 });
+            }
+            if (dir != directories.end()) {
+                ++dir->files;
+                entry.polled = false;
+            }
+        }
+#endif
+
+        if (entry.polled)
+            ++polled_count;
+    }
+
+    void FileWatcher::unwatch(const std::filesystem::path& file)
+    {
+        auto it = files.find(normalize(file).string());
+        if (it == files.end())
+            return;
+
+        if (it->second.polled) {
+            --polled_count;
+        }
+        else {
+#ifdef __linux__
+            const std::filesystem::path directory = it->second.path.parent_path();
+            auto dir = std::find_if(directories.begin(), directories.end(), [&](const Directory& d) { return d.path == directory; });
+            if (dir != directories.end() && --dir->files == 0) {
+                ::inotify_rm_watch(inotify_fd, dir->wd);
+                directories.erase(dir);
+            }
+#endif
+        }
+        files.erase(it);
+    }
+
+    bool FileWatcher::isWatching(const std::filesystem::path& file) const
+    {
+        return files.contains(normalize(file).string());
+    }
+
+    std::span<const std::filesystem::path> FileWatcher::poll()
+    {
+        changed.clear();
+
+#ifdef __linux__
+        if (inotify_fd >= 0)
+            readEvents();
+#endif
+
+        if (polled_count > 0) {
+            const auto now = std::chrono::steady_clock::now();
+            if (now >= next_scan) {
+                next_scan = now + poll_interval;
+                scan();
+            }
+        }
+        return changed;
+    }
+
+    void FileWatcher::scan()
+    {
+        for (auto& [key, file] : files) {
+            if (!file.polled)
+                continue;
+
+            const auto modified = modified_time(file.path);
+            if (modified != file.modified) {
+                file.modified = modified;
+                report(file.path);
+            }
+        }
+    }
+
+    void FileWatcher::report(const std::filesystem::path& file)
+    {
+        if (std::find(changed.begin(), changed.end(), file) == changed.end())
+            changed.push_back(file);
+    }
+
+#ifdef __linux__
+
+    void FileWatcher::readEvents()
+    {
+        alignas(inotify_event) std::array<char, 4096> buffer;
+
+        for (;;) {
+            const ssize_t length = ::read(inotify_fd, buffer.data(), buffer.size());
+            if (length <= 0)
+                return;
+
+            for (ssize_t offset = 0; offset < length;) {
+                const auto* event = reinterpret_cast<const inotify_event*>(buffer.data() + offset);
+                offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+
+                // Events were dropped; anything may have changed.
+                if (event->mask & IN_Q_OVERFLOW) {
+                    for (const auto& [key, file] : files)
+                        report(file.path);
+                    continue;
+                }
+                if (event->len == 0)
+                    continue;
+
+                auto dir = std::find_if(directories.begin(), directories.end(), [&](const Directory& d) { return d.wd == event->wd; });
+                if (dir == directories.end())
+                    continue;
+
+                std::filesystem::path path = dir->path / event->name;
+                if (files.contains(path.string()))
+                    report(path);
+            }
+        }
+    }
+
+#endif
+
+} // namespace blaze
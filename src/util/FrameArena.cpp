@@ -0,0 +1,162 @@
+#include "Blaze2D/util/FrameArena.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+
+#if BLAZE2D_ARENA_DEBUG
+#include <SDL3/SDL.h>
+#endif
+
+namespace blaze
+{
+    namespace {
+
+        // Rewound memory is overwritten in debug builds so stale pointers read garbage.
+        constexpr unsigned char poison = 0xCD;
+
+    } // namespace
+
+    FrameArena::FrameArena(std::size_t capacity, std::pmr::memory_resource* upstream)
+        : upstream(upstream), block_size(std::max<std::size_t>(capacity, 256)), base_size(block_size)
+    {
+    }
+
+    FrameArena::~FrameArena()
+    {
+        release();
+    }
+
+    FrameArena::Scope::Scope(FrameArena& arena)
+        : owner(arena), block(arena.current), offset(arena.offset), used(arena.used_bytes)
+    {
+    }
+
+    FrameArena::Scope::~Scope()
+    {
+#if BLAZE2D_ARENA_DEBUG
+        if (owner.current == block && owner.offset > offset)
+            std::memset(owner.blocks[block].data + offset, poison, owner.offset - offset);
+#endif
+        owner.current = block;
+        owner.offset = offset;
+        owner.used_bytes = used;
+    }
+
+    void FrameArena::reset()
+    {
+        frame_peak = peak_bytes;
+#if BLAZE2D_ARENA_DEBUG
+        if (frame_peak > high_water)
+            SDL_Log("FrameArena %p: new frame peak of %zu bytes", static_cast<void*>(this), frame_peak);
+        for (std::size_t i = 0; i <= current && i < blocks.size(); ++i)
+            std::memset(blocks[i].data, poison, i == current ? offset : blocks[i].size);
+#endif
+        high_water = std::max(high_water, frame_peak);
+
+        /*
+            The frame did not fit in one block. Trade the overflow blocks
+            for one that holds the whole peak, so the next frame of the
+            same size bumps through a single block without allocating.
+        */
+        if (blocks.size() > 1) {
+            block_size = std::max(block_size, std::bit_ceil(peak_bytes));
+            release();
+            addBlock(0);
+            quiet_frames = 0;
+            quiet_peak = 0;
+        }
+
+        /*
+            A one-off spike must not pin its block for good. After
+            shrink_after frames in a row using at most a quarter of a
+            grown block, go back to what they needed (never below the
+            constructor's capacity). The block is replaced on next use.
+        */
+        else if (block_size > base_size && frame_peak <= block_size / 4) {
+            quiet_peak = std::max(quiet_peak, frame_peak);
+            if (++quiet_frames >= shrink_after) {
+                block_size = std::max(base_size, std::bit_ceil(std::max<std::size_t>(quiet_peak, 1)));
+                release();
+                quiet_frames = 0;
+                quiet_peak = 0;
+            }
+        }
+        else {
+            quiet_frames = 0;
+            quiet_peak = 0;
+        }
+
+        current = 0;
+        offset = 0;
+        used_bytes = 0;
+        peak_bytes = 0;
+    }
+
+    std::size_t FrameArena::capacity() const
+    {
+        std::size_t total = 0;
+        for (const Block& block : blocks)
+            total += block.size;
+        return total;
+    }
+
+    FrameArena& FrameArena::local()
+    {
+        thread_local FrameArena arena;
+        return arena;
+    }
+
+    void* FrameArena::do_allocate(std::size_t bytes, std::size_t alignment)
+    {
+        if (blocks.empty())
+            addBlock(0);
+
+        for (;;) {
+            const Block& block = blocks[current];
+            const std::uintptr_t top = reinterpret_cast<std::uintptr_t>(block.data) + offset;
+            const std::size_t padding = static_cast<std::size_t>(((top + alignment - 1) & ~std::uintptr_t(alignment - 1)) - top);
+
+            if (padding + bytes <= block.size - offset) {
+                void* p = block.data + offset + padding;
+                offset += padding + bytes;
+                used_bytes += padding + bytes;
+                peak_bytes = std::max(peak_bytes, used_bytes);
+                return p;
+            }
+
+            // Blocks past the current one are still held after a Scope rewound into an earlier one.
+            if (current + 1 == blocks.size())
+                addBlock(bytes + alignment);
+            ++current;
+            offset = 0;
+        }
+    }
+
+    void FrameArena::do_deallocate(void*, std::size_t, std::size_t)
+    {
+        // Released by Scope or reset().
+    }
+
+    bool FrameArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+    {
+        return this == &other;
+    }
+
+    void FrameArena::addBlock(std::size_t minimum)
+    {
+        const std::size_t size = std::max(block_size, std::bit_ceil(minimum));
+        std::byte* data = static_cast<std::byte*>(upstream->allocate(size, alignof(std::max_align_t)));
+        blocks.push_back({ data, size });
+        ++upstream_allocations;
+    }
+
+    void FrameArena::release()
+    {
+        for (const Block& block : blocks)
+            upstream->deallocate(block.data, block.size, alignof(std::max_align_t));
+        blocks.clear();
+    }
+
+} // namespace blaze
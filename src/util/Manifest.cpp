@@ -1,141 +1,180 @@
 #include "Blaze2D/util/Manifest.h"
-#include <fstream>
+#include "Blaze2D/util/StringPool.h"
+#include "Blaze2D/util/Profiler.h"
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <numeric>
 #include <stdexcept>
 
 namespace blaze
 {
 
-    static inline std::string trim(std::string s) // Used by parse_manifest_line()
+    const AssetFlag* AssetFlags::find(std::string_view key) const
     {
-        auto not_space = [](unsigned char c) { return !std::isspace(c); };
-
-        s.erase(s.begin(), std::find_if(s.begin(), s.end(), not_space));
-        s.erase(std::find_if(s.rbegin(), s.rend(), not_space).base(), s.end());
-        return s;
+        for (const AssetFlag& flag : *this) {
+            if (flag.key == key)
+                return &flag;
+        }
+        return nullptr;
     }
 
-    /**
- * @brief Parse a single manifest line into an AssetDescriptor.
- *
- * Expected format:
- *   type | name | path/to/file | FLAG | KEY = VALUE | BOOLEAN_FLAG = true
- *
- * Rules:
- * - '|' is the field delimiter
- * - First three fields are required: type, name, path
- * - Remaining fields are optional flags
- * - Flags may be:
- *     - Standalone (treated as key=true)
- *     - Key/value pairs separated by '='
- *
- * This function performs no asset-type logic.
- * All values are preserved as strings and interpreted later by loaders.
- *
- * @throws std::runtime_error if the line is malformed
- */
-    AssetDescriptor parse_manifest_line(const std::string& line)
+    std::string_view AssetFlags::at(std::string_view key) const
     {
-        /*
-            Split the line into '|' delimited segments.
-
-            This produces a flat list of tokens that will later be interpreted
-            by position:
-              [0] = type
-              [1] = name
-              [2] = path
-              [3+] = flags
-        */
-        std::stringstream ss(line);
-        std::string segment;
-        std::vector<std::string> parts;
-
-        while (std::getline(ss, segment, '|')) {
-            parts.push_back(trim(segment));
+        const AssetFlag* flag = find(key);
+        if (!flag) {
+            throw std::out_of_range("Asset flag not found: " + std::string(key));
         }
+        return flag->value;
+    }
 
-        /*
-            Validate the minimum structure.
+    namespace {
 
-            A manifest line without at least:
-              type | name | path
-            is considered invalid and cannot be meaningfully interpreted.
-        */
-        if (parts.size() < 3) {
-            throw std::runtime_error(
-                "Invalid manifest line: expected at least type, name, and path"
-            );
+        constexpr std::string_view flag_true = "true";
+
+        inline bool is_space(char c)
+        {
+            return std::isspace(static_cast<unsigned char>(c)) != 0;
         }
 
-        /*
-            Populate the required AssetDescriptor fields.
+        inline std::string_view trim(std::string_view s) // Used by parse_manifest_line()
+        {
+            while (!s.empty() && is_space(s.front())) s.remove_prefix(1);
+            while (!s.empty() && is_space(s.back())) s.remove_suffix(1);
+            return s;
+        }
 
-            At this stage:
-            - 'type' represents semantic intent (sprite, audio, etc.)
-            - 'name' is a human-readable identifier
-            - 'path' is relative to the manifest root
-        */
-        AssetDescriptor desc;
-        desc.type = parts[0];
-        desc.name = parts[1];
-        desc.path = std::filesystem::path(parts[2]);
+        /**
+     * @brief Parse a single manifest line into an AssetDescriptor.
+     *
+     * Expected format:
+     *   type | name | path/to/file | FLAG | KEY = VALUE | BOOLEAN_FLAG = true
+     *
+     * Rules:
+     * - '|' is the field delimiter
+     * - First three fields are required: type, name, path
+     * - Remaining fields are optional flags
+     * - Flags may be:
+     *     - Standalone (treated as key=true)
+     *     - Key/value pairs separated by '='
+     *
+     * The line is tokenized in place: name, path and flag values are views into
+     * the line, while the type and flag keys are interned in StringPool::shared().
+     * Parsed flags are appended to 'flags'; the descriptor's flag view is left
+     * empty and bound by the caller once storage stops growing.
+     *
+     * This function performs no asset-type logic.
+     * All values are preserved as strings and interpreted later by loaders.
+     *
+     * @return the number of flags appended
+     * @throws std::runtime_error if the line is malformed
+     */
+        std::size_t parse_manifest_line(std::string_view line, AssetDescriptor& desc, std::vector<AssetFlag>& flags)
+        {
+            /*
+                Walk the '|' delimited segments in place.
 
-        /*
-            Parse optional flags.
+                Segments are interpreted by position:
+                  [0] = type
+                  [1] = name
+                  [2] = path
+                  [3+] = flags
 
-            Flags are intentionally stored as string key/value pairs.
-            Interpretation (booleans, numbers, enums) is deferred to the loader.
+                As with std::getline, a trailing delimiter does not produce
+                an extra empty segment.
+            */
+            StringPool& pool = StringPool::shared();
+            std::size_t segmentIndex = 0;
+            std::size_t flagCount = 0;
+            std::size_t pos = 0;
+
+            while (pos < line.size()) {
+                std::size_t bar = line.find('|', pos);
+                if (bar == std::string_view::npos)
+                    bar = line.size();
+
+                std::string_view segment = trim(line.substr(pos, bar - pos));
+                pos = bar + 1;
+
+                switch (segmentIndex++) {
+                case 0: desc.type = pool.intern(segment); break;
+                case 1: desc.name = segment; break;
+                case 2: desc.path = segment; break;
+                default:
+                {
+                    /*
+                        Parse an optional flag.
+
+                        Flags are intentionally stored as string key/value pairs.
+                        Interpretation (booleans, numbers, enums) is deferred to the loader.
+
+                        Supported forms:
+                          FLAG            -> FLAG = "true"
+                          KEY = VALUE     -> KEY = VALUE
+
+                        Empty segments carry no flag and are skipped.
+                    */
+                    if (segment.empty())
+                        break;
+
+                    std::string_view key = segment;
+                    std::string_view value = flag_true;
+
+                    auto eq = segment.find('=');
+                    if (eq != std::string_view::npos) {
+                        key = trim(segment.substr(0, eq));
+                        value = trim(segment.substr(eq + 1));
+                    }
+
+                    flags.push_back({ pool.intern(key), value });
+                    ++flagCount;
+                    break;
+                }
+                }
+            }
 
-            Supported forms:
-              FLAG            -> FLAG = "true"
-              KEY = VALUE     -> KEY = VALUE
-        */
-        for (size_t i = 3; i < parts.size(); ++i) {
-            const std::string& flag = parts[i];
+            /*
+                Validate the minimum structure.
 
-            auto eq = flag.find('=');
-            if (eq == std::string::npos) {
-                // Standalone flag: presence implies true
-                desc.flags.emplace(trim(flag), "true");
-            }
-            else {
-                std::string key = trim(flag.substr(0, eq));
-                std::string value = trim(flag.substr(eq + 1));
-                desc.flags.emplace(std::move(key), std::move(value));
+                A manifest line without at least:
+                  type | name | path
+                is considered invalid and cannot be meaningfully interpreted.
+            */
+            if (segmentIndex < 3) {
+                throw std::runtime_error(
+                    "Invalid manifest line: expected at least type, name, and path"
+                );
             }
-        }
 
-        /*
-            Return a fully populated, type-erased asset description.
+            return flagCount;
+        }
 
-            At this point, the descriptor is purely declarative and
-            contains no engine-specific behavior.
-        */
-        return desc;
-    }
+    } // namespace
 
     /**
- * @brief Load and parse a manifest file.
+ * @brief Load a manifest file.
  *
  * The constructor:
  * - Verifies the manifest file exists and is readable
- * - Parses the file line-by-line
- * - Converts each valid line into an AssetDescriptor
- * - Builds a name-to-index lookup table
+ * - Memory-maps the file
+ * - Loads it as a compiled manifest if it starts with the compiled magic,
+ *   otherwise parses it as text
+ *
+ * Descriptors reference the mapped file directly, so loading performs no
+ * per-entry string allocations.
  *
- * Parsing rules:
- * - Empty lines, comment lines, and segment lines (a continuous series of hyphens) are ignored
- * - Each non-empty line must conform to the manifest grammar
- * 
  * @throws std::runtime_error if the file cannot be opened,
- *         if a line is malformed, or if duplicate asset names are found.
+ *         if the file is malformed, or if duplicate asset names are found.
  */
-    Manifest::Manifest(const std::filesystem::path& manifestPath)
-        : root(manifestPath.parent_path())
+    Manifest::Manifest(const std::filesystem::path& manifestPath, bool mapFile)
+        : path(manifestPath), root(manifestPath.parent_path())
     {
+        BLAZE_PROFILE_SCOPE("Manifest::load");
+
         /*
             Validate that the manifest path exists.
 
-            This check is performed before attempting to open the file
+            This check is performed before attempting to map the file
             to produce a clearer error message.
         */
         if (!std::filesystem::exists(manifestPath)) {
@@ -145,10 +184,15 @@ namespace blaze
         }
 
         /*
-            Open the manifest file for reading.
+            Map the manifest file for reading.
+
+            The mapping is owned by the Manifest and backs every view
+            handed out through AssetDescriptor.
         */
-        std::ifstream file(manifestPath);
-        if (!file.is_open()) {
+        try {
+            source = mapFile ? detail::MappedFile(manifestPath) : detail::MappedFile::read(manifestPath);
+        }
+        catch (const std::runtime_error&) {
             throw std::runtime_error(
                 "Failed to open manifest file: " + manifestPath.string()
             );
@@ -156,8 +200,48 @@ namespace blaze
 
         //TODO: Add json support
 
-        std::string line;
+        if (isCompiled(source.view())) {
+            loadCompiled();
+        }
+        else {
+            parseText();
+        }
+    }
+
+    /**
+ * @brief Parse a text manifest from the mapped source.
+ *
+ * Parsing rules:
+ * - Empty lines, comment lines, and segment lines (a continuous series of hyphens) are ignored
+ * - Each non-empty line must conform to the manifest grammar
+ *
+ * @throws std::runtime_error if a line is malformed or if duplicate asset names are found.
+ */
+    void Manifest::parseText()
+    {
+        BLAZE_PROFILE_SCOPE("Manifest::parseText");
+        const std::string_view text = source.view();
+
+        // One entry per line is an upper bound; avoids regrowth while parsing.
+        const std::size_t lineEstimate = std::count(text.begin(), text.end(), '\n') + 1;
+        assets.reserve(lineEstimate);
+
+        /*
+            Bookkeeping that does not outlive the parse. Loads are not
+            per-frame work, so it comes from a local buffer that is freed
+            on return rather than from the frame arena, which would keep a
+            large manifest's high-water mark.
+        */
+        std::pmr::monotonic_buffer_resource bookkeeping;
+        std::pmr::memory_resource* scratch = &bookkeeping;
+
+        std::pmr::vector<std::size_t> flagCounts(scratch);
+        std::pmr::vector<std::size_t> lineNumbers(scratch);
+        flagCounts.reserve(lineEstimate);
+        lineNumbers.reserve(lineEstimate);
+
         std::size_t lineNumber = 0;
+        std::size_t pos = 0;
 
         /*
             Parse the manifest line-by-line.
@@ -165,12 +249,19 @@ namespace blaze
             Each valid line is transformed into an AssetDescriptor and
             appended to internal storage.
         */
-        while (std::getline(file, line)) {
+        while (pos < text.size()) {
+            const char* lineStart = text.data() + pos;
+            const void* newline = std::memchr(lineStart, '\n', text.size() - pos);
+            std::size_t lineLength = newline
+                ? static_cast<const char*>(newline) - lineStart
+                : text.size() - pos;
+
+            std::string_view line(lineStart, lineLength);
+            pos += lineLength + 1;
             ++lineNumber;
 
             // Skip empty or whitespace-only lines
-            if (std::all_of(line.begin(), line.end(),
-                [](unsigned char c) { return std::isspace(c); })) {
+            if (trim(line).empty()) {
                 continue;
             }
 
@@ -185,37 +276,161 @@ namespace blaze
             }
 
 
-            AssetDescriptor desc = parse_manifest_line(line);
+            AssetDescriptor desc;
+            flagCounts.push_back(parse_manifest_line(line, desc, flags));
+            lineNumbers.push_back(lineNumber);
+            assets.push_back(desc);
+        }
+
+        /*
+            Bind flag views.
 
-            /*
-                Enforce uniqueness of asset names.
+            Flag storage is final now, so each descriptor can safely
+            point at its contiguous run of flags.
+        */
+        std::size_t flagOffset = 0;
+        for (std::size_t i = 0; i < assets.size(); ++i) {
+            assets[i].flags = AssetFlags(flags.data() + flagOffset, flagCounts[i]);
+            flagOffset += flagCounts[i];
+        }
 
-                Duplicate names would make lookup ambiguous and indicate
-                an authoring error in the manifest.
-            */
-            auto [it, inserted] =
-                index.emplace(desc.name, assets.size());
+        /*
+            Group by type, then carry line numbers along so that
+            duplicate names can still be reported by line.
+        */
+        const std::pmr::vector<uint32_t> newPosition = groupByType(scratch);
 
-            if (!inserted) {
-                throw std::runtime_error(
-                    "Duplicate asset name '" + desc.name +
-                    "' at line " + std::to_string(lineNumber)
-                );
+        std::pmr::vector<std::size_t> groupedLines(lineNumbers.size(), scratch);
+        for (std::size_t i = 0; i < lineNumbers.size(); ++i)
+            groupedLines[newPosition[i]] = lineNumbers[i];
+
+        for (std::size_t i = 0; i < assets.size(); ++i)
+            assets[i].id = AssetId{ static_cast<uint32_t>(i) };
+
+        buildNameHash(groupedLines);
+    }
+
+    /**
+ * @brief Build the perfect hash over asset names.
+ *
+ * This also enforces uniqueness of asset names: duplicate names would make
+ * lookup ambiguous and indicate an authoring error in the manifest.
+ *
+ * @param lineNumbers source line of each asset, or empty if unknown
+ * @throws std::runtime_error if duplicate asset names are found.
+ */
+    void Manifest::buildNameHash(std::span<const std::size_t> lineNumbers)
+    {
+        std::pmr::monotonic_buffer_resource scratch;
+        std::pmr::vector<std::string_view> names(assets.size(), &scratch);
+        for (std::size_t i = 0; i < assets.size(); ++i)
+            names[i] = assets[i].name;
+
+        try {
+            ownedNameHash = detail::build_perfect_hash(names);
+        }
+        catch (const detail::DuplicateKeyError& e) {
+            std::string message = "Duplicate asset name '" + std::string(assets[e.second].name) + "'";
+            if (!lineNumbers.empty()) {
+                message += " at line " + std::to_string(std::max(lineNumbers[e.first], lineNumbers[e.second]));
             }
+            throw std::runtime_error(message);
+        }
+
+        nameHash = ownedNameHash.view();
+    }
 
-            assets.push_back(std::move(desc));
+    /**
+ * @brief Reorder assets so that each type occupies one contiguous run.
+ *
+ * A stable counting sort keyed on the (interned) type: types keep the order
+ * of their first appearance and assets keep their manifest order within a type.
+ * The per-type ranges are updated to match.
+ *
+ * @param scratch resource for the returned positions and temporaries
+ * @return the new position of every asset, indexed by its old position
+ */
+    std::pmr::vector<uint32_t> Manifest::groupByType(std::pmr::memory_resource* scratch)
+    {
+        /*
+            Count assets per type and assign each type its offset.
+        */
+        std::pmr::vector<std::string_view> typeOrder(scratch);
+
+        for (const AssetDescriptor& asset : assets) {
+            auto [it, inserted] = types.try_emplace(asset.type);
+            if (inserted)
+                typeOrder.push_back(asset.type);
+            ++it->second.count;
+        }
+
+        std::size_t offset = 0;
+        for (std::string_view type : typeOrder) {
+            TypeRange& range = types[type];
+            range.offset = offset;
+            offset += range.count;
+        }
+
+        std::pmr::vector<uint32_t> newPosition(assets.size(), scratch);
+
+        // A single type is already grouped.
+        if (typeOrder.size() <= 1) {
+            std::iota(newPosition.begin(), newPosition.end(), 0u);
+            return newPosition;
+        }
+
+        /*
+            Scatter assets into their type's run, recording where each
+            one moved.
+        */
+        std::vector<AssetDescriptor> grouped(assets.size());
+
+        for (auto& [type, range] : types)
+            range.count = 0;
+
+        for (std::size_t i = 0; i < assets.size(); ++i) {
+            TypeRange& range = types[assets[i].type];
+            std::size_t dst = range.offset + range.count++;
+            grouped[dst] = assets[i];
+            newPosition[i] = static_cast<uint32_t>(dst);
+        }
+
+        assets = std::move(grouped);
+        return newPosition;
+    }
+
+
+    AssetId Manifest::find(std::string_view name) const
+    {
+        if (nameHash.empty()) {
+            return {};
+        }
+
+        uint32_t position = nameHash.candidate(name);
+        if (assets[position].name != name) {
+            return {};
         }
+
+        return AssetId{ position };
     }
 
+    const AssetDescriptor& Manifest::get(std::string_view name) const
+    {
+        AssetId id = find(name);
+        if (!id) {
+            throw std::out_of_range("Asset not found in manifest: " + std::string(name));
+        }
 
-    const AssetDescriptor& Manifest::get(const std::string& name) const
+        return assets[id.value];
+    }
+
+    const AssetDescriptor& Manifest::get(AssetId id) const
     {
-        auto it = index.find(name);
-        if (it == index.end()) {
-            throw std::out_of_range("Asset not found in manifest: " + name);
+        if (id.value >= assets.size()) {
+            throw std::out_of_range("Invalid asset id: " + std::to_string(id.value));
         }
 
-        return assets[it->second];
+        return assets[id.value];
     }
 
     std::span<const AssetDescriptor> Manifest::getAll() const
@@ -223,28 +438,14 @@ namespace blaze
         return assets;
     }
 
-    std::span<const AssetDescriptor> Manifest::getByType(const std::string& type) const
+    std::span<const AssetDescriptor> Manifest::getByType(std::string_view type) const
     {
-        /*
-            NOTE:
-            This returns a temporary filtered view.
-        */
-
-        static thread_local std::vector<const AssetDescriptor*> scratch;
-        scratch.clear();
-
-        for (const auto& asset : assets) {
-            if (asset.type == type) {
-                scratch.push_back(&asset);
-            }
+        auto it = types.find(type);
+        if (it == types.end()) {
+            return {};
         }
 
-        // Convert pointer list to span-like access
-        // Caller should treat this as temporary
-        return {
-            reinterpret_cast<const AssetDescriptor*>(scratch.data()),
-            scratch.size()
-        };
+        return std::span<const AssetDescriptor>(assets).subspan(it->second.offset, it->second.count);
     }
 
-} // namespace blaze
\ No newline at end of file
+} // namespace blaze
@@ -0,0 +1,301 @@
+#include "Blaze2D/util/Manifest.h"
+#include "Blaze2D/util/StringPool.h"
+#include "Blaze2D/util/Profiler.h"
+#include "Blaze2D/internal/ManifestFormat.h"
+
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace blaze
+{
+    namespace format = detail::manifest_format;
+
+    namespace {
+
+        [[noreturn]] void malformed(const char* what)
+        {
+            throw std::runtime_error(std::string("Malformed compiled manifest: ") + what);
+        }
+
+        /*
+            Bounds-checked typed view of a section of the mapped file.
+            Sections are 4-byte aligned by construction, and the mapping
+            itself is page aligned.
+        */
+        template <typename T>
+        std::span<const T> section(std::string_view file, uint32_t offset, uint32_t count)
+        {
+            uint64_t end = uint64_t(offset) + uint64_t(count) * sizeof(T);
+            if (end > file.size() || offset % alignof(T) != 0) {
+                malformed("section out of bounds");
+            }
+            return { reinterpret_cast<const T*>(file.data() + offset), count };
+        }
+
+    } // namespace
+
+    bool Manifest::isCompiled(std::string_view data)
+    {
+        return data.size() >= sizeof(format::Header) && data.starts_with(format::magic);
+    }
+
+    /**
+ * @brief Load a compiled manifest from the mapped source.
+ *
+ * Every section is validated against the file size before use, so a truncated
+ * or corrupted file raises an error instead of reading out of bounds.
+ * Names, paths and flag values are views into the mapping. Only the type and
+ * key tables are interned, so the cost of loading does not depend on string
+ * content, and an embedded name hash is used directly from the file.
+ *
+ * @throws std::runtime_error if the file is malformed or of another version.
+ */
+    void Manifest::loadCompiled()
+    {
+        BLAZE_PROFILE_SCOPE("Manifest::loadCompiled");
+        const std::string_view file = source.view();
+
+        format::Header header;
+        std::memcpy(&header, file.data(), sizeof(header));
+
+        if (header.version != format::version) {
+            throw std::runtime_error(
+                "Unsupported compiled manifest version " + std::to_string(header.version) +
+                " (expected " + std::to_string(format::version) + ")"
+            );
+        }
+
+        auto typeEntries = section<format::TypeEntry>(file, header.types_offset, header.type_count);
+        auto keyEntries = section<format::StringRef>(file, header.keys_offset, header.key_count);
+        auto assetEntries = section<format::AssetEntry>(file, header.assets_offset, header.asset_count);
+        auto flagEntries = section<format::FlagEntry>(file, header.flags_offset, header.flag_count);
+        auto strings = section<char>(file, header.strings_offset, header.strings_size);
+
+        const std::string_view table(strings.data(), strings.size());
+        auto str = [&table](const format::StringRef& ref) {
+            if (uint64_t(ref.offset) + ref.length > table.size()) {
+                malformed("string out of bounds");
+            }
+            return table.substr(ref.offset, ref.length);
+        };
+
+        StringPool& pool = StringPool::shared();
+
+        /*
+            Intern type names and flag keys once per table entry.
+        */
+        std::vector<std::string_view> typeNames;
+        typeNames.reserve(typeEntries.size());
+        types.reserve(typeEntries.size());
+
+        for (const format::TypeEntry& entry : typeEntries) {
+            if (uint64_t(entry.first_asset) + entry.asset_count > header.asset_count) {
+                malformed("type range out of bounds");
+            }
+            typeNames.push_back(pool.intern(str(entry.name)));
+            types[typeNames.back()] = TypeRange{ entry.first_asset, entry.asset_count };
+        }
+
+        std::vector<std::string_view> keys;
+        keys.reserve(keyEntries.size());
+        for (const format::StringRef& ref : keyEntries)
+            keys.push_back(pool.intern(str(ref)));
+
+        /*
+            Flags and descriptors.
+        */
+        flags.resize(flagEntries.size());
+        for (std::size_t i = 0; i < flagEntries.size(); ++i) {
+            const format::FlagEntry& entry = flagEntries[i];
+            if (entry.key >= keys.size()) {
+                malformed("flag key out of bounds");
+            }
+            flags[i] = { keys[entry.key], str(entry.value) };
+        }
+
+        assets.resize(assetEntries.size());
+        for (std::size_t i = 0; i < assetEntries.size(); ++i) {
+            const format::AssetEntry& entry = assetEntries[i];
+            if (entry.type >= typeNames.size() ||
+                uint64_t(entry.first_flag) + entry.flag_count > flags.size()) {
+                malformed("asset entry out of bounds");
+            }
+
+            AssetDescriptor& desc = assets[i];
+            desc.name = str(entry.name);
+            desc.type = typeNames[entry.type];
+            desc.path = str(entry.path);
+            desc.flags = AssetFlags(flags.data() + entry.first_flag, entry.flag_count);
+            desc.id = AssetId{ static_cast<uint32_t>(i) };
+        }
+
+        /*
+            Name lookup.
+
+            Use the embedded perfect hash when the compiler stored one;
+            otherwise build it now.
+        */
+        if (header.hash_bucket_count == 0) {
+            try {
+                buildNameHash({});
+            }
+            catch (const std::runtime_error&) {
+                malformed("duplicate asset names");
+            }
+            return;
+        }
+
+        if (header.asset_count == 0) {
+            malformed("name hash without assets");
+        }
+
+        auto displacements = section<int32_t>(file, header.hash_displacements_offset, header.hash_bucket_count);
+        auto slots = section<uint32_t>(file, header.hash_slots_offset, header.asset_count);
+
+        for (int32_t d : displacements) {
+            if (d < 0 && uint64_t(-int64_t(d) - 1) >= header.asset_count) {
+                malformed("name hash out of bounds");
+            }
+        }
+        for (uint32_t position : slots) {
+            if (position >= header.asset_count) {
+                malformed("name hash out of bounds");
+            }
+        }
+
+        nameHash = detail::PerfectHashView{ header.hash_seed, displacements, slots };
+    }
+
+    /**
+ * @brief Serialize the manifest into the compiled format.
+ *
+ * Identical strings share one string table entry. Assets are written in
+ * getAll() order, which is already grouped by type, so type ranges, asset ids
+ * and the name hash carry over unchanged.
+ */
+    void Manifest::writeCompiled(const std::filesystem::path& outputPath, bool embedNameHash) const
+    {
+        std::string strings;
+        std::unordered_map<std::string_view, format::StringRef> stringRefs;
+
+        auto addString = [&](std::string_view s) {
+            auto it = stringRefs.find(s);
+            if (it != stringRefs.end())
+                return it->second;
+
+            format::StringRef ref{ static_cast<uint32_t>(strings.size()), static_cast<uint32_t>(s.size()) };
+            strings.append(s);
+            stringRefs.emplace(s, ref);
+            return ref;
+        };
+
+        /*
+            Type and key tables.
+        */
+        std::vector<format::TypeEntry> typeEntries;
+        std::unordered_map<std::string_view, uint32_t> typeIndex;
+
+        for (const auto& [type, range] : types) {
+            typeIndex[type] = static_cast<uint32_t>(typeEntries.size());
+            typeEntries.push_back({ addString(type),
+                static_cast<uint32_t>(range.offset), static_cast<uint32_t>(range.count) });
+        }
+
+        std::vector<format::StringRef> keyEntries;
+        std::unordered_map<std::string_view, uint32_t> keyIndex;
+
+        for (const AssetFlag& flag : flags) {
+            auto [it, inserted] = keyIndex.try_emplace(flag.key, static_cast<uint32_t>(keyEntries.size()));
+            if (inserted)
+                keyEntries.push_back(addString(flag.key));
+        }
+
+        /*
+            Descriptors and flags.
+            Flags are re-emitted per asset, so their order does not depend on
+            how this Manifest was loaded.
+        */
+        std::vector<format::AssetEntry> assetEntries;
+        std::vector<format::FlagEntry> flagEntries;
+        assetEntries.reserve(assets.size());
+        flagEntries.reserve(flags.size());
+
+        for (const AssetDescriptor& desc : assets) {
+            format::AssetEntry entry{};
+            entry.name = addString(desc.name);
+            entry.path = addString(desc.path);
+            entry.type = typeIndex.at(desc.type);
+            entry.first_flag = static_cast<uint32_t>(flagEntries.size());
+            entry.flag_count = static_cast<uint32_t>(desc.flags.size());
+
+            for (const AssetFlag& flag : desc.flags)
+                flagEntries.push_back({ keyIndex.at(flag.key), addString(flag.value) });
+
+            assetEntries.push_back(entry);
+        }
+
+        /*
+            Header and section offsets.
+        */
+        format::Header header{};
+        std::memcpy(header.magic, format::magic.data(), sizeof(header.magic));
+        header.version = format::version;
+        header.asset_count = static_cast<uint32_t>(assetEntries.size());
+        header.flag_count = static_cast<uint32_t>(flagEntries.size());
+        header.type_count = static_cast<uint32_t>(typeEntries.size());
+        header.key_count = static_cast<uint32_t>(keyEntries.size());
+
+        uint64_t offset = sizeof(format::Header);
+        auto place = [&offset](uint32_t& field, uint64_t bytes) {
+            field = static_cast<uint32_t>(offset);
+            offset += bytes;
+        };
+
+        place(header.types_offset, typeEntries.size() * sizeof(format::TypeEntry));
+        place(header.keys_offset, keyEntries.size() * sizeof(format::StringRef));
+        place(header.assets_offset, assetEntries.size() * sizeof(format::AssetEntry));
+        place(header.flags_offset, flagEntries.size() * sizeof(format::FlagEntry));
+        std::span<const int32_t> displacements;
+        std::span<const uint32_t> slots;
+        if (embedNameHash && !nameHash.empty()) {
+            displacements = nameHash.displacements;
+            slots = nameHash.slots;
+            header.hash_seed = static_cast<uint32_t>(nameHash.seed);
+            header.hash_bucket_count = static_cast<uint32_t>(displacements.size());
+        }
+
+        place(header.hash_displacements_offset, displacements.size_bytes());
+        place(header.hash_slots_offset, slots.size_bytes());
+        place(header.strings_offset, strings.size());
+        header.strings_size = static_cast<uint32_t>(strings.size());
+
+        if (offset > UINT32_MAX) {
+            throw std::runtime_error("Manifest too large to compile");
+        }
+
+        std::ofstream out(outputPath, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            throw std::runtime_error("Failed to open output file: " + outputPath.string());
+        }
+
+        auto write = [&out](const void* data, std::size_t bytes) {
+            out.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+        };
+
+        write(&header, sizeof(header));
+        write(typeEntries.data(), typeEntries.size() * sizeof(format::TypeEntry));
+        write(keyEntries.data(), keyEntries.size() * sizeof(format::StringRef));
+        write(assetEntries.data(), assetEntries.size() * sizeof(format::AssetEntry));
+        write(flagEntries.data(), flagEntries.size() * sizeof(format::FlagEntry));
+        write(displacements.data(), displacements.size_bytes());
+        write(slots.data(), slots.size_bytes());
+        write(strings.data(), strings.size());
+
+        if (!out) {
+            throw std::runtime_error("Failed to write compiled manifest: " + outputPath.string());
+        }
+    }
+
+} // namespace blaze
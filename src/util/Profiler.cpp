@@ -0,0 +1,244 @@
+#include "Blaze2D/util/Profiler.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+namespace blaze
+{
+    namespace detail {
+
+        /*
+            Single-producer, single-consumer ring: the owning thread advances
+            'head' after writing a slot, collect() advances 'tail' after
+            reading one. Both only grow; indices wrap with the mask.
+        */
+        struct ProfileBuffer
+        {
+            struct Zone
+            {
+                const char* name;
+                uint64_t start;
+                uint64_t end;
+            };
+
+            static constexpr uint64_t mask = Profiler::buffer_capacity - 1;
+            static_assert((Profiler::buffer_capacity & mask) == 0, "buffer_capacity must be a power of two");
+
+            std::unique_ptr<Zone[]> zones = std::make_unique_for_overwrite<Zone[]>(Profiler::buffer_capacity);
+            uint32_t thread = 0;
+
+            alignas(64) std::atomic<uint64_t> head = 0;
+            alignas(64) std::atomic<uint64_t> tail = 0;
+            std::atomic<uint64_t> dropped = 0;
+            std::atomic<bool> retired = false; // Owning thread exited
+        };
+
+    } // namespace detail
+
+    namespace {
+
+        std::atomic<uint32_t> next_profiler_id = 1;
+
+        struct ThreadBuffers
+        {
+            struct Entry
+            {
+                uint32_t profiler;
+                std::shared_ptr<detail::ProfileBuffer> buffer;
+            };
+
+            std::vector<Entry> entries;
+
+            ~ThreadBuffers()
+            {
+                for (Entry& entry : entries)
+                    entry.buffer->retired.store(true, std::memory_order_release);
+            }
+        };
+
+        thread_local ThreadBuffers thread_buffers;
+
+        void append_json_string(std::string& out, const char* text)
+        {
+            out += '"';
+            for (const char* c = text; *c; ++c) {
+                switch (*c) {
+                case '"': out += "\\\""; break;
+                case '\\': out += "\\\\"; break;
+                case '\n': out += "\\n"; break;
+                case '\t': out += "\\t"; break;
+                default:
+                    if (static_cast<unsigned char>(*c) < 0x20) {
+                        char escaped[8];
+                        std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(*c));
+                        out += escaped;
+                    }
+                    else {
+                        out += *c;
+                    }
+                }
+            }
+            out += '"';
+        }
+
+    } // namespace
+
+    Profiler& Profiler::shared()
+    {
+        static Profiler profiler;
+        return profiler;
+    }
+
+    Profiler::Profiler()
+        : id(next_profiler_id.fetch_add(1, std::memory_order_relaxed))
+    {
+    }
+
+    Profiler::~Profiler() = default;
+
+    detail::ProfileBuffer& Profiler::threadBuffer()
+    {
+        for (const ThreadBuffers::Entry& entry : thread_buffers.entries) {
+            if (entry.profiler == id)
+                return *entry.buffer;
+        }
+
+        // First zone of this thread: the only time recording takes the lock.
+        auto buffer = std::make_shared<detail::ProfileBuffer>();
+        {
+            std::lock_guard lock(mutex);
+            buffer->thread = next_thread++;
+            buffers.push_back(buffer);
+        }
+        thread_buffers.entries.push_back({ id, buffer });
+        return *buffer;
+    }
+
+    void Profiler::record(const char* name, uint64_t startNs, uint64_t endNs)
+    {
+        detail::ProfileBuffer& buffer = threadBuffer();
+
+        const uint64_t head = buffer.head.load(std::memory_order_relaxed);
+        const uint64_t tail = buffer.tail.load(std::memory_order_acquire);
+        if (head - tail == buffer_capacity) {
+            buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        buffer.zones[head & detail::ProfileBuffer::mask] = { name, startNs, endNs };
+        buffer.head.store(head + 1, std::memory_order_release);
+    }
+
+    void Profiler::setThreadName(std::string name)
+    {
+        const uint32_t thread = threadBuffer().thread;
+        std::lock_guard lock(mutex);
+        thread_names[thread] = std::move(name);
+    }
+
+    std::size_t Profiler::collect()
+    {
+        std::lock_guard lock(mutex);
+
+        std::size_t moved = 0;
+        for (auto it = buffers.begin(); it != buffers.end();) {
+            detail::ProfileBuffer& buffer = **it;
+
+            // Read before draining, so a thread that exits meanwhile is drained next time.
+            const bool retired = buffer.retired.load(std::memory_order_acquire);
+            const uint64_t head = buffer.head.load(std::memory_order_acquire);
+            uint64_t tail = buffer.tail.load(std::memory_order_relaxed);
+
+            for (; tail != head; ++tail) {
+                if (events.size() >= capture_limit) {
+                    capture_dropped += head - tail;
+                    tail = head;
+                    break;
+                }
+                const detail::ProfileBuffer::Zone& zone = buffer.zones[tail & detail::ProfileBuffer::mask];
+                events.push_back({ zone.name, zone.start, zone.end, buffer.thread });
+                ++moved;
+            }
+            buffer.tail.store(tail, std::memory_order_release);
+
+            if (retired) {
+                retired_dropped += buffer.dropped.load(std::memory_order_relaxed);
+                it = buffers.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+        return moved;
+    }
+
+    void Profiler::clear()
+    {
+        events.clear();
+    }
+
+    uint64_t Profiler::getDroppedCount() const
+    {
+        std::lock_guard lock(mutex);
+
+        uint64_t dropped = capture_dropped + retired_dropped;
+        for (const auto& buffer : buffers)
+            dropped += buffer->dropped.load(std::memory_order_relaxed);
+        return dropped;
+    }
+
+    std::string Profiler::toChromeTrace() const
+    {
+        uint64_t origin = UINT64_MAX;
+        for (const ProfileEvent& event : events)
+            origin = std::min(origin, event.start_ns);
+
+        std::string out = "{\"traceEvents\":[";
+        out.reserve(out.size() + events.size() * 96);
+
+        bool first = true;
+        auto separate = [&] {
+            if (!first)
+                out += ',';
+            first = false;
+            out += "\n";
+        };
+
+        {
+            std::lock_guard lock(mutex);
+            for (const auto& [thread, name] : thread_names) {
+                separate();
+                out += "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" + std::to_string(thread) + ",\"args\":{\"name\":";
+                append_json_string(out, name.c_str());
+                out += "}}";
+            }
+        }
+
+        char numbers[96];
+        for (const ProfileEvent& event : events) {
+            separate();
+            out += "{\"name\":";
+            append_json_string(out, event.name);
+            std::snprintf(numbers, sizeof(numbers), ",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}",
+                static_cast<double>(event.start_ns - origin) * 1e-3,
+                static_cast<double>(event.end_ns - event.start_ns) * 1e-3,
+                static_cast<unsigned>(event.thread));
+            out += numbers;
+        }
+
+        out += "\n],\"displayTimeUnit\":\"ms\"}\n";
+        return out;
+    }
+
+    void Profiler::writeChromeTrace(const std::filesystem::path& path) const
+    {
+        const std::string trace = toChromeTrace();
+
+        std::ofstream out(path, std::ios::binary);
+        if (!out || !out.write(trace.data(), static_cast<std::streamsize>(trace.size())))
+            throw std::runtime_error("Failed to write trace file: " + path.string());
+    }
+
+} // namespace blaze
@@ -0,0 +1,498 @@
+#include "Blaze2D/util/RectBatch.h"
+#include "Blaze2D/internal/RectKernels.h"
+
+#include <atomic>
+#include <stdexcept>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BLAZE2D_SSE2 1
+#include <emmintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define BLAZE2D_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace blaze
+{
+    namespace {
+
+        using detail::RectKernels;
+
+        /* =========================
+           Scalar
+           ========================= */
+
+        // No blocks: the public functions do everything in their tail loops.
+        constexpr RectKernels scalar_kernels = {
+            [](const Rect*, std::size_t, const Rect&, uint8_t*, std::size_t&) -> std::size_t { return 0; },
+            [](const Rect*, std::size_t, const Rect&, uint8_t*, std::size_t&) -> std::size_t { return 0; },
+            [](const Rect*, std::size_t, const Vec2&, uint8_t*, std::size_t&) -> std::size_t { return 0; },
+            [](const Rect&, const Vec2*, std::size_t, uint8_t*, std::size_t&) -> std::size_t { return 0; },
+            [](const Rect*, std::size_t, const Rect&, Rect*) -> std::size_t { return 0; },
+            [](const Rect*, std::size_t, const Rect&, Rect*) -> std::size_t { return 0; },
+            [](Rect*, std::size_t, const Vec2&) -> std::size_t { return 0; },
+            [](Vec2*, std::size_t, const Vec2&) -> std::size_t { return 0; },
+        };
+
+#if BLAZE2D_SSE2
+        /* =========================
+           SSE2 (x86-64 baseline)
+           ========================= */
+
+        struct Sse2
+        {
+            using F = __m128;
+            using M = __m128;
+            static constexpr std::size_t width = 4;
+            static constexpr unsigned all = 0xF;
+
+            static F splat(float v) { return _mm_set1_ps(v); }
+            static F add(F a, F b) { return _mm_add_ps(a, b); }
+            static M ge(F a, F b) { return _mm_cmpge_ps(a, b); }
+            static M le(F a, F b) { return _mm_cmple_ps(a, b); }
+            static M lt(F a, F b) { return _mm_cmplt_ps(a, b); }
+            static M and_(M a, M b) { return _mm_and_ps(a, b); }
+            static M or_(M a, M b) { return _mm_or_ps(a, b); }
+            static unsigned bits(M m) { return static_cast<unsigned>(_mm_movemask_ps(m)); }
+
+            static void load_rects(const Rect* rects, F& x, F& y, F& w, F& h)
+            {
+                const float* p = &rects->x;
+                x = _mm_loadu_ps(p);
+                y = _mm_loadu_ps(p + 4);
+                w = _mm_loadu_ps(p + 8);
+                h = _mm_loadu_ps(p + 12);
+                _MM_TRANSPOSE4_PS(x, y, w, h);
+            }
+
+            static void load_points(const Vec2* points, F& x, F& y)
+            {
+                const float* p = &points->x;
+                const F a = _mm_loadu_ps(p);
+                const F b = _mm_loadu_ps(p + 4);
+                x = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+                y = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+            }
+        };
+
+        /*
+            The transforms keep one rect per register as (x, y, w, h).
+            'edges' turns that into (left, top, right, bottom) without
+            touching lanes 0-1, so signed zeros survive.
+
+            std::max(a, b) is (a < b) ? b : a, which is exactly
+            _mm_max_ps(b, a); likewise std::min(a, b) is _mm_min_ps(b, a).
+            Passing the second Rect first therefore matches the scalar
+            code for NaNs and signed zeros too.
+        */
+        inline __m128 sse2_edges(__m128 r)
+        {
+            const __m128 sum = _mm_add_ps(r, _mm_movelh_ps(r, r));
+            return _mm_shuffle_ps(r, sum, _MM_SHUFFLE(3, 2, 1, 0));
+        }
+
+        // (left, top, right, bottom) -> (x, y, w, h)
+        inline __m128 sse2_from_edges(__m128 e)
+        {
+            return _mm_sub_ps(e, _mm_movelh_ps(_mm_setzero_ps(), e));
+        }
+
+        std::size_t sse2_intersection(const Rect* rects, std::size_t count, const Rect& clip, Rect* out)
+        {
+            const __m128 c = sse2_edges(_mm_loadu_ps(&clip.x));
+            for (std::size_t i = 0; i < count; ++i) {
+                const __m128 e = sse2_edges(_mm_loadu_ps(&rects[i].x));
+                const __m128 m = _mm_shuffle_ps(_mm_max_ps(c, e), _mm_min_ps(c, e), _MM_SHUFFLE(3, 2, 1, 0));
+
+                // nr <= nx || nb <= ny -> Rect()
+                const __m128 cmp = _mm_cmple_ps(_mm_movehl_ps(m, m), m);
+                const __m128 empty = _mm_or_ps(
+                    _mm_shuffle_ps(cmp, cmp, _MM_SHUFFLE(0, 0, 0, 0)),
+                    _mm_shuffle_ps(cmp, cmp, _MM_SHUFFLE(1, 1, 1, 1)));
+                _mm_storeu_ps(&out[i].x, _mm_andnot_ps(empty, sse2_from_edges(m)));
+            }
+            return count;
+        }
+
+        std::size_t sse2_united(const Rect* rects, std::size_t count, const Rect& other, Rect* out)
+        {
+            const __m128 c = sse2_edges(_mm_loadu_ps(&other.x));
+            for (std::size_t i = 0; i < count; ++i) {
+                const __m128 e = sse2_edges(_mm_loadu_ps(&rects[i].x));
+                const __m128 m = _mm_shuffle_ps(_mm_min_ps(c, e), _mm_max_ps(c, e), _MM_SHUFFLE(3, 2, 1, 0));
+                _mm_storeu_ps(&out[i].x, sse2_from_edges(m));
+            }
+            return count;
+        }
+
+        std::size_t sse2_translate_rects(Rect* rects, std::size_t count, const Vec2& delta)
+        {
+            // Only x and y are added to; w and h are copied so -0 stays -0.
+            const __m128 d = _mm_setr_ps(delta.x, delta.y, 0.0f, 0.0f);
+            for (std::size_t i = 0; i < count; ++i) {
+                const __m128 r = _mm_loadu_ps(&rects[i].x);
+                _mm_storeu_ps(&rects[i].x, _mm_shuffle_ps(_mm_add_ps(r, d), r, _MM_SHUFFLE(3, 2, 1, 0)));
+            }
+            return count;
+        }
+
+        std::size_t sse2_translate_points(Vec2* points, std::size_t count, const Vec2& delta)
+        {
+            const __m128 d = _mm_setr_ps(delta.x, delta.y, delta.x, delta.y);
+            std::size_t i = 0;
+            for (; i + 2 <= count; i += 2)
+                _mm_storeu_ps(&points[i].x, _mm_add_ps(_mm_loadu_ps(&points[i].x), d));
+            return i;
+        }
+
+        constexpr RectKernels sse2_kernels = {
+            detail::intersects_blocks<Sse2>,
+            detail::contains_rect_blocks<Sse2>,
+            detail::contains_point_blocks<Sse2>,
+            detail::points_in_rect_blocks<Sse2>,
+            sse2_intersection,
+            sse2_united,
+            sse2_translate_rects,
+            sse2_translate_points,
+        };
+
+        bool cpu_has_avx2()
+        {
+#if !defined(BLAZE2D_HAVE_AVX2)
+            return false;
+#elif defined(_MSC_VER) && !defined(__clang__)
+            int info[4];
+            __cpuid(info, 0);
+            if (info[0] < 7)
+                return false;
+
+            // AVX needs OS support for the YMM state (OSXSAVE + XCR0).
+            __cpuid(info, 1);
+            const bool osxsave = (info[2] & (1 << 27)) != 0;
+            const bool avx = (info[2] & (1 << 28)) != 0;
+            if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6)
+                return false;
+
+            __cpuidex(info, 7, 0);
+            return (info[1] & (1 << 5)) != 0;
+#else
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2");
+#endif
+        }
+#endif // BLAZE2D_SSE2
+
+#if BLAZE2D_NEON
+        /* =========================
+           NEON (ARM64 baseline)
+           ========================= */
+
+        struct Neon
+        {
+            using F = float32x4_t;
+            using M = uint32x4_t;
+            static constexpr std::size_t width = 4;
+            static constexpr unsigned all = 0xF;
+
+            static F splat(float v) { return vdupq_n_f32(v); }
+            static F add(F a, F b) { return vaddq_f32(a, b); }
+            static M ge(F a, F b) { return vcgeq_f32(a, b); }
+            static M le(F a, F b) { return vcleq_f32(a, b); }
+            static M lt(F a, F b) { return vcltq_f32(a, b); }
+            static M and_(M a, M b) { return vandq_u32(a, b); }
+            static M or_(M a, M b) { return vorrq_u32(a, b); }
+
+            static unsigned bits(M m)
+            {
+                static constexpr uint32_t weights[4] = { 1, 2, 4, 8 };
+                return vaddvq_u32(vandq_u32(m, vld1q_u32(weights)));
+            }
+
+            static void load_rects(const Rect* rects, F& x, F& y, F& w, F& h)
+            {
+                const float32x4x4_t v = vld4q_f32(&rects->x);
+                x = v.val[0];
+                y = v.val[1];
+                w = v.val[2];
+                h = v.val[3];
+            }
+
+            static void load_points(const Vec2* points, F& x, F& y)
+            {
+                const float32x4x2_t v = vld2q_f32(&points->x);
+                x = v.val[0];
+                y = v.val[1];
+            }
+        };
+
+        // Same operand order as std::max / std::min (see the SSE2 notes).
+        inline float32x2_t neon_max(float32x2_t a, float32x2_t b) { return vbsl_f32(vclt_f32(a, b), b, a); }
+        inline float32x2_t neon_min(float32x2_t a, float32x2_t b) { return vbsl_f32(vclt_f32(b, a), b, a); }
+
+        std::size_t neon_intersection(const Rect* rects, std::size_t count, const Rect& clip, Rect* out)
+        {
+            const float32x4_t c = vld1q_f32(&clip.x);
+            const float32x2_t cLo = vget_low_f32(c);
+            const float32x2_t cHi = vadd_f32(cLo, vget_high_f32(c));
+
+            for (std::size_t i = 0; i < count; ++i) {
+                const float32x4_t r = vld1q_f32(&rects[i].x);
+                const float32x2_t lo = vget_low_f32(r);
+                const float32x2_t hi = vadd_f32(lo, vget_high_f32(r));
+
+                const float32x2_t n = neon_max(lo, cLo);
+                const float32x2_t f = neon_min(hi, cHi);
+                if (vget_lane_u64(vreinterpret_u64_u32(vcle_f32(f, n)), 0) != 0)
+                    vst1q_f32(&out[i].x, vdupq_n_f32(0.0f));
+                else
+                    vst1q_f32(&out[i].x, vcombine_f32(n, vsub_f32(f, n)));
+            }
+            return count;
+        }
+
+        std::size_t neon_united(const Rect* rects, std::size_t count, const Rect& other, Rect* out)
+        {
+            const float32x4_t c = vld1q_f32(&other.x);
+            const float32x2_t cLo = vget_low_f32(c);
+            const float32x2_t cHi = vadd_f32(cLo, vget_high_f32(c));
+
+            for (std::size_t i = 0; i < count; ++i) {
+                const float32x4_t r = vld1q_f32(&rects[i].x);
+                const float32x2_t lo = vget_low_f32(r);
+                const float32x2_t hi = vadd_f32(lo, vget_high_f32(r));
+
+                const float32x2_t n = neon_min(lo, cLo);
+                const float32x2_t f = neon_max(hi, cHi);
+                vst1q_f32(&out[i].x, vcombine_f32(n, vsub_f32(f, n)));
+            }
+            return count;
+        }
+
+        std::size_t neon_translate_rects(Rect* rects, std::size_t count, const Vec2& delta)
+        {
+            const float32x2_t d = vld1_f32(&delta.x);
+            for (std::size_t i = 0; i < count; ++i)
+                vst1_f32(&rects[i].x, vadd_f32(vld1_f32(&rects[i].x), d));
+            return count;
+        }
+
+        std::size_t neon_translate_points(Vec2* points, std::size_t count, const Vec2& delta)
+        {
+            const float32x4_t d = vcombine_f32(vld1_f32(&delta.x), vld1_f32(&delta.x));
+            std::size_t i = 0;
+            for (; i + 2 <= count; i += 2)
+                vst1q_f32(&points[i].x, vaddq_f32(vld1q_f32(&points[i].x), d));
+            return i;
+        }
+
+        constexpr RectKernels neon_kernels = {
+            detail::intersects_blocks<Neon>,
+            detail::contains_rect_blocks<Neon>,
+            detail::contains_point_blocks<Neon>,
+            detail::points_in_rect_blocks<Neon>,
+            neon_intersection,
+            neon_united,
+            neon_translate_rects,
+            neon_translate_points,
+        };
+#endif // BLAZE2D_NEON
+
+        /* =========================
+           Dispatch
+           ========================= */
+
+        bool supported(SimdLevel level)
+        {
+            switch (level) {
+            case SimdLevel::Scalar: return true;
+#if BLAZE2D_SSE2
+            case SimdLevel::SSE2: return true;
+            case SimdLevel::AVX2: {
+                static const bool avx2 = cpu_has_avx2();
+                return avx2;
+            }
+#endif
+#if BLAZE2D_NEON
+            case SimdLevel::NEON: return true;
+#endif
+            default: return false;
+            }
+        }
+
+        const RectKernels& kernels_for(SimdLevel level)
+        {
+            switch (level) {
+#if BLAZE2D_SSE2
+            case SimdLevel::SSE2: return sse2_kernels;
+#endif
+#if defined(BLAZE2D_HAVE_AVX2)
+            case SimdLevel::AVX2: return detail::avx2_rect_kernels;
+#endif
+#if BLAZE2D_NEON
+            case SimdLevel::NEON: return neon_kernels;
+#endif
+            default: return scalar_kernels;
+            }
+        }
+
+        SimdLevel best_supported(SimdLevel level)
+        {
+            if (level == SimdLevel::AVX2 && !supported(level))
+                level = SimdLevel::SSE2;
+            return supported(level) ? level : SimdLevel::Scalar;
+        }
+
+        SimdLevel detect_level()
+        {
+            for (SimdLevel level : { SimdLevel::AVX2, SimdLevel::NEON, SimdLevel::SSE2 }) {
+                if (supported(level))
+                    return level;
+            }
+            return SimdLevel::Scalar;
+        }
+
+        struct Dispatch
+        {
+            std::atomic<const RectKernels*> kernels;
+            std::atomic<SimdLevel> level;
+
+            Dispatch()
+            {
+                const SimdLevel detected = detect_level();
+                kernels = &kernels_for(detected);
+                level = detected;
+            }
+        };
+
+        Dispatch& dispatch()
+        {
+            static Dispatch instance;
+            return instance;
+        }
+
+        const RectKernels& kernels()
+        {
+            return *dispatch().kernels.load(std::memory_order_relaxed);
+        }
+
+        void check_output(std::size_t in, std::size_t out)
+        {
+            if (out < in)
+                throw std::invalid_argument("blaze::batch: output span is shorter than the input");
+        }
+
+    } // namespace
+
+    namespace batch
+    {
+        /* =========================
+           Predicates
+           ========================= */
+
+        std::size_t intersects(std::span<const Rect> rects, const Rect& area, std::span<uint8_t> out)
+        {
+            check_output(rects.size(), out.size());
+            std::size_t hits = 0;
+            std::size_t i = kernels().intersects(rects.data(), rects.size(), area, out.data(), hits);
+            for (; i < rects.size(); ++i)
+                hits += out[i] = rects[i].intersects(area);
+            return hits;
+        }
+
+        std::size_t contains(std::span<const Rect> rects, const Rect& inner, std::span<uint8_t> out)
+        {
+            check_output(rects.size(), out.size());
+            std::size_t hits = 0;
+            std::size_t i = kernels().containsRect(rects.data(), rects.size(), inner, out.data(), hits);
+            for (; i < rects.size(); ++i)
+                hits += out[i] = rects[i].contains(inner);
+            return hits;
+        }
+
+        std::size_t contains(std::span<const Rect> rects, const Vec2& point, std::span<uint8_t> out)
+        {
+            check_output(rects.size(), out.size());
+            std::size_t hits = 0;
+            std::size_t i = kernels().containsPoint(rects.data(), rects.size(), point, out.data(), hits);
+            for (; i < rects.size(); ++i)
+                hits += out[i] = rects[i].contains(point);
+            return hits;
+        }
+
+        std::size_t pointsInRect(const Rect& rect, std::span<const Vec2> points, std::span<uint8_t> out)
+        {
+            check_output(points.size(), out.size());
+            std::size_t hits = 0;
+            std::size_t i = kernels().pointsInRect(rect, points.data(), points.size(), out.data(), hits);
+            for (; i < points.size(); ++i)
+                hits += out[i] = rect.contains(points[i]);
+            return hits;
+        }
+
+        /* =========================
+           Transforms
+           ========================= */
+
+        void intersection(std::span<const Rect> rects, const Rect& clip, std::span<Rect> out)
+        {
+            check_output(rects.size(), out.size());
+            std::size_t i = kernels().intersection(rects.data(), rects.size(), clip, out.data());
+            for (; i < rects.size(); ++i)
+                out[i] = rects[i].intersection(clip);
+        }
+
+        void united(std::span<const Rect> rects, const Rect& other, std::span<Rect> out)
+        {
+            check_output(rects.size(), out.size());
+            std::size_t i = kernels().united(rects.data(), rects.size(), other, out.data());
+            for (; i < rects.size(); ++i)
+                out[i] = rects[i].united(other);
+        }
+
+        void translate(std::span<Rect> rects, const Vec2& delta)
+        {
+            std::size_t i = kernels().translateRects(rects.data(), rects.size(), delta);
+            for (; i < rects.size(); ++i)
+                rects[i] = rects[i].translated(delta);
+        }
+
+        void translate(std::span<Vec2> points, const Vec2& delta)
+        {
+            std::size_t i = kernels().translatePoints(points.data(), points.size(), delta);
+            for (; i < points.size(); ++i)
+                points[i] += delta;
+        }
+
+        /* =========================
+           Dispatch
+           ========================= */
+
+        SimdLevel level()
+        {
+            return dispatch().level.load(std::memory_order_relaxed);
+        }
+
+        SimdLevel forceLevel(SimdLevel requested)
+        {
+            const SimdLevel selected = best_supported(requested);
+            Dispatch& d = dispatch();
+            d.kernels.store(&kernels_for(selected), std::memory_order_relaxed);
+            d.level.store(selected, std::memory_order_relaxed);
+            return selected;
+        }
+
+        const char* levelName(SimdLevel level)
+        {
+            switch (level) {
+            case SimdLevel::SSE2: return "sse2";
+            case SimdLevel::AVX2: return "avx2";
+            case SimdLevel::NEON: return "neon";
+            default: return "scalar";
+            }
+        }
+    }
+
+} // namespace blaze
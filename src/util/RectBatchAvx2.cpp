@@ -0,0 +1,147 @@
+// Built with AVX2 enabled (see CMakeLists.txt) and only reached after the
+// runtime CPU check in RectBatch.cpp.
+#include "Blaze2D/internal/RectKernels.h"
+
+#include <immintrin.h>
+
+namespace blaze::detail
+{
+    namespace {
+
+        struct Avx2
+        {
+            using F = __m256;
+            using M = __m256;
+            static constexpr std::size_t width = 8;
+            static constexpr unsigned all = 0xFF;
+
+            static F splat(float v) { return _mm256_set1_ps(v); }
+            static F add(F a, F b) { return _mm256_add_ps(a, b); }
+            static M ge(F a, F b) { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+            static M le(F a, F b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+            static M lt(F a, F b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+            static M and_(M a, M b) { return _mm256_and_ps(a, b); }
+            static M or_(M a, M b) { return _mm256_or_ps(a, b); }
+            static unsigned bits(M m) { return static_cast<unsigned>(_mm256_movemask_ps(m)); }
+
+            static void load_rects(const Rect* rects, F& x, F& y, F& w, F& h)
+            {
+                // Rects i and i + 4 share a register so the in-lane transpose
+                // leaves lanes in order.
+                const float* p = &rects->x;
+                const F r04 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p)), _mm_loadu_ps(p + 16), 1);
+                const F r15 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 4)), _mm_loadu_ps(p + 20), 1);
+                const F r26 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 8)), _mm_loadu_ps(p + 24), 1);
+                const F r37 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 12)), _mm_loadu_ps(p + 28), 1);
+
+                const F xy01 = _mm256_unpacklo_ps(r04, r15);
+                const F xy23 = _mm256_unpacklo_ps(r26, r37);
+                const F wh01 = _mm256_unpackhi_ps(r04, r15);
+                const F wh23 = _mm256_unpackhi_ps(r26, r37);
+
+                x = _mm256_shuffle_ps(xy01, xy23, _MM_SHUFFLE(1, 0, 1, 0));
+                y = _mm256_shuffle_ps(xy01, xy23, _MM_SHUFFLE(3, 2, 3, 2));
+                w = _mm256_shuffle_ps(wh01, wh23, _MM_SHUFFLE(1, 0, 1, 0));
+                h = _mm256_shuffle_ps(wh01, wh23, _MM_SHUFFLE(3, 2, 3, 2));
+            }
+
+            static void load_points(const Vec2* points, F& x, F& y)
+            {
+                const float* p = &points->x;
+                const F a = _mm256_loadu_ps(p);
+                const F b = _mm256_loadu_ps(p + 8);
+
+                // In-lane shuffles give points 0 1 4 5 | 2 3 6 7; swap the middle pairs back.
+                const F xs = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+                const F ys = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+                x = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(xs), _MM_SHUFFLE(3, 1, 2, 0)));
+                y = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(ys), _MM_SHUFFLE(3, 1, 2, 0)));
+            }
+        };
+
+        /*
+            Two rects per register, each 128-bit lane laid out as in the
+            SSE2 kernels: (x, y, w, h) -> (left, top, right, bottom), with
+            _mm256_max_ps(b, a) standing in for std::max(a, b).
+        */
+        inline __m256 edges(__m256 r)
+        {
+            const __m256 sum = _mm256_add_ps(r, _mm256_shuffle_ps(r, r, _MM_SHUFFLE(1, 0, 1, 0)));
+            return _mm256_blend_ps(r, sum, 0xCC);
+        }
+
+        inline __m256 from_edges(__m256 e)
+        {
+            return _mm256_sub_ps(e, _mm256_shuffle_ps(_mm256_setzero_ps(), e, _MM_SHUFFLE(1, 0, 1, 0)));
+        }
+
+        inline __m256 load_clip(const Rect& r)
+        {
+            const __m128 one = _mm_loadu_ps(&r.x);
+            return edges(_mm256_insertf128_ps(_mm256_castps128_ps256(one), one, 1));
+        }
+
+        std::size_t intersection(const Rect* rects, std::size_t count, const Rect& clip, Rect* out)
+        {
+            const __m256 c = load_clip(clip);
+            std::size_t i = 0;
+            for (; i + 2 <= count; i += 2) {
+                const __m256 e = edges(_mm256_loadu_ps(&rects[i].x));
+                const __m256 m = _mm256_blend_ps(_mm256_max_ps(c, e), _mm256_min_ps(c, e), 0xCC);
+
+                // nr <= nx || nb <= ny -> Rect(), per 128-bit lane
+                const __m256 cmp = _mm256_cmp_ps(_mm256_shuffle_ps(m, m, _MM_SHUFFLE(3, 2, 3, 2)), m, _CMP_LE_OQ);
+                const __m256 empty = _mm256_or_ps(
+                    _mm256_shuffle_ps(cmp, cmp, _MM_SHUFFLE(0, 0, 0, 0)),
+                    _mm256_shuffle_ps(cmp, cmp, _MM_SHUFFLE(1, 1, 1, 1)));
+                _mm256_storeu_ps(&out[i].x, _mm256_andnot_ps(empty, from_edges(m)));
+            }
+            return i;
+        }
+
+        std::size_t united(const Rect* rects, std::size_t count, const Rect& other, Rect* out)
+        {
+            const __m256 c = load_clip(other);
+            std::size_t i = 0;
+            for (; i + 2 <= count; i += 2) {
+                const __m256 e = edges(_mm256_loadu_ps(&rects[i].x));
+                const __m256 m = _mm256_blend_ps(_mm256_min_ps(c, e), _mm256_max_ps(c, e), 0xCC);
+                _mm256_storeu_ps(&out[i].x, from_edges(m));
+            }
+            return i;
+        }
+
+        std::size_t translate_rects(Rect* rects, std::size_t count, const Vec2& delta)
+        {
+            const __m256 d = _mm256_setr_ps(delta.x, delta.y, 0.0f, 0.0f, delta.x, delta.y, 0.0f, 0.0f);
+            std::size_t i = 0;
+            for (; i + 2 <= count; i += 2) {
+                const __m256 r = _mm256_loadu_ps(&rects[i].x);
+                _mm256_storeu_ps(&rects[i].x, _mm256_blend_ps(_mm256_add_ps(r, d), r, 0xCC));
+            }
+            return i;
+        }
+
+        std::size_t translate_points(Vec2* points, std::size_t count, const Vec2& delta)
+        {
+            const __m256 d = _mm256_setr_ps(delta.x, delta.y, delta.x, delta.y, delta.x, delta.y, delta.x, delta.y);
+            std::size_t i = 0;
+            for (; i + 4 <= count; i += 4)
+                _mm256_storeu_ps(&points[i].x, _mm256_add_ps(_mm256_loadu_ps(&points[i].x), d));
+            return i;
+        }
+
+    } // namespace
+
+    const RectKernels avx2_rect_kernels = {
+        intersects_blocks<Avx2>,
+        contains_rect_blocks<Avx2>,
+        contains_point_blocks<Avx2>,
+        points_in_rect_blocks<Avx2>,
+        intersection,
+        united,
+        translate_rects,
+        translate_points,
+    };
+
+} // namespace blaze::detail
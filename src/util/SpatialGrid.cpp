@@ -0,0 +1,387 @@
+#include "Blaze2D/util/SpatialIndex.h"
+#include "Blaze2D/util/FrameArena.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory_resource>
+#include <stdexcept>
+
+namespace blaze
+{
+    namespace {
+
+        uint32_t hash_cell(int32_t x, int32_t y)
+        {
+            uint64_t key = (uint64_t(uint32_t(x)) << 32) | uint32_t(y);
+            key *= 0x9E3779B97F4A7C15ULL;
+            return static_cast<uint32_t>(key >> 32);
+        }
+
+        float min_x(const Rect& r) { return std::min(r.x, r.right()); }
+        float min_y(const Rect& r) { return std::min(r.y, r.bottom()); }
+
+    } // namespace
+
+    SpatialGrid::SpatialGrid(float cellSize)
+        : cell_size(cellSize), inv_cell_size(1.0f / cellSize)
+    {
+        if (!(cellSize > 0.0f))
+            throw std::invalid_argument("SpatialGrid: cell size must be positive");
+    }
+
+    /* =========================
+       Cells
+       ========================= */
+
+    int32_t SpatialGrid::cellCoord(float v) const
+    {
+        // Clamped so far-away (or non-finite) coordinates share the edge cells.
+        constexpr float limit = 1 << 30;
+        const float c = std::floor(v * inv_cell_size);
+        if (!(c > -limit))
+            return -(1 << 30);
+        if (!(c < limit))
+            return 1 << 30;
+        return static_cast<int32_t>(c);
+    }
+
+    SpatialGrid::CellRange SpatialGrid::cellsFor(const Rect& bounds) const
+    {
+        const float right = bounds.right();
+        const float bottom = bounds.bottom();
+        return { cellCoord(std::min(bounds.x, right)), cellCoord(std::min(bounds.y, bottom)),
+            cellCoord(std::max(bounds.x, right)), cellCoord(std::max(bounds.y, bottom)) };
+    }
+
+    bool SpatialGrid::isLarge(const CellRange& range) const
+    {
+        return int64_t(range.x1) - range.x0 >= max_cells_per_axis
+            || int64_t(range.y1) - range.y0 >= max_cells_per_axis;
+    }
+
+    uint32_t SpatialGrid::findSlot(int32_t x, int32_t y) const
+    {
+        if (cells.empty())
+            return npos;
+
+        const std::size_t mask = cells.size() - 1;
+        for (std::size_t i = hash_cell(x, y) & mask;; i = (i + 1) & mask) {
+            const Cell& cell = cells[i];
+            if (!cell.used)
+                return npos;
+            if (cell.x == x && cell.y == y)
+                return static_cast<uint32_t>(i);
+        }
+    }
+
+    SpatialGrid::Cell& SpatialGrid::getCell(int32_t x, int32_t y)
+    {
+        if ((used_cells + 1) * 2 > cells.size())
+            growCells();
+
+        const std::size_t mask = cells.size() - 1;
+        std::size_t i = hash_cell(x, y) & mask;
+        for (; cells[i].used; i = (i + 1) & mask) {
+            if (cells[i].x == x && cells[i].y == y)
+                return cells[i];
+        }
+
+        cells[i] = { x, y, npos, true };
+        ++used_cells;
+        return cells[i];
+    }
+
+    void SpatialGrid::growCells()
+    {
+        /*
+            Cells are never removed individually (that would break probe
+            chains), so empty ones are dropped here instead. The table
+            grows only if the cells still in use need it.
+        */
+        std::size_t live = 0;
+        for (const Cell& cell : cells)
+            live += cell.used && cell.head != npos;
+
+        std::size_t size = 64;
+        while (size < (live + 1) * 4)
+            size *= 2;
+
+        std::vector<Cell> old(size, Cell{ 0, 0, npos, false });
+        old.swap(cells);
+        used_cells = live;
+
+        const std::size_t mask = size - 1;
+        for (const Cell& cell : old) {
+            if (!cell.used || cell.head == npos)
+                continue;
+            std::size_t i = hash_cell(cell.x, cell.y) & mask;
+            while (cells[i].used)
+                i = (i + 1) & mask;
+            cells[i] = cell;
+        }
+    }
+
+    template <typename Fn>
+    void SpatialGrid::forEachCell(const CellRange& range, Fn&& fn) const
+    {
+        const uint64_t span = uint64_t(int64_t(range.x1) - range.x0 + 1) * uint64_t(int64_t(range.y1) - range.y0 + 1);
+
+        // Large areas: walking the table beats probing for mostly empty cells.
+        if (span > cells.size()) {
+            for (const Cell& cell : cells) {
+                if (cell.used && cell.head != npos
+                    && cell.x >= range.x0 && cell.x <= range.x1 && cell.y >= range.y0 && cell.y <= range.y1)
+                    fn(cell);
+            }
+            return;
+        }
+
+        for (int32_t y = range.y0; y <= range.y1; ++y) {
+            for (int32_t x = range.x0; x <= range.x1; ++x) {
+                const uint32_t slot = findSlot(x, y);
+                if (slot != npos && cells[slot].head != npos)
+                    fn(cells[slot]);
+            }
+        }
+    }
+
+    /* =========================
+       Links
+       ========================= */
+
+    void SpatialGrid::link(uint32_t proxy)
+    {
+        Proxy& p = proxies[proxy];
+        if (isLarge(p.cells)) {
+            p.large = static_cast<uint32_t>(large_proxies.size());
+            large_proxies.push_back(proxy);
+            return;
+        }
+
+        p.large = npos;
+        const CellRange range = p.cells;
+        for (int32_t y = range.y0; y <= range.y1; ++y) {
+            for (int32_t x = range.x0; x <= range.x1; ++x) {
+                uint32_t l;
+                if (free_links != npos) {
+                    l = free_links;
+                    free_links = links[l].next;
+                }
+                else {
+                    l = static_cast<uint32_t>(links.size());
+                    links.emplace_back();
+                }
+
+                Cell& cell = getCell(x, y);
+                links[l] = { proxy, cell.head };
+                cell.head = l;
+            }
+        }
+    }
+
+    void SpatialGrid::unlink(uint32_t proxy)
+    {
+        Proxy& p = proxies[proxy];
+        if (p.large != npos) {
+            const uint32_t last = large_proxies.back();
+            large_proxies[p.large] = last;
+            proxies[last].large = p.large;
+            large_proxies.pop_back();
+            p.large = npos;
+            return;
+        }
+
+        const CellRange range = p.cells;
+        for (int32_t y = range.y0; y <= range.y1; ++y) {
+            for (int32_t x = range.x0; x <= range.x1; ++x) {
+                const uint32_t slot = findSlot(x, y);
+                if (slot == npos)
+                    continue;
+
+                for (uint32_t* at = &cells[slot].head; *at != npos; at = &links[*at].next) {
+                    const uint32_t l = *at;
+                    if (links[l].proxy == proxy) {
+                        *at = links[l].next;
+                        links[l].next = free_links;
+                        free_links = l;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    /* =========================
+       Proxies
+       ========================= */
+
+    uint32_t SpatialGrid::insert(const Rect& bounds, uint32_t value)
+    {
+        uint32_t proxy;
+        if (free_proxies != npos) {
+            proxy = free_proxies;
+            free_proxies = proxies[proxy].large;
+        }
+        else {
+            proxy = static_cast<uint32_t>(proxies.size());
+            proxies.emplace_back();
+        }
+
+        proxies[proxy] = { bounds, cellsFor(bounds), value, npos, true };
+        link(proxy);
+        ++count;
+        return proxy;
+    }
+
+    void SpatialGrid::remove(uint32_t proxy)
+    {
+        if (proxy >= proxies.size() || !proxies[proxy].used)
+            throw std::out_of_range("SpatialGrid: invalid proxy");
+
+        unlink(proxy);
+        proxies[proxy].used = false;
+        proxies[proxy].large = free_proxies;
+        free_proxies = proxy;
+        --count;
+    }
+
+    void SpatialGrid::move(uint32_t proxy, const Rect& bounds)
+    {
+        if (proxy >= proxies.size() || !proxies[proxy].used)
+            throw std::out_of_range("SpatialGrid: invalid proxy");
+
+        const CellRange range = cellsFor(bounds);
+        if (range == proxies[proxy].cells) {
+            proxies[proxy].bounds = bounds;
+            return;
+        }
+
+        unlink(proxy);
+        proxies[proxy].bounds = bounds;
+        proxies[proxy].cells = range;
+        link(proxy);
+    }
+
+    void SpatialGrid::clear()
+    {
+        proxies.clear();
+        free_proxies = npos;
+        count = 0;
+        cells.clear();
+        used_cells = 0;
+        links.clear();
+        free_links = npos;
+        large_proxies.clear();
+    }
+
+    /* =========================
+       Queries
+       ========================= */
+
+    std::size_t SpatialGrid::query(const Rect& area, std::vector<uint32_t>& out) const
+    {
+        const std::size_t before = out.size();
+        const float areaX = min_x(area);
+        const float areaY = min_y(area);
+
+        forEachCell(cellsFor(area), [&](const Cell& cell) {
+            for (uint32_t l = cell.head; l != npos; l = links[l].next) {
+                const Proxy& p = proxies[links[l].proxy];
+                if (!p.bounds.intersects(area))
+                    continue;
+
+                // Report from the cell holding the top-left corner of the overlap only.
+                if (cellCoord(std::max(min_x(p.bounds), areaX)) == cell.x
+                    && cellCoord(std::max(min_y(p.bounds), areaY)) == cell.y)
+                    out.push_back(p.value);
+            }
+        });
+
+        for (uint32_t proxy : large_proxies) {
+            if (proxies[proxy].bounds.intersects(area))
+                out.push_back(proxies[proxy].value);
+        }
+        return out.size() - before;
+    }
+
+    std::size_t SpatialGrid::queryPoint(const Vec2& point, std::vector<uint32_t>& out) const
+    {
+        const std::size_t before = out.size();
+
+        // A point lies in a single cell, so there is nothing to filter.
+        const uint32_t slot = findSlot(cellCoord(point.x), cellCoord(point.y));
+        if (slot != npos) {
+            for (uint32_t l = cells[slot].head; l != npos; l = links[l].next) {
+                const Proxy& p = proxies[links[l].proxy];
+                if (p.bounds.contains(point))
+                    out.push_back(p.value);
+            }
+        }
+
+        for (uint32_t proxy : large_proxies) {
+            if (proxies[proxy].bounds.contains(point))
+                out.push_back(proxies[proxy].value);
+        }
+        return out.size() - before;
+    }
+
+    std::size_t SpatialGrid::queryPairs(std::vector<SpatialPair>& out) const
+    {
+        const std::size_t before = out.size();
+
+        auto emit = [&](uint32_t a, uint32_t b) {
+            if (a > b)
+                std::swap(a, b);
+            out.push_back({ proxies[a].value, proxies[b].value });
+        };
+
+        // Pairs sharing a cell, reported from the cell holding the top-left corner of their overlap.
+        FrameArena::Scope scope(FrameArena::local());
+        std::pmr::vector<uint32_t> members(&scope.arena());
+        for (const Cell& cell : cells) {
+            if (!cell.used || cell.head == npos)
+                continue;
+
+            members.clear();
+            for (uint32_t l = cell.head; l != npos; l = links[l].next)
+                members.push_back(links[l].proxy);
+
+            for (std::size_t i = 0; i < members.size(); ++i) {
+                const Rect& a = proxies[members[i]].bounds;
+                for (std::size_t j = i + 1; j < members.size(); ++j) {
+                    const Rect& b = proxies[members[j]].bounds;
+                    if (a.intersects(b)
+                        && cellCoord(std::max(min_x(a), min_x(b))) == cell.x
+                        && cellCoord(std::max(min_y(a), min_y(b))) == cell.y)
+                        emit(members[i], members[j]);
+                }
+            }
+        }
+
+        // Large objects against each other and against the grid.
+        for (std::size_t i = 0; i < large_proxies.size(); ++i) {
+            const uint32_t large = large_proxies[i];
+            const Rect& bounds = proxies[large].bounds;
+
+            for (std::size_t j = i + 1; j < large_proxies.size(); ++j) {
+                if (bounds.intersects(proxies[large_proxies[j]].bounds))
+                    emit(large, large_proxies[j]);
+            }
+
+            const float boundsX = min_x(bounds);
+            const float boundsY = min_y(bounds);
+            forEachCell(proxies[large].cells, [&](const Cell& cell) {
+                for (uint32_t l = cell.head; l != npos; l = links[l].next) {
+                    const uint32_t other = links[l].proxy;
+                    const Rect& b = proxies[other].bounds;
+                    if (bounds.intersects(b)
+                        && cellCoord(std::max(min_x(b), boundsX)) == cell.x
+                        && cellCoord(std::max(min_y(b), boundsY)) == cell.y)
+                        emit(large, other);
+                }
+            });
+        }
+        return out.size() - before;
+    }
+
+} // namespace blaze
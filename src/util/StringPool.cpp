@@ -0,0 +1,63 @@
+#include "Blaze2D/util/StringPool.h"
+
+#include <cstring>
+#include <utility>
+
+namespace blaze
+{
+    std::string_view StringPool::intern(std::string_view str)
+    {
+        // All empty strings share the same (null) view.
+        if (str.empty())
+            return {};
+
+        std::lock_guard<std::mutex> lock(mutex);
+
+        auto it = strings.find(str);
+        if (it != strings.end())
+            return *it;
+
+        /*
+            Copy the string into block storage.
+
+            Blocks are never reallocated, so views into them stay valid
+            for the lifetime of the pool. Strings larger than a block get
+            a dedicated allocation.
+        */
+        char* dst = nullptr;
+        if (str.size() > block_size) {
+            blocks.push_back(std::make_unique<char[]>(str.size()));
+            dst = blocks.back().get();
+            // Keep filling the current block, which is now second to last.
+            if (blocks.size() > 1)
+                std::swap(blocks[blocks.size() - 1], blocks[blocks.size() - 2]);
+        }
+        else {
+            if (block_size - block_used < str.size()) {
+                blocks.push_back(std::make_unique<char[]>(block_size));
+                block_used = 0;
+            }
+            dst = blocks.back().get() + block_used;
+            block_used += str.size();
+        }
+
+        std::memcpy(dst, str.data(), str.size());
+
+        std::string_view stored(dst, str.size());
+        strings.insert(stored);
+        return stored;
+    }
+
+    std::size_t StringPool::size() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return strings.size();
+    }
+
+    StringPool& StringPool::shared()
+    {
+        static StringPool pool;
+        return pool;
+    }
+
+} // namespace blaze
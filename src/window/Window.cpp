@@ -1,19 +1,50 @@
 #include "Blaze2D/window/Window.h"
 #include "Blaze2D/internal/SDLManager.h"
+#include "Blaze2D/util/Profiler.h"
 
+#include <cmath>
 #include <iostream>
+#include <stdexcept>
 
 namespace blaze {
 
-    Window::Window(const std::string _name, const int _width, const int _height, const std::string _title)
+    Window::Window(const std::string _name, const int _width, const int _height, const std::string _title, WindowMode mode)
         : name(_name), width(_width), height(_height) {
 
         //Assigns title if set
         title = (_title == "") ? _name : _title;
 
-        detail::ensure_sdl(SDL_INIT_VIDEO | SDL_INIT_EVENTS);
+        if (mode == WindowMode::Headless) {
+            /*
+                The software renderer draws straight into a surface, so
+                no video subsystem is needed and the pixels can be read
+                where they were drawn.
+            */
+            framebuffer = SDL_CreateSurface(width, height, SDL_PIXELFORMAT_RGBA32);
+            if (!framebuffer) {
+                throw std::runtime_error(std::string("SDL_CreateSurface failed: ") + SDL_GetError());
+            }
 
-        
+            renderer = SDL_CreateSoftwareRenderer(framebuffer);
+            if (!renderer) {
+                SDL_DestroySurface(framebuffer);
+                framebuffer = nullptr;
+                throw std::runtime_error(std::string("SDL_CreateSoftwareRenderer failed: ") + SDL_GetError());
+            }
+        }
+        else {
+            createNative();
+        }
+
+        root.reset(new Container(*this, Rect(0.0f, 0.0f, float(width), float(height)), nullptr));
+
+        paintRect = Rect(0.0f, 0.0f, float(width), float(height));
+        dirty.setBounds(paintRect);
+    }
+
+    void Window::createNative()
+    {
+        detail::ensure_sdl(SDL_INIT_VIDEO | SDL_INIT_EVENTS);
 
         window = SDL_CreateWindow(
             title.c_str(),
@@ -34,11 +65,17 @@ namespace blaze {
             throw std::runtime_error(std::string("SDL_CreateRenderer failed: ") + SDL_GetError());
         }
 
-       
-
+        id = SDL_GetWindowID(window);
     }
 
     Window::~Window() {
+        root.reset();
+        destroyCanvas();
+
+        for (SDL_Texture* texture : textures)
+            SDL_DestroyTexture(texture);
+        textures.clear();
+
         if (renderer) {
             SDL_DestroyRenderer(renderer);
             renderer = nullptr;
@@ -47,7 +84,210 @@ namespace blaze {
             SDL_DestroyWindow(window);
             window = nullptr;
         }
-        
+        if (framebuffer) {
+            SDL_DestroySurface(framebuffer);
+            framebuffer = nullptr;
+        }
+    }
+
+    void Window::resized(int newWidth, int newHeight)
+    {
+        width = newWidth;
+        height = newHeight;
+        root->setRect(Rect(0.0f, 0.0f, float(width), float(height)));
+
+        // The canvas is recreated at the new size by the next render().
+        destroyCanvas();
+        dirty.setBounds(Rect(0.0f, 0.0f, float(width), float(height)));
+    }
+
+    void Window::setDirtyTracking(bool enabled)
+    {
+        dirtyTracking = enabled;
+        if (!enabled)
+            destroyCanvas();
+        dirty.addAll();
+    }
+
+    void Window::createCanvas()
+    {
+        canvas = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height);
+        if (!canvas)
+            throw std::runtime_error(std::string("SDL_CreateTexture failed: ") + SDL_GetError());
+
+        // Copied over the back buffer as is.
+        SDL_SetTextureBlendMode(canvas, SDL_BLENDMODE_NONE);
+        dirty.addAll();
+    }
+
+    void Window::destroyCanvas()
+    {
+        if (canvas) {
+            SDL_DestroyTexture(canvas);
+            canvas = nullptr;
+        }
+    }
+
+    TextureHandle Window::createTexture(SDL_Surface* surface)
+    {
+        SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+        if (!texture)
+            throw std::runtime_error(std::string("SDL_CreateTextureFromSurface failed: ") + SDL_GetError());
+        return textures.insert(texture);
+    }
+
+    SDL_Texture* Window::getTexture(TextureHandle handle) const
+    {
+        SDL_Texture* const* texture = textures.get(handle);
+        return texture ? *texture : nullptr;
+    }
+
+    bool Window::destroyTexture(TextureHandle handle)
+    {
+        SDL_Texture* texture = getTexture(handle);
+        if (!texture)
+            return false;
+        SDL_DestroyTexture(texture);
+        return textures.erase(handle);
+    }
+
+    void Window::update(double dt)
+    {
+        BLAZE_PROFILE_SCOPE("Window::update");
+        if (updateCallback)
+            updateCallback(*this, dt);
+    }
+
+    void Window::render(double alpha)
+    {
+        BLAZE_PROFILE_SCOPE("Window::render");
+        const std::size_t relaid = root->layout();
+        const Rect whole(0.0f, 0.0f, float(width), float(height));
+
+        // Recorded once, then replayed like a render callback (once per dirty rect).
+        if (recordCallback) {
+            record(alpha);
+            swapCommands();
+        }
+
+        if (!dirtyTracking) {
+            paintRect = whole;
+            set_render_draw_color(renderer, clearColor);
+            SDL_RenderClear(renderer);
+
+            paint(alpha);
+            drawn = true;
+            return;
+        }
+
+        if (relaid > 0)
+            dirty.addAll();
+        if (!canvas)
+            createCanvas();
+
+        drawn = !dirty.empty();
+        if (!drawn)
+            return;
+
+        /*
+            Repaint each dirty rect on the persistent canvas: clear it and
+            run the callback clipped to it. Clip rects are whole pixels, so
+            round outwards.
+        */
+        SDL_SetRenderTarget(renderer, canvas);
+        for (const Rect& rect : dirty.getRects()) {
+            const float left = std::floor(rect.left());
+            const float top = std::floor(rect.top());
+            paintRect = Rect(left, top, std::ceil(rect.right()) - left, std::ceil(rect.bottom()) - top);
+
+            const SDL_Rect clip = { int(paintRect.x), int(paintRect.y), int(paintRect.w), int(paintRect.h) };
+            SDL_SetRenderClipRect(renderer, &clip);
+
+            const SDL_FRect fill = { paintRect.x, paintRect.y, paintRect.w, paintRect.h };
+            set_render_draw_color(renderer, clearColor);
+            SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+            SDL_RenderFillRect(renderer, &fill);
+
+            paint(alpha);
+        }
+        SDL_SetRenderClipRect(renderer, nullptr);
+        SDL_SetRenderTarget(renderer, nullptr);
+
+        paintRect = whole;
+        dirty.clear();
+    }
+
+    bool Window::present()
+    {
+        BLAZE_PROFILE_SCOPE("Window::present");
+        if (dirtyTracking) {
+            if (!drawn)
+                return false;
+            SDL_RenderTexture(renderer, canvas, nullptr, nullptr);
+        }
+
+        SDL_RenderPresent(renderer);
+        drawn = false;
+        return true;
+    }
+
+    void Window::paint(double alpha)
+    {
+        if (recordCallback) {
+            // A recorded clear or clip must not reach outside the dirty rect.
+            if (dirtyTracking)
+                commands[frontCommands].replay(renderer, paintRect);
+            else
+                commands[frontCommands].replay(renderer);
+        }
+        else if (renderCallback)
+            renderCallback(*this, renderer, alpha);
+    }
+
+    void Window::record(double alpha)
+    {
+        BLAZE_PROFILE_SCOPE("Window::record");
+        root->layout();
+
+        CommandBuffer& back = commands[frontCommands ^ 1];
+        back.reset();
+        paintRect = Rect(0.0f, 0.0f, float(width), float(height));
+
+        if (recordCallback)
+            recordCallback(*this, back, alpha);
+    }
+
+    bool Window::replay()
+    {
+        BLAZE_PROFILE_SCOPE("Window::replay");
+
+        // Whole frames: the recording does not know which rects will be dirty by now.
+        set_render_draw_color(renderer, clearColor);
+        SDL_RenderClear(renderer);
+        commands[frontCommands].replay(renderer);
+
+        SDL_RenderPresent(renderer);
+        drawn = false;
+        return true;
+    }
+
+    std::span<const uint8_t> Window::getPixels() const
+    {
+        if (!framebuffer)
+            return {};
+        return { static_cast<const uint8_t*>(framebuffer->pixels), static_cast<std::size_t>(framebuffer->pitch) * static_cast<std::size_t>(framebuffer->h) };
+    }
+
+    Color32 Window::readPixel(int x, int y) const
+    {
+        if (!framebuffer)
+            throw std::out_of_range("Window::readPixel: '" + name + "' is not headless");
+        if (x < 0 || y < 0 || x >= framebuffer->w || y >= framebuffer->h)
+            throw std::out_of_range("Window::readPixel: (" + std::to_string(x) + ", " + std::to_string(y) + ") is outside '" + name + "'");
+
+        const uint8_t* pixel = static_cast<const uint8_t*>(framebuffer->pixels)
+            + static_cast<std::size_t>(y) * static_cast<std::size_t>(framebuffer->pitch) + static_cast<std::size_t>(x) * 4;
+        return Color32(pixel[0], pixel[1], pixel[2], pixel[3]);
     }
 
 } // namespace blaze
@@ -1,6 +1,11 @@
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
 #include <Blaze2D/App.h>
 
+#include <SDL3/SDL.h>
+
+#include <stdexcept>
+
 TEST_CASE("blaze::App creates windows correctly", "[App][Window]") {
     blaze::App app;
 
@@ -62,4 +67,163 @@ TEST_CASE("blaze::App destroys windows correctly", "[App][Window]") {
 
     INFO("Ensuring window was deleted");
     REQUIRE_THROWS(app.getWindow("Test"));
-}
\ No newline at end of file
+}
+namespace {
+
+    struct PopupRun
+    {
+        int popupUpdates = 0;
+        int mainUpdates = 0;
+        int frames = 0;
+        std::size_t countInCallback = 0;
+        bool foundInCallback = true;
+        std::size_t countAfter = 0;
+        bool foundAfter = true;
+    };
+
+    // A popup removes itself from its own update callback while run() goes through the windows.
+    PopupRun run_self_removing_popup(bool pipelined)
+    {
+        blaze::App app;
+        blaze::Window& main = app.createWindow("Main", 4, 4, "", blaze::WindowMode::Headless);
+        blaze::Window& popup = app.createWindow("Popup", 4, 4, "", blaze::WindowMode::Headless);
+        const blaze::WindowHandle handle = popup.getHandle();
+
+        // Pipelined updates run on the worker, so results are checked afterwards.
+        PopupRun result;
+        popup.onUpdate([&](blaze::Window& self, double) {
+            ++result.popupUpdates;
+            app.removeWindow(self);
+            result.countInCallback = app.getWindowCount();
+            result.foundInCallback = app.getWindow(handle) != nullptr || !app.findWindow("Popup").isNull();
+        });
+        main.onUpdate([&](blaze::Window&, double) {
+            ++result.mainUpdates;
+        });
+        main.onRender([&](blaze::Window&, SDL_Renderer*, double) {
+            if (++result.frames == 5)
+                app.stop();
+        });
+
+        blaze::FrameLoopOptions options;
+        options.update_hz = 1000.0;
+        options.max_fps = 250.0;
+        options.pipelined = pipelined;
+        app.run(options);
+
+        result.countAfter = app.getWindowCount();
+        result.foundAfter = app.getWindow(handle) != nullptr;
+        return result;
+    }
+
+} // namespace
+
+TEST_CASE("blaze::App removes windows from their own callbacks", "[App][Window]") {
+    PopupRun run;
+
+    SECTION("Sequential frames") {
+        run = run_self_removing_popup(false);
+    }
+
+    SECTION("Pipelined frames") {
+        run = run_self_removing_popup(true);
+    }
+
+    CHECK(run.frames == 5);
+    CHECK(run.popupUpdates == 1);
+    CHECK(run.mainUpdates > 1);
+    CHECK(run.countInCallback == 1);
+    CHECK_FALSE(run.foundInCallback);
+    CHECK(run.countAfter == 1);
+    CHECK_FALSE(run.foundAfter);
+}
+
+TEST_CASE("blaze::FixedTimestep schedules whole steps", "[App][timestep]") {
+    blaze::FixedTimestep timestep(0.01, 4);
+
+    SECTION("Leftover time carries over as alpha") {
+        CHECK(timestep.advance(0.025) == 2);
+        CHECK(timestep.alpha() == Catch::Approx(0.5));
+        CHECK(timestep.advance(0.005) == 1);
+        CHECK(timestep.alpha() == Catch::Approx(0.0).margin(1e-9));
+    }
+
+    SECTION("Stalls are clamped and the excess is dropped") {
+        CHECK(timestep.advance(0.1) == 4);
+        CHECK(timestep.getDroppedSteps() == 6);
+        CHECK(timestep.alpha() < 1.0);
+        CHECK(timestep.advance(0.0) == 0);
+    }
+
+    SECTION("Invalid configurations are rejected") {
+        REQUIRE_THROWS_AS(blaze::FixedTimestep(0.0), std::invalid_argument);
+        REQUIRE_THROWS_AS(blaze::FixedTimestep(0.01, 0), std::invalid_argument);
+    }
+}
+
+TEST_CASE("blaze::App::run drives update and render until stopped", "[App][Window]") {
+    blaze::App app;
+    blaze::Window& window = app.createWindow("Loop");
+
+    int updates = 0;
+    int frames = 0;
+    window.onUpdate([&](blaze::Window&, double dt) {
+        CHECK(dt == Catch::Approx(1.0 / 120.0));
+        ++updates;
+    });
+    window.onRender([&](blaze::Window&, SDL_Renderer*, double alpha) {
+        CHECK(alpha >= 0.0);
+        CHECK(alpha < 1.0);
+        if (++frames == 10)
+            app.stop();
+    });
+
+    blaze::FrameLoopOptions options;
+    options.update_hz = 120.0;
+    options.max_fps = 240.0;
+    app.run(options);
+
+    const blaze::FrameStats& stats = app.getFrameStats();
+    CHECK(frames == 10);
+    CHECK(stats.frame_index == 10);
+    CHECK(updates > 0);
+    // The frame cap keeps each frame at least one period long.
+    CHECK(stats.frame_ms >= 1000.0 / 240.0 - 0.01);
+}
+
+TEST_CASE("blaze::Window renders headless into a readable framebuffer", "[App][Window][headless]") {
+    blaze::App app;
+    blaze::Window& window = app.createWindow("Headless", 64, 32, "", blaze::WindowMode::Headless);
+
+    REQUIRE(window.isHeadless());
+    CHECK(window.getSDLWindow() == nullptr);
+    REQUIRE(window.getFramebuffer() != nullptr);
+    CHECK(window.getPixels().size() == static_cast<std::size_t>(window.getFramebuffer()->pitch) * 32);
+
+    window.setClearColor(blaze::Color(1.f, 0.f, 0.f, 1.f));
+    window.onRender([](blaze::Window&, SDL_Renderer* renderer, double) {
+        const SDL_FRect square = { 8.f, 8.f, 8.f, 8.f };
+        blaze::set_render_draw_color(renderer, blaze::Color(0.f, 0.f, 1.f, 1.f));
+        SDL_RenderFillRect(renderer, &square);
+    });
+
+    app.render(0.0);
+    CHECK(app.present() == 1);
+
+    // Golden pixels: the clear color around the square, the square inside it.
+    CHECK(window.readPixel(0, 0) == blaze::Color32(255, 0, 0, 255));
+    CHECK(window.readPixel(63, 31) == blaze::Color32(255, 0, 0, 255));
+    CHECK(window.readPixel(8, 8) == blaze::Color32(0, 0, 255, 255));
+    CHECK(window.readPixel(15, 15) == blaze::Color32(0, 0, 255, 255));
+    CHECK(window.readPixel(16, 16) == blaze::Color32(255, 0, 0, 255));
+
+    CHECK_THROWS_AS(window.readPixel(64, 0), std::out_of_range);
+}
+
+// Needs a video driver; display-less CI skips it with "~[native]".
+TEST_CASE("blaze::Window::readPixel rejects native windows", "[App][Window][native]") {
+    blaze::App app;
+    blaze::Window& window = app.createWindow("Native");
+    CHECK_FALSE(window.isHeadless());
+    CHECK_THROWS_AS(window.readPixel(0, 0), std::out_of_range);
+}
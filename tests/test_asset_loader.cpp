@@ -0,0 +1,177 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Blaze2D/assets/AssetCache.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#include "test_support.h"
+
+namespace {
+
+    // Temp directory with a manifest listing 'count' text assets plus one missing file; removed when done.
+    struct TempAssets
+    {
+        blaze::test::TempDir dir{ "blaze_loader_test" };
+
+        explicit TempAssets(std::size_t count)
+        {
+            std::ofstream manifest(dir / "assets.manifest", std::ios::binary);
+            for (std::size_t i = 0; i < count; ++i) {
+                const std::string name = "text_" + std::to_string(i);
+                std::ofstream(dir / (name + ".txt"), std::ios::binary) << "contents of " << name;
+                manifest << "text | " << name << " | " << name << ".txt\n";
+            }
+            manifest << "text | missing | missing.txt\n";
+            manifest << "sprite | atlas | " << (std::filesystem::path(BLAZE_TEST_MEDIA_DIR) / "AtlasTest.png").generic_string() << "\n";
+        }
+
+        std::filesystem::path manifest() const { return dir / "assets.manifest"; }
+    };
+
+} // namespace
+
+TEST_CASE("blaze::AssetLoader loads manifest assets on worker threads", "[AssetLoader]") {
+    const TempAssets assets(16); // Outlives the loader's workers
+    blaze::Manifest manifest(assets.manifest());
+    blaze::AssetLoader loader(manifest, nullptr, { .threads = 4 });
+    CHECK(loader.getThreadCount() == 4);
+
+    SECTION("Assets become ready on the main thread") {
+        std::vector<blaze::AssetHandle> handles = loader.loadType("text");
+        REQUIRE(handles.size() == 17);
+        CHECK(loader.getPendingCount() == 17);
+
+        loader.waitAll();
+        CHECK(loader.getPendingCount() == 0);
+
+        for (std::size_t i = 0; i < 16; ++i) {
+            REQUIRE(handles[i].ready());
+            CHECK(handles[i].getData() == "contents of text_" + std::to_string(i));
+            CHECK(handles[i].getTexture() == nullptr);
+        }
+
+        const blaze::AssetHandle& missing = handles[16];
+        CHECK(missing.failed());
+        CHECK(missing.getData().empty());
+        CHECK_FALSE(missing.getError().empty());
+    }
+
+    SECTION("Decoded assets only change state in update()") {
+        blaze::AssetHandle handle = loader.load("text_3");
+        CHECK(handle.getId() == manifest.find("text_3"));
+
+        // Bounded, so a loader bug fails the test instead of hanging the suite.
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (handle.getState() != blaze::AssetState::Decoded) {
+            if (std::chrono::steady_clock::now() > deadline)
+                FAIL("text_3 was not decoded within 10 seconds");
+            std::this_thread::yield();
+        }
+        CHECK(handle.getData().empty());
+
+        CHECK(loader.update() == 1);
+        CHECK(handle.ready());
+        CHECK(loader.update() == 0);
+    }
+
+    SECTION("Requests for a live asset share one load") {
+        blaze::AssetHandle a = loader.load("text_1");
+        blaze::AssetHandle b = loader.load(manifest.find("text_1"));
+        CHECK(a == b);
+
+        loader.wait(b);
+        CHECK(a.ready());
+        CHECK(loader.getPendingCount() == 0);
+
+        CHECK_THROWS_AS(loader.load("nope"), std::out_of_range);
+        CHECK_THROWS_AS(loader.wait(blaze::AssetHandle()), std::invalid_argument);
+    }
+
+    SECTION("Dropping every handle cancels or discards the load") {
+        for (int i = 0; i < 16; ++i)
+            loader.load("text_" + std::to_string(i));
+        loader.waitAll();
+        CHECK(loader.getPendingCount() == 0);
+
+        // A later request starts over.
+        blaze::AssetHandle again = loader.load("text_0");
+        CHECK(again.getState() != blaze::AssetState::Ready);
+        loader.wait(again);
+        CHECK(again.ready());
+    }
+
+    SECTION("Images decode to surfaces without a renderer") {
+        blaze::AssetHandle atlas = loader.load("atlas");
+        loader.wait(atlas);
+        REQUIRE(atlas.ready());
+        CHECK(atlas.getSurface() != nullptr);
+        CHECK(atlas.getData().empty());
+    }
+}
+
+TEST_CASE("blaze::AssetCache evicts unreferenced assets in LRU order", "[AssetLoader][AssetCache]") {
+    const TempAssets assets(8);
+    blaze::Manifest manifest(assets.manifest());
+    blaze::AssetLoader loader(manifest, nullptr, { .threads = 2 });
+
+    // "contents of text_N" is 18 bytes; room for three of them.
+    constexpr std::size_t size = 18;
+    blaze::AssetCache cache(loader, size * 3);
+
+    auto touch = [&](int i) { return cache.get("text_" + std::to_string(i)); };
+
+    for (int i = 0; i < 3; ++i)
+        touch(i);
+    CHECK(cache.getStats().misses == 3);
+    CHECK(cache.getStats().bytes_resident == 0); // Nothing ready yet
+
+    loader.waitAll();
+    CHECK(cache.update() == 0);
+    CHECK(cache.getStats().bytes_resident == size * 3);
+    CHECK(cache.getStats().entries == 3);
+
+    // Hits keep the asset alive after callers let go and refresh its recency.
+    blaze::AssetHandle first = touch(0);
+    CHECK(first.ready());
+    CHECK(cache.getStats().hits == 1);
+
+    SECTION("The least recently used unreferenced entry goes first") {
+        first = {};
+        touch(3);
+        loader.waitAll();
+        CHECK(cache.update() == 1);
+
+        CHECK(cache.contains(manifest.find("text_0")));
+        CHECK_FALSE(cache.contains(manifest.find("text_1")));
+        CHECK(cache.getStats().evictions == 1);
+        CHECK(cache.getStats().bytes_resident == size * 3);
+
+        touch(1);
+        CHECK(cache.getStats().misses == 5);
+    }
+
+    SECTION("Referenced entries are never evicted") {
+        blaze::AssetHandle held = touch(1);
+        cache.setBudget(0);
+        CHECK(cache.getStats().entries == 2);
+        CHECK(cache.contains(manifest.find("text_0")));
+        CHECK(cache.contains(manifest.find("text_1")));
+        CHECK(cache.getStats().bytes_resident == size * 2);
+
+        first = {};
+        held = {};
+        CHECK(cache.clear() == 2);
+        CHECK(cache.getStats().entries == 0);
+        CHECK(cache.getStats().bytes_resident == 0);
+    }
+}
+
+TEST_CASE("blaze::AssetLoader recognizes image files by extension", "[AssetLoader]") {
+    CHECK(blaze::AssetLoader::isImagePath("a/b/hero.png"));
+    CHECK(blaze::AssetLoader::isImagePath("HERO.JPG"));
+    CHECK_FALSE(blaze::AssetLoader::isImagePath("music.ogg"));
+    CHECK_FALSE(blaze::AssetLoader::isImagePath("png"));
+}
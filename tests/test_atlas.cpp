@@ -0,0 +1,326 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Blaze2D/App.h>
+#include <Blaze2D/graphics/Atlas.h>
+#include <Blaze2D/graphics/AtlasBuilder.h>
+#include <Blaze2D/graphics/RectPacker.h>
+#include <Blaze2D/util/Manifest.h>
+
+#include <SDL3/SDL.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "test_support.h"
+
+static const std::filesystem::path media_dir = BLAZE_TEST_MEDIA_DIR;
+
+namespace {
+
+    // Pixel (x, y) of a sprite made by make_sprite(); 'seed' tells sprites apart.
+    blaze::Color32 sprite_pixel(uint8_t seed, int x, int y)
+    {
+        return blaze::Color32(seed, uint8_t(x * 8), uint8_t(y * 8), 255);
+    }
+
+    SDL_Surface* make_sprite(int w, int h, uint8_t seed)
+    {
+        SDL_Surface* surface = SDL_CreateSurface(w, h, SDL_PIXELFORMAT_RGBA32);
+        for (int y = 0; y < h; ++y) {
+            uint8_t* row = static_cast<uint8_t*>(surface->pixels) + y * surface->pitch;
+            for (int x = 0; x < w; ++x) {
+                const blaze::Color32 c = sprite_pixel(seed, x, y);
+                row[x * 4 + 0] = c.r;
+                row[x * 4 + 1] = c.g;
+                row[x * 4 + 2] = c.b;
+                row[x * 4 + 3] = c.a;
+            }
+        }
+        return surface;
+    }
+
+} // namespace
+
+TEST_CASE("blaze::Atlas loads a JSON sprite sheet", "[Atlas]") {
+    blaze::App app;
+    blaze::Window& window = app.createWindow("Atlas");
+
+    blaze::Atlas atlas(window.getRenderer(), media_dir / "AtlasTest.json");
+
+    REQUIRE(atlas.getTexture() != nullptr);
+    CHECK(atlas.getWidth() == 128.0f);
+    CHECK(atlas.getHeight() == 128.0f);
+    REQUIRE(atlas.size() == 4);
+
+    SECTION("Sprites are indexed in file order") {
+        const char* expected[] = { "rgb_gradient", "cmy_gradient", "rgb", "cmy" };
+        for (uint32_t i = 0; i < 4; ++i) {
+            blaze::SpriteId id = atlas.find(expected[i]);
+            REQUIRE(id.value == i);
+            CHECK(atlas.getName(id) == expected[i]);
+            CHECK(atlas.getRect(id) == blaze::Rect(0.0f, 32.0f * i, 96.0f, 32.0f));
+        }
+    }
+
+    SECTION("Unknown sprites resolve to an invalid id") {
+        CHECK_FALSE(atlas.find("missing"));
+    }
+}
+
+TEST_CASE("blaze::Atlas rejects malformed descriptions", "[Atlas]") {
+    blaze::App app;
+    blaze::Window& window = app.createWindow("Atlas");
+
+    auto path = std::filesystem::temp_directory_path() / "blaze_atlas_malformed.json";
+    {
+        std::ofstream ofs(path);
+        ofs << R"({ "image": "AtlasTest.png", "sprites": { "a": { "x": 0, "y": } } })";
+    }
+
+    REQUIRE_THROWS_AS(blaze::Atlas(window.getRenderer(), path), std::runtime_error);
+
+    SECTION("Numbers outside the JSON grammar are rejected") {
+        for (const char* number : { "inf", "-inf", "nan", "-nan", "01", "1.", ".5", "1e", "-" }) {
+            {
+                std::ofstream ofs(path);
+                ofs << R"({ "image": "AtlasTest.png", "sprites": { "a": { "x": )" << number << R"(, "y": 0 } } })";
+            }
+            try {
+                blaze::Atlas atlas(window.getRenderer(), path);
+                FAIL("accepted " << number);
+            }
+            catch (const std::runtime_error& e) {
+                INFO(number);
+                CHECK(std::string(e.what()).find("JSON parse error") != std::string::npos);
+            }
+        }
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("blaze::pack_rects places rects without overlap", "[Atlas][packer]") {
+    std::vector<blaze::PackSize> sizes;
+    for (int i = 0; i < 400; ++i)
+        sizes.push_back({ 4 + (i * 7) % 29, 4 + (i * 13) % 23 });
+
+    constexpr int page = 128;
+    std::vector<blaze::PackedRect> out(sizes.size());
+    uint32_t pages = blaze::pack_rects(sizes, page, page, out);
+
+    REQUIRE(pages > 1);
+
+    std::vector<std::vector<bool>> used(pages, std::vector<bool>(page * page, false));
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+        const auto& p = out[i];
+        REQUIRE(p.page < pages);
+        REQUIRE(p.x >= 0);
+        REQUIRE(p.y >= 0);
+        REQUIRE(p.x + sizes[i].w <= page);
+        REQUIRE(p.y + sizes[i].h <= page);
+
+        for (int y = p.y; y < p.y + sizes[i].h; ++y) {
+            for (int x = p.x; x < p.x + sizes[i].w; ++x) {
+                REQUIRE_FALSE(used[p.page][y * page + x]);
+                used[p.page][y * page + x] = true;
+            }
+        }
+    }
+
+    REQUIRE_THROWS_AS(blaze::pack_rects(std::vector<blaze::PackSize>{ { page + 1, 1 } }, page, page, out), std::invalid_argument);
+}
+
+TEST_CASE("blaze::SkylinePacker places rects lowest first", "[Atlas][packer]") {
+    blaze::SkylinePacker packer(32, 32);
+    int x = -1;
+    int y = -1;
+
+    REQUIRE(packer.insert(16, 8, x, y));
+    CHECK((x == 0 && y == 0));
+    REQUIRE(packer.insert(16, 4, x, y));
+    CHECK((x == 16 && y == 0));
+
+    // On top of the shorter rect, which is lower than the taller one.
+    REQUIRE(packer.insert(16, 4, x, y));
+    CHECK((x == 16 && y == 4));
+
+    // The skyline is flat again, so the rest of the page takes one rect.
+    REQUIRE(packer.insert(32, 24, x, y));
+    CHECK((x == 0 && y == 8));
+    CHECK(packer.occupancy() == 1.0f);
+    CHECK_FALSE(packer.insert(1, 1, x, y));
+
+    packer.reset();
+    CHECK(packer.occupancy() == 0.0f);
+    CHECK_FALSE(packer.insert(33, 1, x, y));
+    REQUIRE(packer.insert(32, 32, x, y));
+    CHECK((x == 0 && y == 0));
+}
+
+TEST_CASE("blaze::AtlasBuilder packs, pads and extrudes sprites", "[Atlas][AtlasBuilder]") {
+    blaze::App app;
+    blaze::Window& window = app.createWindow("Builder", 64, 64, "", blaze::WindowMode::Headless);
+
+    blaze::AtlasBuilderOptions options;
+    options.page_width = 64;
+    options.page_height = 64;
+    options.padding = 2;
+    options.extrude = 1;
+
+    struct Input
+    {
+        const char* name;
+        int w;
+        int h;
+    };
+    // Two 40x40 cells cannot share a 64x64 page.
+    const Input inputs[] = { { "wide", 12, 5 }, { "tall", 6, 14 }, { "square", 9, 9 }, { "dot", 1, 1 }, { "big_a", 40, 40 }, { "big_b", 40, 40 } };
+    constexpr uint32_t count = 6;
+    auto seed = [](uint32_t i) { return uint8_t(32 + 32 * i); };
+
+    blaze::AtlasBuilder builder(options);
+    for (uint32_t i = 0; i < count; ++i)
+        builder.add(inputs[i].name, make_sprite(inputs[i].w, inputs[i].h, seed(i)));
+    REQUIRE(builder.size() == count);
+
+    const blaze::Atlas atlas = builder.build(window.getRenderer());
+    REQUIRE(atlas.size() == count);
+    CHECK(atlas.getWidth() == 64.0f);
+    CHECK(atlas.getHeight() == 64.0f);
+
+    SECTION("An input too large to share a page spills onto a second one") {
+        CHECK(atlas.getPageCount() == 2);
+        CHECK(atlas.getPage(atlas.find("big_a")) != atlas.getPage(atlas.find("big_b")));
+    }
+
+    SECTION("Rects keep their size and leave room for the border and padding") {
+        const int border = options.extrude;
+        const float gap = float(2 * border + options.padding);
+        for (uint32_t i = 0; i < count; ++i) {
+            const blaze::SpriteId id{ i };
+            const blaze::Rect& rect = atlas.getRect(id);
+            INFO(inputs[i].name);
+            CHECK(atlas.find(inputs[i].name) == id);
+            CHECK(rect.w == float(inputs[i].w));
+            CHECK(rect.h == float(inputs[i].h));
+            CHECK(rect.left() >= float(border));
+            CHECK(rect.top() >= float(border));
+            CHECK(rect.right() + float(border) <= 64.0f);
+            CHECK(rect.bottom() + float(border) <= 64.0f);
+
+            for (uint32_t j = i + 1; j < count; ++j) {
+                if (atlas.getPage(blaze::SpriteId{ j }) != atlas.getPage(id))
+                    continue;
+                const blaze::Rect& other = atlas.getRect(blaze::SpriteId{ j });
+                INFO(inputs[j].name);
+                CHECK((rect.right() + gap <= other.left() || other.right() + gap <= rect.left()
+                    || rect.bottom() + gap <= other.top() || other.bottom() + gap <= rect.top()));
+            }
+        }
+    }
+
+    SECTION("UVs are the rects over the page size") {
+        for (uint32_t i = 0; i < count; ++i) {
+            const blaze::SpriteId id{ i };
+            const blaze::Rect& rect = atlas.getRect(id);
+            CHECK(atlas.getUV(id) == blaze::Rect(rect.x / 64.0f, rect.y / 64.0f, rect.w / 64.0f, rect.h / 64.0f));
+        }
+    }
+
+    SECTION("Pages hold the sprites with their edges extruded") {
+        uint32_t page = 0;
+        window.onRender([&](blaze::Window&, SDL_Renderer* renderer, double) {
+            for (uint32_t i = 0; i < count; ++i) {
+                if (atlas.getPage(blaze::SpriteId{ i }) != page)
+                    continue;
+                // Copy the page as is, transparent pixels included.
+                SDL_Texture* texture = atlas.getTexture(blaze::SpriteId{ i });
+                SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_NONE);
+                SDL_RenderTexture(renderer, texture, nullptr, nullptr);
+                return;
+            }
+        });
+
+        for (page = 0; page < atlas.getPageCount(); ++page) {
+            app.render(0.0);
+            app.present();
+
+            for (uint32_t i = 0; i < count; ++i) {
+                if (atlas.getPage(blaze::SpriteId{ i }) != page)
+                    continue;
+                const blaze::Rect& rect = atlas.getRect(blaze::SpriteId{ i });
+                const int left = int(rect.x);
+                const int top = int(rect.y);
+                const int w = inputs[i].w;
+                const int h = inputs[i].h;
+
+                // The sprite and its one pixel border, which repeats the nearest edge pixel.
+                int wrong = 0;
+                for (int y = -1; y <= h; ++y) {
+                    for (int x = -1; x <= w; ++x) {
+                        const blaze::Color32 expected = sprite_pixel(seed(i), std::clamp(x, 0, w - 1), std::clamp(y, 0, h - 1));
+                        wrong += window.readPixel(left + x, top + y) != expected;
+                    }
+                }
+
+                // Padding past the border on the right and bottom stays transparent.
+                int painted = 0;
+                for (int y = -1; y <= h + 1; ++y) {
+                    for (int x = -1; x <= w + 1; ++x) {
+                        const bool padding = x == w + 1 || y == h + 1;
+                        if (padding && left + x < 64 && top + y < 64)
+                            painted += window.readPixel(left + x, top + y) != blaze::Color32();
+                    }
+                }
+
+                INFO(inputs[i].name);
+                CHECK(wrong == 0);
+                CHECK(painted == 0);
+            }
+        }
+    }
+
+    SECTION("Images larger than a page are rejected") {
+        blaze::AtlasBuilder small({ 16, 16, 1, 1 });
+        small.add("huge", make_sprite(20, 4, 1));
+        CHECK_THROWS_AS(small.build(window.getRenderer()), std::runtime_error);
+    }
+}
+
+TEST_CASE("blaze::AtlasBuilder adds the sprites of a manifest", "[Atlas][AtlasBuilder]") {
+    blaze::App app;
+    blaze::Window& window = app.createWindow("Builder", 4, 4, "", blaze::WindowMode::Headless);
+
+    const blaze::test::TempDir dir("blaze_atlas_test");
+    std::filesystem::create_directories(dir.path / "sprites");
+    std::filesystem::copy_file(media_dir / "AtlasTest.png", dir.path / "sprites" / "sheet.png");
+
+    SECTION("Paths resolve against the manifest's directory") {
+        std::ofstream(dir.path / "assets.manifest", std::ios::binary)
+            << "sprite | sheet | sprites/sheet.png\n"
+            << "text | notes | notes.txt\n";
+        const blaze::Manifest manifest(dir.path / "assets.manifest");
+        CHECK(manifest.resolvePath(manifest.get("sheet")) == dir.path / "sprites" / "sheet.png");
+
+        blaze::AtlasBuilder builder;
+        builder.addManifest(manifest);
+        REQUIRE(builder.size() == 1);
+
+        const blaze::Atlas atlas = builder.build(window.getRenderer());
+        const blaze::SpriteId sheet = atlas.find("sheet");
+        REQUIRE(sheet);
+        CHECK(atlas.getRect(sheet).w == 128.0f);
+        CHECK(atlas.getRect(sheet).h == 128.0f);
+    }
+
+    SECTION("A missing image is an error") {
+        std::ofstream(dir.path / "assets.manifest", std::ios::binary) << "sprite | gone | sprites/gone.png\n";
+        const blaze::Manifest manifest(dir.path / "assets.manifest");
+
+        blaze::AtlasBuilder builder;
+        CHECK_THROWS_AS(builder.addManifest(manifest), std::runtime_error);
+        CHECK(builder.size() == 0);
+    }
+}
@@ -0,0 +1,161 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <Blaze2D/util/ColorBatch.h>
+
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+using Catch::Matchers::WithinAbs;
+
+namespace {
+
+    std::vector<blaze::Color32> random_colors(std::size_t count, unsigned seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<int> byte(0, 255);
+
+        // Include the extremes so saturation and the alpha = 0 / 255 cases are hit.
+        std::vector<blaze::Color32> colors = {
+            { 0, 0, 0, 0 }, { 255, 255, 255, 255 }, { 255, 0, 128, 0 }, { 1, 254, 127, 128 },
+        };
+        while (colors.size() < count) {
+            colors.emplace_back(static_cast<uint8_t>(byte(rng)), static_cast<uint8_t>(byte(rng)),
+                static_cast<uint8_t>(byte(rng)), static_cast<uint8_t>(byte(rng)));
+        }
+        return colors;
+    }
+
+    bool same_bits(const blaze::Color& a, const blaze::Color& b)
+    {
+        return std::memcmp(&a, &b, sizeof(blaze::Color)) == 0;
+    }
+
+    constexpr blaze::SimdLevel levels[] = {
+        blaze::SimdLevel::Scalar, blaze::SimdLevel::SSE2, blaze::SimdLevel::AVX2, blaze::SimdLevel::NEON
+    };
+
+} // namespace
+
+TEST_CASE("blaze::Color32 conversions round correctly", "[Color]") {
+    CHECK(blaze::to_color32(blaze::Color(1.f, 0.f, 0.5f, 1.f)) == blaze::Color32(255, 0, 128, 255));
+
+    // Truncation would give 127, 254 and 0 here.
+    CHECK(blaze::to_color32(blaze::Color(0.5f, 0.f, 0.f, 0.f)).r == 128);
+    CHECK(blaze::to_color32(blaze::Color(0.999f, 0.f, 0.f, 0.f)).r == 255);
+    CHECK(blaze::to_color32(blaze::Color(0.003f, 0.f, 0.f, 0.f)).r == 1);
+
+    // Below the halfway point both give 127.
+    CHECK(blaze::to_color32(blaze::Color(0.499f, 0.f, 0.f, 0.f)).r == 127);
+
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    CHECK(blaze::to_color32(blaze::Color(-1.f, 2.f, nan, 0.f)) == blaze::Color32(0, 255, 0, 0));
+
+    for (int v = 0; v < 256; ++v) {
+        const blaze::Color32 c(static_cast<uint8_t>(v), 0, 0, static_cast<uint8_t>(255 - v));
+        CHECK(blaze::to_color32(blaze::to_color(c)) == c);
+    }
+}
+
+TEST_CASE("blaze sRGB conversions", "[Color]") {
+    CHECK(blaze::srgb_to_linear(0.f) == 0.f);
+    CHECK_THAT(blaze::srgb_to_linear(1.f), WithinAbs(1.0, 1e-6));
+    CHECK_THAT(blaze::srgb_to_linear(0.5f), WithinAbs(0.214041, 1e-5));
+    CHECK_THAT(blaze::linear_to_srgb(0.214041f), WithinAbs(0.5, 1e-5));
+
+    const blaze::Color linear = blaze::to_linear(blaze::Color(0.5f, 0.02f, 1.f, 0.25f));
+    CHECK_THAT(linear.g, WithinAbs(0.02 / 12.92, 1e-7));
+    CHECK(linear.a == 0.25f);
+
+    for (int v = 0; v <= 100; ++v) {
+        const float x = v / 100.f;
+        CHECK_THAT(blaze::linear_to_srgb(blaze::srgb_to_linear(x)), WithinAbs(x, 1e-5));
+    }
+}
+
+TEST_CASE("blaze::Color32 math", "[Color]") {
+    const blaze::Color32 red(255, 0, 0, 255);
+    const blaze::Color32 blue(0, 0, 255, 255);
+
+    CHECK(blaze::lerp(red, blue, 0.f) == red);
+    CHECK(blaze::lerp(red, blue, 1.f) == blue);
+    CHECK(blaze::lerp(red, blue, 0.5f) == blaze::Color32(127, 0, 128, 255));
+    CHECK(blaze::lerp(red, blue, 7.f) == blue);
+
+    CHECK(blaze::premultiply(blaze::Color32(255, 128, 10, 128)) == blaze::Color32(128, 64, 5, 128));
+    CHECK(blaze::modulate(blaze::Color32(200, 100, 255, 255), blaze::Color32(255, 128, 0, 51)) == blaze::Color32(200, 50, 0, 51));
+
+    // Opaque source replaces, transparent source leaves dst alone.
+    const blaze::Color32 dst(10, 20, 30, 255);
+    CHECK(blaze::blend(red, dst) == red);
+    CHECK(blaze::blend(blaze::Color32(0, 0, 0, 0), dst) == dst);
+    CHECK(blaze::blend(blaze::premultiply(blaze::Color32(255, 255, 255, 128)), blaze::Color32(0, 0, 0, 255))
+        == blaze::Color32(128, 128, 128, 255));
+
+    // Not premultiplied: saturates instead of wrapping.
+    CHECK(blaze::blend(blaze::Color32(255, 255, 255, 0), dst) == blaze::Color32(255, 255, 255, 255));
+}
+
+TEST_CASE("blaze::batch color kernels match the scalar functions on every path", "[Color][ColorBatch]") {
+    const blaze::SimdLevel original = blaze::batch::level();
+
+    // 37 keeps a tail after every block size.
+    const std::vector<blaze::Color32> a = random_colors(37, 1);
+    const std::vector<blaze::Color32> b = random_colors(37, 2);
+
+    std::vector<blaze::Color> floats;
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    floats.emplace_back(-0.5f, 1.5f, nan, 0.5f);
+    floats.emplace_back(0.5f / 255.f, 1.5f / 255.f, 2.5f / 255.f, -0.f);
+    for (const blaze::Color32& c : a)
+        floats.push_back(blaze::Color(c.r / 300.f, c.g / 256.f, c.b / 255.f, c.a / 200.f));
+
+    for (blaze::SimdLevel level : levels) {
+        const blaze::SimdLevel selected = blaze::batch::forceLevel(level);
+        INFO("path " << blaze::batch::levelName(selected));
+
+        std::vector<blaze::Color32> out(floats.size());
+        blaze::batch::pack(floats, out);
+        for (std::size_t i = 0; i < floats.size(); ++i)
+            CHECK(out[i] == blaze::to_color32(floats[i]));
+
+        std::vector<blaze::Color> unpacked(a.size());
+        blaze::batch::unpack(a, unpacked);
+        for (std::size_t i = 0; i < a.size(); ++i)
+            CHECK(same_bits(unpacked[i], blaze::to_color(a[i])));
+
+        blaze::batch::toLinear(a, unpacked);
+        for (std::size_t i = 0; i < a.size(); ++i)
+            CHECK(same_bits(unpacked[i], blaze::to_linear(blaze::to_color(a[i]))));
+
+        for (float t : { 0.f, 0.3f, 0.5f, 1.f }) {
+            blaze::batch::lerp(a, b, t, out);
+            for (std::size_t i = 0; i < a.size(); ++i)
+                CHECK(out[i] == blaze::lerp(a[i], b[i], t));
+        }
+
+        out = a;
+        blaze::batch::premultiply(std::span<blaze::Color32>(out.data(), a.size()));
+        for (std::size_t i = 0; i < a.size(); ++i)
+            CHECK(out[i] == blaze::premultiply(a[i]));
+
+        out = a;
+        blaze::batch::modulate(std::span<blaze::Color32>(out.data(), a.size()), blaze::Color32(200, 100, 50, 128));
+        for (std::size_t i = 0; i < a.size(); ++i)
+            CHECK(out[i] == blaze::modulate(a[i], blaze::Color32(200, 100, 50, 128)));
+
+        out = b;
+        blaze::batch::blend(a, out);
+        for (std::size_t i = 0; i < a.size(); ++i)
+            CHECK(out[i] == blaze::blend(a[i], b[i]));
+    }
+
+    blaze::batch::forceLevel(original);
+}
+
+TEST_CASE("blaze::batch color kernels reject short spans", "[Color][ColorBatch]") {
+    std::vector<blaze::Color32> a(4), b(3);
+    CHECK_THROWS_AS(blaze::batch::lerp(a, b, 0.5f, a), std::invalid_argument);
+    CHECK_THROWS_AS(blaze::batch::blend(a, b), std::invalid_argument);
+}
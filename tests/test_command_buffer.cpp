@@ -0,0 +1,167 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Blaze2D/App.h>
+#include <Blaze2D/graphics/CommandBuffer.h>
+#include <Blaze2D/graphics/SpriteBatch.h>
+
+#include <atomic>
+#include <thread>
+
+namespace {
+
+    const blaze::Color red(1.f, 0.f, 0.f, 1.f);
+    const blaze::Color blue(0.f, 0.f, 1.f, 1.f);
+    const blaze::Color white(1.f, 1.f, 1.f, 1.f);
+
+} // namespace
+
+TEST_CASE("blaze::CommandBuffer records and replays draw commands", "[CommandBuffer]") {
+    blaze::App app;
+    blaze::Window& window = app.createWindow("Commands", 32, 32, "", blaze::WindowMode::Headless);
+    window.setClearColor(red);
+
+    int recorded = 0;
+    window.onRecord([&](blaze::Window&, blaze::CommandBuffer& commands, double) {
+        ++recorded;
+        const blaze::Rect rects[] = { blaze::Rect(0.f, 0.f, 4.f, 4.f), blaze::Rect(8.f, 8.f, 4.f, 4.f) };
+        commands.fillRects(rects, blue);
+        commands.fillRect(blaze::Rect(20.f, 20.f, 2.f, 2.f), white);
+        CHECK(commands.size() == 2);
+    });
+
+    SECTION("Without pipelining render() records and replays at once") {
+        app.render(0.0);
+        CHECK(app.present() == 1);
+        CHECK(recorded == 1);
+
+        CHECK(window.readPixel(1, 1) == blaze::Color32(0, 0, 255, 255));
+        CHECK(window.readPixel(20, 20) == blaze::Color32(255, 255, 255, 255));
+        CHECK(window.readPixel(30, 30) == blaze::Color32(255, 0, 0, 255));
+    }
+
+    SECTION("Reset rewinds without losing the recorded layout") {
+        blaze::CommandBuffer commands;
+        commands.clear(red);
+        commands.fillRect(blaze::Rect(0.f, 0.f, 1.f, 1.f), blue);
+        const std::size_t bytes = commands.bytes();
+        CHECK(commands.size() == 2);
+
+        commands.reset();
+        CHECK(commands.empty());
+        CHECK(commands.bytes() == 0);
+
+        commands.clear(red);
+        commands.fillRect(blaze::Rect(0.f, 0.f, 1.f, 1.f), blue);
+        CHECK(commands.bytes() == bytes);
+        CHECK(commands.replay(window.getRenderer()) == 2);
+    }
+}
+
+TEST_CASE("blaze::CommandBuffer replays stay inside the dirty rect", "[CommandBuffer][DirtyRegion]") {
+    blaze::App app;
+    blaze::Window& window = app.createWindow("Dirty commands", 32, 32, "", blaze::WindowMode::Headless);
+    window.setDirtyTracking(true);
+
+    blaze::Color fill = red;
+    bool clipped = false;
+    window.onRecord([&](blaze::Window&, blaze::CommandBuffer& commands, double) {
+        commands.clear(fill);
+        if (clipped) {
+            commands.setClip(blaze::Rect(0.f, 0.f, 32.f, 32.f));
+            commands.fillRect(blaze::Rect(0.f, 0.f, 32.f, 32.f), fill);
+            commands.resetClip();
+            commands.fillRect(blaze::Rect(0.f, 0.f, 32.f, 32.f), fill);
+        }
+    });
+
+    app.render(0.0);
+    CHECK(app.present() == 1);
+    REQUIRE(window.readPixel(20, 20) == blaze::Color32(255, 0, 0, 255));
+
+    // A clear fills the dirty rect, not the window.
+    fill = blue;
+    window.invalidate(blaze::Rect(8.f, 8.f, 4.f, 4.f));
+    app.render(0.0);
+    CHECK(app.present() == 1);
+
+    CHECK(window.readPixel(8, 8) == blaze::Color32(0, 0, 255, 255));
+    CHECK(window.readPixel(11, 11) == blaze::Color32(0, 0, 255, 255));
+    CHECK(window.readPixel(12, 12) == blaze::Color32(255, 0, 0, 255));
+    CHECK(window.readPixel(7, 8) == blaze::Color32(255, 0, 0, 255));
+    CHECK(window.readPixel(20, 20) == blaze::Color32(255, 0, 0, 255));
+
+    // Recorded clips are intersected with it, and resetting goes back to it.
+    fill = white;
+    clipped = true;
+    window.invalidate(blaze::Rect(20.f, 20.f, 4.f, 4.f));
+    app.render(0.0);
+    CHECK(app.present() == 1);
+
+    CHECK(window.readPixel(20, 20) == blaze::Color32(255, 255, 255, 255));
+    CHECK(window.readPixel(24, 24) == blaze::Color32(255, 0, 0, 255));
+    CHECK(window.readPixel(9, 9) == blaze::Color32(0, 0, 255, 255));
+    CHECK(window.readPixel(0, 0) == blaze::Color32(255, 0, 0, 255));
+}
+
+TEST_CASE("blaze::SpriteBatch records texture runs into a CommandBuffer", "[CommandBuffer][SpriteBatch]") {
+    blaze::SpriteBatch batch;
+    blaze::CommandBuffer commands;
+
+    batch.begin();
+    batch.fill(blaze::Rect(0.f, 0.f, 2.f, 2.f), red);
+    batch.fill(blaze::Rect(4.f, 0.f, 2.f, 2.f), blue, 1);
+    batch.fill(blaze::Rect(8.f, 0.f, 2.f, 2.f), white);
+    CHECK(batch.end(commands) == 1);
+    CHECK(batch.getSpriteCount() == 3);
+    CHECK(commands.size() == 1);
+    CHECK(commands.bytes() >= 12 * sizeof(blaze::Vertex));
+}
+
+TEST_CASE("blaze::App pipelines recording with replay", "[CommandBuffer][App]") {
+    blaze::App app;
+    blaze::Window& window = app.createWindow("Recorded", 16, 16, "", blaze::WindowMode::Headless);
+    blaze::Window& stopper = app.createWindow("Stopper", 1, 1, "", blaze::WindowMode::Headless);
+
+    const std::thread::id mainThread = std::this_thread::get_id();
+    std::atomic<bool> updatedOnWorker = false;
+    window.onUpdate([&](blaze::Window&, double) {
+        updatedOnWorker = std::this_thread::get_id() != mainThread;
+    });
+
+    int recorded = 0;
+    window.onRecord([&](blaze::Window&, blaze::CommandBuffer& commands, double) {
+        ++recorded;
+        commands.fillRect(blaze::Rect(0.f, 0.f, 16.f, 16.f), recorded % 2 ? red : blue);
+    });
+
+    // Render callbacks run on the main thread after the worker is done.
+    int frames = 0;
+    stopper.onRender([&](blaze::Window&, SDL_Renderer*, double) {
+        if (++frames == 5)
+            app.stop();
+    });
+
+    blaze::FrameLoopOptions options;
+    options.update_hz = 1000.0;
+    options.max_fps = 500.0;
+    options.pipelined = true;
+    app.run(options);
+
+    CHECK(frames == 5);
+    CHECK(recorded == 5);
+    CHECK(updatedOnWorker);
+
+    // Replay lags recording by one frame: the fourth recording is on screen.
+    CHECK(window.readPixel(8, 8) == blaze::Color32(0, 0, 255, 255));
+}
+
+TEST_CASE("blaze::App rethrows pipelined update errors on the main thread", "[CommandBuffer][App]") {
+    blaze::App app;
+    blaze::Window& window = app.createWindow("Throws", 4, 4, "", blaze::WindowMode::Headless);
+    window.onRecord([](blaze::Window&, blaze::CommandBuffer&, double) {
+        throw std::runtime_error("record failed");
+    });
+
+    blaze::FrameLoopOptions options;
+    options.pipelined = true;
+    CHECK_THROWS_AS(app.run(options), std::runtime_error);
+}
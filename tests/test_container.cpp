@@ -0,0 +1,165 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Blaze2D/App.h>
+#include <Blaze2D/ui/Container.h>
+
+#include <memory>
+#include <vector>
+
+TEST_CASE("blaze::Container places children by anchor", "[Container]") {
+    blaze::App app;
+    blaze::Window& window = app.createWindow("Layout", 200, 100);
+
+    blaze::Container child(window);
+    child.setSize({ 20.0f, 10.0f });
+
+    SECTION("Center is the default anchor") {
+        window.getRoot().layout();
+        CHECK(child.getRect() == blaze::Rect(90.0f, 45.0f, 20.0f, 10.0f));
+    }
+
+    SECTION("Offsets point into the parent") {
+        child.setAnchor(blaze::BOTTOM_RIGHT);
+        child.setOffset({ 5.0f, 5.0f });
+        window.getRoot().layout();
+        CHECK(child.getRect() == blaze::Rect(175.0f, 85.0f, 20.0f, 10.0f));
+    }
+
+    SECTION("Zero size fills the content area") {
+        window.getRoot().setPadding(10.0f);
+        child.setAnchor(blaze::TOP_LEFT);
+        child.setSize({ 0.0f, 10.0f });
+        window.getRoot().layout();
+        CHECK(child.getRect() == blaze::Rect(10.0f, 10.0f, 180.0f, 10.0f));
+    }
+
+    SECTION("Explicit rects are left alone") {
+        child.setRect(blaze::Rect(3.0f, 4.0f, 5.0f, 6.0f));
+        window.getRoot().layout();
+        CHECK(child.getAnchor() == blaze::OVERRIDE);
+        CHECK(child.getRect() == blaze::Rect(3.0f, 4.0f, 5.0f, 6.0f));
+    }
+}
+
+TEST_CASE("blaze::Container flows children in rows and columns", "[Container]") {
+    blaze::App app;
+    blaze::Window& window = app.createWindow("Layout", 200, 100);
+
+    blaze::Container bar(window);
+    bar.setAnchor(blaze::TOP_LEFT);
+    bar.setSize({ 0.0f, 40.0f });
+    bar.setDirection(blaze::LayoutDirection::Row);
+    bar.setPadding(5.0f);
+    bar.setGap(10.0f);
+
+    blaze::Container fixed(bar);
+    fixed.setSize({ 30.0f, 0.0f });
+    blaze::Container growA(bar);
+    growA.setGrow(1.0f);
+    blaze::Container growB(bar);
+    growB.setGrow(3.0f);
+    growB.setSize({ 0.0f, 10.0f });
+    growB.setAnchor(blaze::BOTTOM_CENTER);
+
+    window.getRoot().layout();
+
+    // 190 content - 30 fixed - 2 gaps = 140 free, split 1:3.
+    CHECK(fixed.getRect() == blaze::Rect(5.0f, 5.0f, 30.0f, 30.0f));
+    CHECK(growA.getRect() == blaze::Rect(45.0f, 5.0f, 35.0f, 30.0f));
+    CHECK(growB.getRect() == blaze::Rect(90.0f, 25.0f, 105.0f, 10.0f));
+
+    SECTION("Columns use the vertical axis") {
+        bar.setSize({ 50.0f, 0.0f });
+        bar.setDirection(blaze::LayoutDirection::Column);
+        window.getRoot().layout();
+        CHECK(fixed.getRect().y == 5.0f);
+        CHECK(fixed.getRect().w == 30.0f);
+        CHECK(growB.getRect().bottom() == 95.0f);
+    }
+}
+
+TEST_CASE("blaze::Container relayout only visits dirty subtrees", "[Container]") {
+    blaze::App app;
+    blaze::Window& window = app.createWindow("Layout", 400, 400);
+
+    // Ten panels with ten items each.
+    std::vector<std::unique_ptr<blaze::Container>> nodes;
+    std::vector<blaze::Container*> panels;
+    for (int p = 0; p < 10; ++p) {
+        auto* panel = nodes.emplace_back(std::make_unique<blaze::Container>(window)).get();
+        panel->setSize({ 40.0f, 0.0f });
+        panel->setDirection(blaze::LayoutDirection::Column);
+        panels.push_back(panel);
+        for (int i = 0; i < 10; ++i)
+            nodes.emplace_back(std::make_unique<blaze::Container>(*panel))->setSize({ 0.0f, 20.0f });
+    }
+
+    blaze::Container& root = window.getRoot();
+    CHECK(root.layout() == 110);
+    CHECK_FALSE(root.needsLayout());
+    CHECK(root.layout() == 0);
+
+    SECTION("A leaf change re-arranges only its siblings") {
+        (*panels[3]->getChildren().begin())->setSize({ 0.0f, 30.0f });
+        CHECK(root.needsLayout());
+        CHECK(root.layout() == 10);
+    }
+
+    SECTION("Moving a panel does not touch its items") {
+        panels[3]->setOffset({ 1.0f, 0.0f });
+        CHECK(root.layout() == 10);
+    }
+
+    SECTION("Resizing a panel re-arranges it and its items") {
+        panels[3]->setSize({ 50.0f, 0.0f });
+        CHECK(root.layout() == 20);
+    }
+
+    SECTION("Window resizes relayout everything that depends on the size") {
+        window.getRoot().setRect(blaze::Rect(0.0f, 0.0f, 500.0f, 500.0f));
+        CHECK(root.layout() == 110);
+    }
+}
+
+TEST_CASE("blaze::Container keeps storage in depth-first order", "[Container]") {
+    blaze::App app;
+    blaze::Window& window = app.createWindow("Layout", 100, 100);
+
+    // Built out of order: children are added to 'a' after 'b' exists.
+    blaze::Container a(window, blaze::Rect(0.0f, 0.0f, 50.0f, 50.0f));
+    blaze::Container b(window, blaze::Rect(50.0f, 0.0f, 50.0f, 50.0f));
+    blaze::Container a1(a, blaze::Rect(10.0f, 10.0f, 10.0f, 10.0f));
+    auto a2 = std::make_unique<blaze::Container>(a, blaze::Rect(30.0f, 30.0f, 10.0f, 10.0f));
+    blaze::Container b1(b, blaze::Rect(0.0f, 0.0f, 50.0f, 50.0f));
+
+    window.getRoot().layout();
+
+    std::vector<blaze::Container*> children;
+    for (blaze::Container* child : a.getChildren())
+        children.push_back(child);
+    CHECK(children == std::vector<blaze::Container*>{ &a1, a2.get() });
+
+    CHECK(b1.getWindowRect() == blaze::Rect(50.0f, 0.0f, 50.0f, 50.0f));
+    CHECK(window.getRoot().hitTest({ 35.0f, 35.0f }) == a2.get());
+    CHECK(window.getRoot().hitTest({ 75.0f, 25.0f }) == &b1);
+
+    SECTION("Culling skips subtrees outside the area") {
+        std::vector<blaze::Container*> visible;
+        window.getRoot().cull(blaze::Rect(0.0f, 0.0f, 25.0f, 25.0f), visible);
+        CHECK(visible == std::vector<blaze::Container*>{ &window.getRoot(), &a, &a1 });
+    }
+
+    SECTION("Destroyed containers drop out of traversals") {
+        a2.reset();
+        CHECK(window.getRoot().hitTest({ 35.0f, 35.0f }) == &a);
+        children.clear();
+        for (blaze::Container* child : a.getChildren())
+            children.push_back(child);
+        CHECK(children == std::vector<blaze::Container*>{ &a1 });
+    }
+
+    SECTION("Moving a parent moves the window rects of its subtree") {
+        b.setRect(blaze::Rect(40.0f, 40.0f, 50.0f, 50.0f));
+        window.getRoot().layout();
+        CHECK(b1.getWindowRect() == blaze::Rect(40.0f, 40.0f, 50.0f, 50.0f));
+    }
+}
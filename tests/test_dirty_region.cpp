@@ -0,0 +1,111 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Blaze2D/App.h>
+#include <Blaze2D/util/DirtyRegion.h>
+
+#include <vector>
+
+TEST_CASE("blaze::DirtyRegion merges and caps rects", "[DirtyRegion]") {
+    blaze::DirtyRegion region(blaze::Rect(0.0f, 0.0f, 1000.0f, 1000.0f), 3);
+    CHECK(region.empty());
+
+    SECTION("Rects are clipped to the bounds") {
+        region.add(blaze::Rect(-10.0f, -10.0f, 20.0f, 20.0f));
+        REQUIRE(region.getRects().size() == 1);
+        CHECK(region.getRects()[0] == blaze::Rect(0.0f, 0.0f, 10.0f, 10.0f));
+
+        region.add(blaze::Rect(2000.0f, 0.0f, 10.0f, 10.0f));
+        CHECK(region.getRects().size() == 1);
+    }
+
+    SECTION("Overlapping and adjacent rects merge, distant ones do not") {
+        region.add(blaze::Rect(0.0f, 0.0f, 10.0f, 10.0f));
+        region.add(blaze::Rect(5.0f, 5.0f, 10.0f, 10.0f));
+        region.add(blaze::Rect(15.0f, 0.0f, 5.0f, 15.0f));
+        REQUIRE(region.getRects().size() == 1);
+        CHECK(region.getRects()[0] == blaze::Rect(0.0f, 0.0f, 20.0f, 15.0f));
+
+        region.add(blaze::Rect(500.0f, 500.0f, 10.0f, 10.0f));
+        CHECK(region.getRects().size() == 2);
+
+        // Already covered.
+        region.add(blaze::Rect(1.0f, 1.0f, 2.0f, 2.0f));
+        CHECK(region.getRects().size() == 2);
+    }
+
+    SECTION("Going over the cap merges the cheapest pair") {
+        region.add(blaze::Rect(0.0f, 0.0f, 10.0f, 10.0f));
+        region.add(blaze::Rect(900.0f, 0.0f, 10.0f, 10.0f));
+        region.add(blaze::Rect(0.0f, 900.0f, 10.0f, 10.0f));
+        region.add(blaze::Rect(930.0f, 0.0f, 10.0f, 10.0f));
+
+        auto rects = region.getRects();
+        REQUIRE(rects.size() == 3);
+        for (std::size_t a = 0; a < rects.size(); ++a) {
+            for (std::size_t b = a + 1; b < rects.size(); ++b)
+                CHECK_FALSE(rects[a].intersects(rects[b]));
+        }
+        CHECK(region.area() == 100.0f + 100.0f + 400.0f);
+    }
+
+    SECTION("Covering most of the bounds marks everything dirty") {
+        region.add(blaze::Rect(0.0f, 0.0f, 1000.0f, 800.0f));
+        CHECK(region.isFull());
+        REQUIRE(region.getRects().size() == 1);
+        CHECK(region.getRects()[0] == region.getBounds());
+
+        region.clear();
+        CHECK(region.empty());
+        CHECK_FALSE(region.isFull());
+    }
+}
+
+TEST_CASE("blaze::Window repaints only dirty rects when tracking is on", "[DirtyRegion][Window]") {
+    blaze::App app;
+    blaze::Window& window = app.createWindow("Dirty", 400, 300);
+
+    std::vector<blaze::Rect> painted;
+    window.onRender([&](blaze::Window& w, SDL_Renderer*, double) {
+        painted.push_back(w.getPaintRect());
+    });
+
+    SECTION("Without tracking every frame repaints the whole window") {
+        window.render(0.0);
+        window.render(0.0);
+        CHECK(painted.size() == 2);
+        CHECK(window.present());
+    }
+
+    SECTION("With tracking clean frames are skipped") {
+        window.setDirtyTracking(true);
+
+        window.render(0.0);
+        REQUIRE(painted.size() == 1);
+        CHECK(painted[0] == blaze::Rect(0.0f, 0.0f, 400.0f, 300.0f));
+        CHECK(window.present());
+
+        painted.clear();
+        window.render(0.0);
+        CHECK(painted.empty());
+        CHECK_FALSE(window.present());
+
+        // Clip rects are rounded out to whole pixels.
+        window.invalidate(blaze::Rect(10.5f, 10.5f, 20.0f, 20.0f));
+        window.invalidate(blaze::Rect(300.0f, 200.0f, 10.0f, 10.0f));
+        window.render(0.0);
+        CHECK(painted.size() == 2);
+        CHECK(painted[0] == blaze::Rect(10.0f, 10.0f, 21.0f, 21.0f));
+        CHECK(window.present());
+    }
+
+    SECTION("Container changes invalidate their area") {
+        window.setDirtyTracking(true);
+        blaze::Container panel(window, blaze::Rect(50.0f, 50.0f, 100.0f, 40.0f));
+        window.render(0.0);
+        painted.clear();
+
+        panel.setVisible(false);
+        window.render(0.0);
+        REQUIRE(painted.size() == 1);
+        CHECK(painted[0] == blaze::Rect(50.0f, 50.0f, 100.0f, 40.0f));
+    }
+}
@@ -0,0 +1,363 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Blaze2D/App.h>
+#include <Blaze2D/graphics/SpriteBatch.h>
+#include <Blaze2D/ui/Container.h>
+#include <Blaze2D/util/FrameArena.h>
+#include <Blaze2D/util/Manifest.h>
+#include <Blaze2D/util/Profiler.h>
+#include <Blaze2D/util/SpatialIndex.h>
+
+#include <SDL3/SDL.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <thread>
+#include <vector>
+
+/*
+    Counts global operator new calls (aligned ones included) and every
+    allocation SDL makes through SDL_malloc, so the steady-state test below
+    can assert that whole frames stay off the heap.
+*/
+namespace {
+    std::atomic<std::size_t> heap_allocations{ 0 };
+    std::atomic<std::size_t> sdl_allocations{ 0 };
+
+    SDL_malloc_func sdl_malloc = nullptr;
+    SDL_calloc_func sdl_calloc = nullptr;
+    SDL_realloc_func sdl_realloc = nullptr;
+    SDL_free_func sdl_free = nullptr;
+
+    void* SDLCALL counting_malloc(std::size_t size)
+    {
+        sdl_allocations.fetch_add(1, std::memory_order_relaxed);
+        return sdl_malloc(size);
+    }
+
+    void* SDLCALL counting_calloc(std::size_t count, std::size_t size)
+    {
+        sdl_allocations.fetch_add(1, std::memory_order_relaxed);
+        return sdl_calloc(count, size);
+    }
+
+    void* SDLCALL counting_realloc(void* p, std::size_t size)
+    {
+        sdl_allocations.fetch_add(1, std::memory_order_relaxed);
+        return sdl_realloc(p, size);
+    }
+
+    // SDL's allocator may only be swapped before SDL allocates anything, so do it during static initialization.
+    const bool sdl_counting = [] {
+        SDL_GetOriginalMemoryFunctions(&sdl_malloc, &sdl_calloc, &sdl_realloc, &sdl_free);
+        return SDL_SetMemoryFunctions(counting_malloc, counting_calloc, counting_realloc, sdl_free);
+    }();
+
+    void* aligned_malloc(std::size_t size, std::size_t alignment)
+    {
+        size = (size + alignment - 1) / alignment * alignment;
+#ifdef _WIN32
+        return _aligned_malloc(size ? size : alignment, alignment);
+#else
+        return std::aligned_alloc(alignment, size ? size : alignment);
+#endif
+    }
+
+    void aligned_free(void* p)
+    {
+#ifdef _WIN32
+        _aligned_free(p);
+#else
+        std::free(p);
+#endif
+    }
+}
+
+void* operator new(std::size_t size)
+{
+    heap_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return ::operator new(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    heap_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = aligned_malloc(size, static_cast<std::size_t>(alignment)))
+        return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return ::operator new(size, alignment);
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::align_val_t) noexcept
+{
+    aligned_free(p);
+}
+
+void operator delete[](void* p, std::align_val_t) noexcept
+{
+    aligned_free(p);
+}
+
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept
+{
+    aligned_free(p);
+}
+
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept
+{
+    aligned_free(p);
+}
+
+TEST_CASE("blaze::FrameArena bumps, rewinds and resets", "[FrameArena]") {
+    blaze::FrameArena arena(1024);
+    CHECK(arena.capacity() == 0);
+
+    void* a = arena.allocate(10, 1);
+    void* b = arena.allocate(16, 16);
+    CHECK(arena.capacity() == 1024);
+    CHECK(reinterpret_cast<std::uintptr_t>(b) % 16 == 0);
+    CHECK(static_cast<std::byte*>(b) > static_cast<std::byte*>(a));
+    const std::size_t used = arena.used();
+    CHECK(used >= 26);
+
+    SECTION("Scopes release what was allocated inside them") {
+        {
+            blaze::FrameArena::Scope scope(arena);
+            std::pmr::vector<int> values(&scope.arena());
+            for (int i = 0; i < 100; ++i)
+                values.push_back(i);
+            CHECK(arena.used() > used);
+        }
+        CHECK(arena.used() == used);
+        CHECK(arena.allocate(8, 8) != nullptr);
+    }
+
+    SECTION("reset() ends the frame and keeps its peak") {
+        CHECK(arena.allocate(100, 8) != nullptr);
+        const std::size_t peak = arena.getPeak();
+        arena.reset();
+        CHECK(arena.used() == 0);
+        CHECK(arena.getFramePeak() == peak);
+        CHECK(arena.getHighWater() == peak);
+
+        arena.reset();
+        CHECK(arena.getFramePeak() == 0);
+        CHECK(arena.getHighWater() == peak);
+    }
+
+    SECTION("Overflow is folded into one block for the next frame") {
+        CHECK(arena.allocate(3000, 8) != nullptr);
+        CHECK(arena.getUpstreamAllocations() == 2);
+
+        arena.reset();
+        CHECK(arena.capacity() >= 3026);
+        const std::size_t upstream = arena.getUpstreamAllocations();
+
+        for (int frame = 0; frame < 3; ++frame) {
+            CHECK(arena.allocate(10, 1) != nullptr);
+            CHECK(arena.allocate(16, 16) != nullptr);
+            CHECK(arena.allocate(3000, 8) != nullptr);
+            arena.reset();
+        }
+        CHECK(arena.getUpstreamAllocations() == upstream);
+    }
+
+    SECTION("A spike's block shrinks back after quiet frames") {
+        CHECK(arena.allocate(50000, 8) != nullptr);
+        arena.reset();
+        CHECK(arena.capacity() >= 50000);
+
+        for (std::size_t frame = 1; frame < blaze::FrameArena::shrink_after; ++frame) {
+            CHECK(arena.allocate(100, 8) != nullptr);
+            arena.reset();
+        }
+        CHECK(arena.capacity() >= 50000);
+
+        CHECK(arena.allocate(100, 8) != nullptr);
+        arena.reset();
+        CHECK(arena.capacity() == 0);
+
+        CHECK(arena.allocate(100, 8) != nullptr);
+        CHECK(arena.capacity() == 1024);
+    }
+
+    SECTION("Arenas only compare equal to themselves") {
+        blaze::FrameArena other;
+        CHECK(arena.is_equal(arena));
+        CHECK_FALSE(arena.is_equal(other));
+    }
+}
+
+TEST_CASE("blaze::FrameArena::local() is per thread", "[FrameArena]") {
+    blaze::FrameArena* mine = &blaze::FrameArena::local();
+    blaze::FrameArena* theirs = nullptr;
+    std::thread([&] { theirs = &blaze::FrameArena::local(); }).join();
+
+    CHECK(mine == &blaze::FrameArena::local());
+    CHECK(mine != theirs);
+}
+
+TEST_CASE("Container tree rebuilds use the frame arena", "[FrameArena][Container]") {
+    blaze::App app;
+    blaze::Window& window = app.createWindow("Rebuild", 200, 100, "", blaze::WindowMode::Headless);
+    blaze::FrameArena& arena = blaze::FrameArena::local();
+    arena.reset();
+
+    std::vector<std::unique_ptr<blaze::Container>> children;
+    for (int i = 0; i < 16; ++i)
+        children.push_back(std::make_unique<blaze::Container>(window.getRoot()));
+    // Not at the end of the depth-first order, so the next layout re-sorts.
+    children.push_back(std::make_unique<blaze::Container>(*children.front()));
+
+    window.getRoot().layout();
+    CHECK(arena.getPeak() >= 17 * sizeof(uint32_t));
+    CHECK(arena.used() == 0);
+}
+
+TEST_CASE("Manifest loads leave the frame arena alone", "[FrameArena][Manifest]") {
+    const auto path = std::filesystem::temp_directory_path() / "blaze_arena_manifest.manifest";
+    {
+        std::ofstream ofs(path, std::ios::binary);
+        for (int i = 0; i < 20000; ++i)
+            ofs << "sprite | asset_" << i << " | images/asset_" << i << ".png | frames=4\n";
+    }
+
+    blaze::FrameArena& arena = blaze::FrameArena::local();
+    arena.reset();
+    const std::size_t capacity = arena.capacity();
+    {
+        blaze::Manifest manifest(path);
+        CHECK(manifest.getAll().size() == 20000);
+    }
+    CHECK(arena.getPeak() == 0);
+    CHECK(arena.capacity() == capacity);
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Steady-state frames do not touch the heap", "[FrameArena][App]") {
+    REQUIRE(sdl_counting);
+    blaze::App app;
+    blaze::Window& window = app.createWindow("Steady", 128, 128, "", blaze::WindowMode::Headless);
+
+    std::vector<std::unique_ptr<blaze::Container>> cells;
+    window.getRoot().setDirection(blaze::LayoutDirection::Row);
+    for (int i = 0; i < 8; ++i) {
+        cells.push_back(std::make_unique<blaze::Container>(window.getRoot()));
+        cells.back()->setSize({ 10.0f, 10.0f });
+    }
+
+    blaze::SpatialGrid grid(16.0f);
+    for (uint32_t i = 0; i < 32; ++i)
+        grid.insert(blaze::Rect(float(i % 8) * 12.0f, float(i / 8) * 12.0f, 14.0f, 14.0f), i);
+    std::vector<blaze::SpatialPair> pairs;
+    pairs.reserve(1024);
+
+    int ticks = 0;
+    window.onUpdate([&](blaze::Window& w, double) {
+        ++ticks;
+        // Relayout every tick and look for overlaps, as a game would.
+        cells[ticks % cells.size()]->setSize({ 10.0f + float(ticks % 3), 10.0f });
+        pairs.clear();
+        grid.queryPairs(pairs);
+        w.invalidate();
+    });
+
+    blaze::SpriteBatch batch(256);
+    window.onRecord([&](blaze::Window&, blaze::CommandBuffer& commands, double) {
+        batch.begin();
+        for (const blaze::SpatialPair& pair : pairs)
+            batch.fill(grid.getBounds(pair.a), blaze::Color(1.f, 0.f, 0.f, 1.f));
+        batch.end(commands);
+    });
+
+    /*
+        Render callbacks run on the main thread once the frame's updates
+        (and, pipelined, its recording) are done. Frames up to 'warmup'
+        size every buffer; the ones after must not allocate.
+    */
+    constexpr int warmup = 10;
+    constexpr int measured = 30;
+    blaze::Window& probe = app.createWindow("Probe", 1, 1, "", blaze::WindowMode::Headless);
+    int frames = 0;
+    std::size_t before = 0;
+    std::size_t sdl_before = 0;
+    std::size_t allocations = 0;
+    std::size_t sdl_allocation_count = 0;
+    probe.onRender([&](blaze::Window&, SDL_Renderer*, double) {
+        ++frames;
+        if (frames == warmup) {
+            before = heap_allocations.load();
+            sdl_before = sdl_allocations.load();
+        }
+        if (frames == warmup + measured) {
+            allocations = heap_allocations.load() - before;
+            sdl_allocation_count = sdl_allocations.load() - sdl_before;
+            app.stop();
+        }
+    });
+
+    blaze::FrameLoopOptions options;
+    options.update_hz = 1000.0;
+    options.max_fps = 1000.0;
+
+#if BLAZE2D_PROFILE
+    // Captured zones are kept on the heap; that is the profiler's cost, not the frame's.
+    blaze::Profiler::shared().setEnabled(false);
+    struct Reenable { ~Reenable() { blaze::Profiler::shared().setEnabled(true); } } reenable;
+#endif
+
+    SECTION("Single-threaded") {
+        app.run(options);
+        CHECK(frames == warmup + measured);
+        CHECK(ticks > 0);
+        CHECK(allocations == 0);
+        CHECK(sdl_allocation_count == 0);
+        CHECK(app.getFrameStats().arena_peak_bytes > 0);
+    }
+
+    SECTION("Pipelined") {
+        options.pipelined = true;
+        app.run(options);
+        CHECK(frames == warmup + measured);
+        CHECK(ticks > 0);
+        CHECK(allocations == 0);
+        CHECK(sdl_allocation_count == 0);
+    }
+}
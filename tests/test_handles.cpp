@@ -0,0 +1,162 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Blaze2D/App.h>
+#include <Blaze2D/ui/Container.h>
+#include <Blaze2D/util/SlotMap.h>
+
+#include <SDL3/SDL.h>
+
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+TEST_CASE("blaze::SlotMap stores values densely behind generational handles", "[SlotMap]") {
+    blaze::SlotMap<std::string> map;
+
+    const auto a = map.insert("a");
+    const auto b = map.insert("b");
+    const auto c = map.insert("c");
+    REQUIRE(map.size() == 3);
+    CHECK(*map.get(a) == "a");
+    CHECK(*map.get(c) == "c");
+
+    SECTION("Erasing keeps the rest contiguous and reachable") {
+        CHECK(map.erase(a));
+        CHECK(map.size() == 2);
+        CHECK(map.get(a) == nullptr);
+        CHECK(*map.get(b) == "b");
+        CHECK(*map.get(c) == "c");
+        CHECK(&*map.begin() == map.data());
+        CHECK(std::size_t(map.end() - map.begin()) == map.size());
+
+        CHECK_FALSE(map.erase(a));
+    }
+
+    SECTION("Reused slots do not revive stale handles") {
+        map.erase(b);
+        const auto d = map.insert("d");
+        CHECK(d.index == b.index);
+        CHECK(d.generation != b.generation);
+        CHECK(map.get(b) == nullptr);
+        CHECK(*map.get(d) == "d");
+    }
+
+    SECTION("Null and foreign handles refer to nothing") {
+        CHECK(map.get({}) == nullptr);
+        CHECK_FALSE(map.contains({ 100, 1 }));
+        CHECK_FALSE(blaze::Handle<std::string>{});
+    }
+
+    SECTION("handleAt() follows storage order") {
+        for (std::size_t i = 0; i < map.size(); ++i)
+            CHECK(map.get(map.handleAt(i)) == map.data() + i);
+    }
+
+    SECTION("clear() invalidates everything") {
+        map.clear();
+        CHECK(map.empty());
+        CHECK(map.get(a) == nullptr);
+        CHECK(map.get(c) == nullptr);
+    }
+
+    SECTION("Handles hash") {
+        std::unordered_set<blaze::Handle<std::string>> set{ a, b, c };
+        CHECK(set.size() == 3);
+        CHECK(set.count(b) == 1);
+    }
+}
+
+TEST_CASE("blaze::App hands out window handles that detect removal", "[App][Window][SlotMap]") {
+    blaze::App app;
+    blaze::Window& popup = app.createWindow("Popup", 10, 10, "", blaze::WindowMode::Headless);
+    const blaze::WindowHandle handle = popup.getHandle();
+
+    REQUIRE(handle);
+    CHECK(app.getWindow(handle) == &popup);
+    CHECK(app.findWindow("Popup") == handle);
+    CHECK_FALSE(app.findWindow("Missing"));
+
+    CHECK(app.removeWindow(handle));
+    CHECK(app.getWindow(handle) == nullptr);
+    CHECK_FALSE(app.removeWindow(handle));
+    CHECK_THROWS_AS(app.getWindow("Popup"), std::runtime_error);
+
+    // Transient windows reuse the slot without reviving old handles.
+    blaze::Window& next = app.createWindow("Popup", 10, 10, "", blaze::WindowMode::Headless);
+    CHECK(next.getHandle().index == handle.index);
+    CHECK(app.getWindow(handle) == nullptr);
+    CHECK(&app.getWindow("Popup") == &next);
+}
+
+TEST_CASE("blaze::App keeps name lookups right under churn", "[App][Window][SlotMap]") {
+    blaze::App app;
+    std::vector<blaze::WindowHandle> handles;
+    for (int i = 0; i < 8; ++i)
+        handles.push_back(app.createWindow("W" + std::to_string(i), 4, 4, "", blaze::WindowMode::Headless).getHandle());
+
+    // Removal moves the last window into the gap.
+    app.removeWindow(handles[2]);
+    app.removeWindow(handles[5]);
+    CHECK(app.getWindowCount() == 6);
+    for (int i = 0; i < 8; ++i) {
+        blaze::Window* window = app.getWindow(handles[i]);
+        if (i == 2 || i == 5) {
+            CHECK(window == nullptr);
+            continue;
+        }
+        REQUIRE(window);
+        CHECK(window->getName() == "W" + std::to_string(i));
+        CHECK(&app.getWindow(window->getName()) == window);
+    }
+
+    SECTION("A shared name passes to the next window that has it") {
+        blaze::Window& first = app.createWindow("Shared", 4, 4, "", blaze::WindowMode::Headless);
+        blaze::Window& second = app.createWindow("Shared", 4, 4, "", blaze::WindowMode::Headless);
+        CHECK(&app.getWindow("Shared") == &first);
+
+        app.removeWindow(second);
+        CHECK(&app.getWindow("Shared") == &first);
+
+        blaze::Window& third = app.createWindow("Shared", 4, 4, "", blaze::WindowMode::Headless);
+        app.removeWindow(first);
+        CHECK(&app.getWindow("Shared") == &third);
+    }
+}
+
+TEST_CASE("blaze::Container handles go stale when the container is destroyed", "[Container][SlotMap]") {
+    blaze::App app;
+    blaze::Window& window = app.createWindow("Widgets", 100, 100, "", blaze::WindowMode::Headless);
+
+    auto widget = std::make_unique<blaze::Container>(window);
+    const blaze::ContainerHandle handle = widget->getHandle();
+    CHECK(window.getContainer(handle) == widget.get());
+    CHECK(window.getContainer(window.getRoot().getHandle()) == &window.getRoot());
+
+    widget.reset();
+    CHECK(window.getContainer(handle) == nullptr);
+
+    // The id is reused; the old handle still refers to nothing.
+    blaze::Container reused(window);
+    CHECK(reused.getHandle().index == handle.index);
+    CHECK(window.getContainer(handle) == nullptr);
+    CHECK(window.getContainer(reused.getHandle()) == &reused);
+    CHECK(window.getContainer({}) == nullptr);
+}
+
+TEST_CASE("blaze::Window owns textures behind handles", "[Window][SlotMap]") {
+    blaze::App app;
+    blaze::Window& window = app.createWindow("Textures", 16, 16, "", blaze::WindowMode::Headless);
+
+    SDL_Surface* surface = SDL_CreateSurface(4, 4, SDL_PIXELFORMAT_RGBA32);
+    REQUIRE(surface);
+    const blaze::TextureHandle texture = window.createTexture(surface);
+    SDL_DestroySurface(surface);
+
+    CHECK(window.getTexture(texture) != nullptr);
+    CHECK(window.getTextureCount() == 1);
+
+    CHECK(window.destroyTexture(texture));
+    CHECK(window.getTexture(texture) == nullptr);
+    CHECK_FALSE(window.destroyTexture(texture));
+    CHECK(window.getTextureCount() == 0);
+}
@@ -0,0 +1,196 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Blaze2D/assets/AssetCache.h>
+#include <Blaze2D/assets/HotReloader.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#include "test_support.h"
+
+namespace {
+
+    void write_file(const std::filesystem::path& path, const std::string& contents)
+    {
+        std::ofstream(path, std::ios::binary) << contents;
+    }
+
+    // Polls until something is reported; inotify is immediate, mtime polling is throttled.
+    template <typename Poll>
+    auto poll_until(Poll poll)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(3);
+        for (;;) {
+            auto result = poll();
+            if (!result.empty() || std::chrono::steady_clock::now() > deadline)
+                return result;
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+    }
+
+} // namespace
+
+TEST_CASE("blaze::AssetLoader swaps manifests by name", "[AssetLoader][HotReload]") {
+    const blaze::test::TempDir dir("blaze_reload_test");
+    write_file(dir / "a.txt", "a");
+    write_file(dir / "b.txt", "b");
+    write_file(dir / "c.txt", "c");
+    write_file(dir / "c2.txt", "c2");
+    write_file(dir / "assets.manifest", "text | a | a.txt\ntext | b | b.txt\ntext | c | c.txt\n");
+
+    blaze::Manifest manifest(dir / "assets.manifest", false);
+    blaze::AssetLoader loader(manifest, nullptr, { .threads = 2, .map_files = false });
+
+    blaze::AssetHandle a = loader.load("a");
+    blaze::AssetHandle b = loader.load("b");
+    blaze::AssetHandle c = loader.load("c");
+    loader.waitAll();
+    CHECK(c.getVersion() == 1);
+
+    // 'a' removed, 'c' moved to another file, 'd' added, order changed.
+    write_file(dir / "assets.manifest", "text | d | a.txt\ntext | c | c2.txt\ntext | b | b.txt\n");
+    const blaze::ManifestDiff diff = loader.setManifest(blaze::Manifest(dir / "assets.manifest", false));
+    const blaze::Manifest& next = loader.getManifest();
+
+    REQUIRE(diff.added.size() == 1);
+    CHECK(next.get(diff.added[0]).name == "d");
+    REQUIRE(diff.changed.size() == 1);
+    CHECK(next.get(diff.changed[0]).name == "c");
+    CHECK(diff.removed == std::vector<std::string>{ "a" });
+    CHECK(diff.unchanged == 1);
+    CHECK(loader.getManifestGeneration() == 1);
+
+    CHECK_FALSE(a.getId());
+    CHECK(a.getData() == "a");
+    CHECK(b.getId() == next.find("b"));
+    CHECK(c.getId() == next.find("c"));
+
+    // Old contents stay visible until the reload is applied.
+    CHECK(c.getData() == "c");
+    loader.waitAll();
+    CHECK(c.getData() == "c2");
+    CHECK(c.getVersion() == 2);
+    CHECK(b.getVersion() == 1);
+    CHECK(loader.getReloadCount() == 1);
+
+    // Live assets are shared under their new ids.
+    CHECK(loader.load("b") == b);
+}
+
+TEST_CASE("blaze::AssetLoader reloads live assets in place", "[AssetLoader][HotReload]") {
+    const blaze::test::TempDir dir("blaze_reload_test");
+    write_file(dir / "a.txt", "first");
+    write_file(dir / "b.txt", "b");
+    write_file(dir / "assets.manifest", "text | a | a.txt\ntext | b | b.txt\n");
+
+    blaze::Manifest manifest(dir / "assets.manifest", false);
+    blaze::AssetLoader loader(manifest, nullptr, { .threads = 2, .map_files = false });
+
+    blaze::AssetHandle a = loader.load("a");
+    loader.waitAll();
+    REQUIRE(a.getData() == "first");
+
+    write_file(dir / "a.txt", "second version");
+    CHECK(loader.reload(a.getId()));
+    CHECK_FALSE(loader.reload(manifest.find("b"))); // Not loaded
+    loader.waitAll();
+    CHECK(a.ready());
+    CHECK(a.getData() == "second version");
+    CHECK(a.getVersion() == 2);
+
+    SECTION("A failed reload keeps the old contents") {
+        std::filesystem::remove(dir / "a.txt");
+        CHECK(loader.reload(a.getId()));
+        loader.waitAll();
+        CHECK(a.ready());
+        CHECK(a.getData() == "second version");
+        CHECK(a.getVersion() == 2);
+    }
+
+    SECTION("The cache accounts for the new size") {
+        blaze::AssetCache cache(loader);
+        cache.get("a");
+        cache.update();
+        CHECK(cache.getStats().bytes_resident == 14);
+
+        write_file(dir / "a.txt", "x");
+        loader.reload(a.getId());
+        loader.waitAll();
+        cache.update();
+        CHECK(cache.getStats().bytes_resident == 1);
+    }
+}
+
+TEST_CASE("blaze::FileWatcher reports rewritten files", "[HotReload]") {
+    const blaze::test::TempDir dir("blaze_reload_test");
+    write_file(dir / "watched.txt", "1");
+    write_file(dir / "other.txt", "1");
+
+    blaze::FileWatcher watcher;
+    watcher.watch(dir / "watched.txt");
+    watcher.watch(dir / "." / "watched.txt"); // Same file
+    CHECK(watcher.getWatchCount() == 1);
+    CHECK(watcher.poll().empty());
+
+    // Make sure a polled mtime differs even on coarse file systems.
+    if (!watcher.isNative())
+        std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+
+    write_file(dir / "other.txt", "2");
+    write_file(dir / "watched.txt", "2");
+
+    std::vector<std::filesystem::path> changed;
+    changed = poll_until([&] {
+        auto files = watcher.poll();
+        return std::vector<std::filesystem::path>(files.begin(), files.end());
+    });
+    REQUIRE(changed.size() == 1);
+    CHECK(changed[0] == blaze::FileWatcher::normalize(dir / "watched.txt"));
+
+    watcher.unwatch(dir / "watched.txt");
+    CHECK(watcher.getWatchCount() == 0);
+    write_file(dir / "watched.txt", "3");
+    CHECK(watcher.poll().empty());
+}
+
+TEST_CASE("blaze::HotReloader follows manifest and asset edits", "[AssetLoader][HotReload]") {
+    const blaze::test::TempDir dir("blaze_reload_test");
+    write_file(dir / "a.txt", "a");
+    write_file(dir / "b.txt", "b");
+    write_file(dir / "assets.manifest", "text | a | a.txt\n");
+
+    blaze::Manifest manifest(dir / "assets.manifest", false);
+    blaze::AssetLoader loader(manifest, nullptr, { .threads = 2, .map_files = false });
+    blaze::HotReloader reloader(loader);
+    if (!reloader.getWatcher().isNative())
+        std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+
+    blaze::AssetHandle a = loader.load("a");
+    loader.waitAll();
+
+    write_file(dir / "a.txt", "edited");
+    std::size_t handled = 0;
+    poll_until([&] { handled = reloader.update(); return std::string(handled, '.'); });
+    CHECK(handled == 1);
+    loader.waitAll();
+    CHECK(a.getData() == "edited");
+
+    write_file(dir / "assets.manifest", "text | a | a.txt\ntext | b | b.txt\n");
+    poll_until([&] { handled = reloader.update(); return std::string(handled, '.'); });
+    CHECK(handled == 1);
+    CHECK(reloader.getManifestReloadCount() == 1);
+    CHECK(reloader.getLastDiff().unchanged == 1);
+    CHECK(loader.getManifest().find("b"));
+    CHECK(a.getId() == loader.getManifest().find("a"));
+
+    // The new asset's file is watched too.
+    blaze::AssetHandle b = loader.load("b");
+    loader.waitAll();
+    write_file(dir / "b.txt", "b2");
+    poll_until([&] { handled = reloader.update(); return std::string(handled, '.'); });
+    CHECK(handled == 1);
+    loader.waitAll();
+    CHECK(b.getData() == "b2");
+}
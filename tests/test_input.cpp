@@ -0,0 +1,170 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Blaze2D/App.h>
+#include <Blaze2D/input/EventRouter.h>
+#include <Blaze2D/ui/Container.h>
+
+#include <SDL3/SDL.h>
+
+#include <string>
+
+namespace {
+
+    SDL_Event user_event(int32_t code)
+    {
+        SDL_Event event{};
+        event.type = SDL_EVENT_USER;
+        event.user.code = code;
+        return event;
+    }
+
+    SDL_Event mouse_down(const blaze::Window& window, float x, float y)
+    {
+        SDL_Event event{};
+        event.type = SDL_EVENT_MOUSE_BUTTON_DOWN;
+        event.button.windowID = window.getId();
+        event.button.x = x;
+        event.button.y = y;
+        return event;
+    }
+
+} // namespace
+
+TEST_CASE("blaze::EventRing keeps the newest events", "[input]") {
+    blaze::EventRing ring(3);
+    CHECK(ring.capacity() == 4);
+
+    for (int i = 0; i < 6; ++i)
+        ring.push(user_event(i));
+
+    CHECK(ring.size() == 4);
+    CHECK(ring.getDropped() == 2);
+    CHECK(ring[0].user.code == 2);
+
+    auto events = ring.linearize();
+    REQUIRE(events.size() == 4);
+    for (int i = 0; i < 4; ++i)
+        CHECK(events[i].user.code == i + 2);
+
+    ring.clear();
+    CHECK(ring.empty());
+    CHECK(ring.linearize().empty());
+}
+
+TEST_CASE("blaze::EventRing never drops quit or close requests", "[input]") {
+    SDL_Event quit{};
+    quit.type = SDL_EVENT_QUIT;
+
+    auto close = [](uint32_t windowId) {
+        SDL_Event event{};
+        event.type = SDL_EVENT_WINDOW_CLOSE_REQUESTED;
+        event.window.windowID = windowId;
+        return event;
+    };
+
+    SECTION("Other events are dropped around them") {
+        blaze::EventRing ring(4);
+        ring.push(quit);
+        ring.push(close(7));
+        for (int i = 0; i < 6; ++i)
+            ring.push(user_event(i));
+
+        auto events = ring.linearize();
+        REQUIRE(events.size() == 4);
+        CHECK(events[0].type == SDL_EVENT_QUIT);
+        CHECK(events[1].window.windowID == 7);
+        CHECK(events[2].user.code == 4);
+        CHECK(events[3].user.code == 5);
+        CHECK(ring.getDropped() == 4);
+    }
+
+    SECTION("A ring of critical events drops newcomers and repeats, and grows for new requests") {
+        blaze::EventRing ring(2);
+        ring.push(quit);
+        ring.push(close(1));
+
+        ring.push(user_event(0));
+        ring.push(quit);
+        ring.push(close(1));
+        CHECK(ring.size() == 2);
+        CHECK(ring.getDropped() == 3);
+
+        ring.push(close(2));
+        CHECK(ring.capacity() == 4);
+        REQUIRE(ring.size() == 3);
+        CHECK(ring[0].type == SDL_EVENT_QUIT);
+        CHECK(ring[2].window.windowID == 2);
+    }
+}
+
+TEST_CASE("blaze::EventRouter propagates through capture, target and bubble", "[input][Window]") {
+    blaze::App app;
+    blaze::Window& window = app.createWindow("Input", 200, 200);
+    blaze::EventRouter& router = app.getEventRouter();
+
+    REQUIRE(router.findWindow(window.getId()) == &window);
+
+    blaze::Container panel(window, blaze::Rect(50.0f, 50.0f, 100.0f, 100.0f));
+    blaze::Container button(panel, blaze::Rect(10.0f, 10.0f, 20.0f, 20.0f));
+
+    std::string trace;
+    auto record = [&](const char* name, blaze::EventResult result = blaze::EventResult::Ignored) {
+        return [&trace, name, result](blaze::Container&, const SDL_Event&, blaze::EventPhase phase) {
+            trace += name;
+            trace += phase == blaze::EventPhase::Capture ? "c " : phase == blaze::EventPhase::Target ? "t " : "b ";
+            return result;
+        };
+    };
+
+    window.getRoot().onEvent(record("root"));
+    panel.onEvent(record("panel"));
+    button.onEvent(record("button"));
+
+    SECTION("Pointer events target the deepest container under the pointer") {
+        CHECK_FALSE(router.dispatch(mouse_down(window, 65.0f, 65.0f)));
+        CHECK(trace == "rootc panelc buttont panelb rootb ");
+    }
+
+    SECTION("Points outside children target their parent") {
+        CHECK_FALSE(router.dispatch(mouse_down(window, 140.0f, 140.0f)));
+        CHECK(trace == "rootc panelt rootb ");
+    }
+
+    SECTION("Consuming stops propagation") {
+        panel.onEvent(record("panel", blaze::EventResult::Consumed));
+        CHECK(router.dispatch(mouse_down(window, 65.0f, 65.0f)));
+        CHECK(trace == "rootc panelc ");
+    }
+
+    SECTION("Pointer capture overrides hit testing until release") {
+        button.capturePointer();
+        CHECK_FALSE(router.dispatch(mouse_down(window, 5.0f, 5.0f)));
+        CHECK(trace == "rootc panelc buttont panelb rootb ");
+
+        SDL_Event up = mouse_down(window, 5.0f, 5.0f);
+        up.type = SDL_EVENT_MOUSE_BUTTON_UP;
+        router.dispatch(up);
+        CHECK_FALSE(button.hasPointerCapture());
+    }
+
+    SECTION("Hidden containers are skipped by hit testing") {
+        button.setVisible(false);
+        router.dispatch(mouse_down(window, 65.0f, 65.0f));
+        CHECK(trace == "rootc panelt rootb ");
+    }
+
+    SECTION("Keyboard events target the focused container") {
+        button.focus();
+        SDL_Event key{};
+        key.type = SDL_EVENT_KEY_DOWN;
+        key.key.windowID = window.getId();
+        router.dispatch(key);
+        CHECK(trace == "rootc panelc buttont panelb rootb ");
+    }
+
+    SECTION("Events for unknown windows are not routed") {
+        SDL_Event event = mouse_down(window, 65.0f, 65.0f);
+        event.button.windowID = window.getId() + 1000;
+        CHECK_FALSE(router.dispatch(event));
+        CHECK(trace.empty());
+    }
+}
@@ -1,4 +1,5 @@
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
 #include <Blaze2D/util/Manifest.h>
 
 #include <filesystem>
@@ -69,6 +70,19 @@ sprite | enemy | assets/enemy.png | SPEED = 10
     REQUIRE(foundHero);
     REQUIRE(foundEnemy);
 
+    // getByType views hold the actual descriptors, in manifest order
+    REQUIRE(sprites[0].name == "hero");
+    REQUIRE(sprites[1].name == "enemy");
+    REQUIRE(sprites[0].flags.at("KEY") == "VALUE");
+    REQUIRE(sprites[1].flags.at("SPEED") == "10");
+
+    auto audio = manifest.getByType("audio");
+    REQUIRE(audio.size() == 1);
+    REQUIRE(audio[0].name == "music");
+    REQUIRE(&manifest.get("music") == &audio[0]);
+
+    REQUIRE(manifest.getByType("font").empty());
+
     std::filesystem::remove(path);
 }
 
@@ -107,4 +121,130 @@ invalid_line_without_pipes
     REQUIRE_THROWS_AS(blaze::Manifest(path), std::runtime_error);
 
     std::filesystem::remove(path);
-}
\ No newline at end of file
+}
+TEST_CASE("Manifest interns type names and flag keys", "[manifest]")
+{
+    const std::string manifestContents =
+        "sprite | a | a.png | FILTER = linear\r\n"
+        "sprite | b | b.png | FILTER=nearest | PRELOAD |\r\n";
+
+    auto path = write_temp_manifest(manifestContents);
+    REQUIRE(std::filesystem::exists(path));
+
+    {
+        blaze::Manifest manifest(path);
+
+        const auto& a = manifest.get("a");
+        const auto& b = manifest.get("b");
+
+        // Interned strings share storage
+        REQUIRE(a.type.data() == b.type.data());
+        REQUIRE(a.flags.begin()->key.data() == b.flags.begin()->key.data());
+
+        // Views are trimmed, including carriage returns
+        REQUIRE(a.path == "a.png");
+        REQUIRE(a.flags.at("FILTER") == "linear");
+        REQUIRE(b.flags.size() == 2);
+        REQUIRE(b.flags.at("FILTER") == "nearest");
+        REQUIRE(b.flags.at("PRELOAD") == "true");
+        REQUIRE_FALSE(b.flags.contains("SPEED"));
+        REQUIRE_THROWS_AS(b.flags.at("SPEED"), std::out_of_range);
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Compiled manifest round-trips through writeCompiled", "[manifest]")
+{
+    const std::string manifestContents = R"(
+sprite | hero | assets/hero.png | FLAG | KEY = VALUE
+audio | music | assets/music.mp3 | STREAM
+sprite | enemy | assets/enemy.png | SPEED = 10 | KEY = VALUE
+font | ui | assets/ui.fnt
+)";
+
+    auto textPath = write_temp_manifest(manifestContents);
+    auto compiledPath = textPath;
+    compiledPath.replace_extension(".blzm");
+
+    {
+        blaze::Manifest text(textPath);
+        bool embedNameHash = GENERATE(true, false);
+        text.writeCompiled(compiledPath, embedNameHash);
+
+        blaze::Manifest compiled(compiledPath);
+
+        REQUIRE(compiled.getAll().size() == text.getAll().size());
+
+        for (const auto& expected : text.getAll()) {
+            const auto& actual = compiled.get(expected.name);
+            REQUIRE(actual.id == expected.id);
+            REQUIRE(actual.type == expected.type);
+            REQUIRE(actual.type.data() == expected.type.data()); // Still interned
+            REQUIRE(actual.path == expected.path);
+            REQUIRE(actual.flags.size() == expected.flags.size());
+            for (const auto& flag : expected.flags) {
+                REQUIRE(actual.flags.at(flag.key) == flag.value);
+            }
+        }
+
+        auto sprites = compiled.getByType("sprite");
+        REQUIRE(sprites.size() == 2);
+        REQUIRE(sprites[0].name == "hero");
+        REQUIRE(sprites[1].name == "enemy");
+        REQUIRE(compiled.getByType("font").size() == 1);
+        REQUIRE_THROWS_AS(compiled.get("does_not_exist"), std::out_of_range);
+    }
+
+    std::filesystem::remove(textPath);
+    std::filesystem::remove(compiledPath);
+}
+
+TEST_CASE("Compiled manifest rejects truncated files", "[manifest]")
+{
+    auto textPath = write_temp_manifest("sprite | hero | assets/hero.png | FLAG\n");
+    auto compiledPath = textPath;
+    compiledPath.replace_extension(".blzm");
+
+    blaze::Manifest(textPath).writeCompiled(compiledPath);
+    std::filesystem::resize_file(compiledPath, std::filesystem::file_size(compiledPath) - 8);
+
+    REQUIRE_THROWS_AS(blaze::Manifest(compiledPath), std::runtime_error);
+
+    std::filesystem::remove(textPath);
+    std::filesystem::remove(compiledPath);
+}
+
+TEST_CASE("Manifest resolves names and ids without std::string", "[manifest]")
+{
+    std::string manifestContents;
+    for (int i = 0; i < 500; ++i) {
+        manifestContents += (i % 3 ? "sprite" : "audio");
+        manifestContents += " | asset_" + std::to_string(i) + " | a.png\n";
+    }
+
+    auto path = write_temp_manifest(manifestContents);
+
+    {
+        blaze::Manifest manifest(path);
+
+        // Every name maps to the descriptor at its id
+        for (const auto& asset : manifest.getAll()) {
+            blaze::AssetId id = manifest.find(asset.name);
+            REQUIRE(id == asset.id);
+            REQUIRE(&manifest.get(id) == &asset);
+        }
+
+        const char* cname = "asset_42";
+        std::string_view vname = "asset_42";
+        REQUIRE(manifest.get(cname).name == "asset_42");
+        REQUIRE(&manifest.get(vname) == &manifest.get(cname));
+
+        REQUIRE_FALSE(manifest.find("asset_500"));
+        REQUIRE_FALSE(manifest.find(""));
+        REQUIRE_THROWS_AS(manifest.get(blaze::AssetId{}), std::out_of_range);
+        REQUIRE_THROWS_AS(manifest.get(blaze::AssetId{ 500 }), std::out_of_range);
+    }
+
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,99 @@
+#undef BLAZE2D_PROFILE
+#define BLAZE2D_PROFILE 1
+
+#include <catch2/catch_test_macros.hpp>
+#include <Blaze2D/util/Profiler.h>
+#include <Blaze2D/graphics/FrameTimeGraph.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST_CASE("blaze::Profiler collects zones from every thread", "[Profiler]") {
+    blaze::Profiler profiler;
+
+    {
+        blaze::ProfileZone outer("outer", profiler);
+        blaze::ProfileZone inner("inner", profiler);
+    }
+    profiler.setThreadName("main");
+
+    std::thread worker([&] {
+        profiler.setThreadName("worker");
+        for (int i = 0; i < 3; ++i)
+            blaze::ProfileZone zone("work", profiler);
+    });
+    worker.join();
+
+    CHECK(profiler.collect() == 5);
+    CHECK(profiler.collect() == 0);
+
+    std::span<const blaze::ProfileEvent> events = profiler.getEvents();
+    REQUIRE(events.size() == 5);
+
+    // Zones are recorded when they end, so inner comes first.
+    CHECK(std::string(events[0].name) == "inner");
+    CHECK(std::string(events[1].name) == "outer");
+    CHECK(events[1].start_ns <= events[0].start_ns);
+    CHECK(events[1].end_ns >= events[0].end_ns);
+    CHECK(events[0].thread != events[2].thread);
+
+    const std::string trace = profiler.toChromeTrace();
+    CHECK(trace.find("\"traceEvents\"") != std::string::npos);
+    CHECK(trace.find("{\"name\":\"outer\",\"ph\":\"X\"") != std::string::npos);
+    CHECK(trace.find("\"args\":{\"name\":\"worker\"}") != std::string::npos);
+
+    profiler.clear();
+    CHECK(profiler.getEvents().empty());
+}
+
+TEST_CASE("blaze::Profiler drops zones instead of blocking", "[Profiler]") {
+    blaze::Profiler profiler;
+
+    SECTION("Disabled profilers record nothing") {
+        profiler.setEnabled(false);
+        { blaze::ProfileZone zone("skipped", profiler); }
+        CHECK(profiler.collect() == 0);
+    }
+
+    SECTION("Full thread buffers count the overflow") {
+        for (std::size_t i = 0; i < blaze::Profiler::buffer_capacity + 10; ++i)
+            profiler.record("zone", i, i + 1);
+        CHECK(profiler.getDroppedCount() == 10);
+        CHECK(profiler.collect() == blaze::Profiler::buffer_capacity);
+    }
+
+    SECTION("The capture limit caps collected zones") {
+        profiler.setCaptureLimit(4);
+        for (int i = 0; i < 6; ++i)
+            profiler.record("zone", i, i + 1);
+        CHECK(profiler.collect() == 4);
+        CHECK(profiler.getDroppedCount() == 2);
+    }
+}
+
+TEST_CASE("BLAZE_PROFILE_SCOPE records into the shared profiler", "[Profiler]") {
+    blaze::Profiler& profiler = blaze::Profiler::shared();
+    profiler.collect();
+    profiler.clear();
+
+    {
+        BLAZE_PROFILE_SCOPE("macro zone");
+        BLAZE_PROFILE_SCOPE("second zone on the same scope");
+    }
+    profiler.collect();
+    REQUIRE(profiler.getEvents().size() == 2);
+    CHECK(std::string(profiler.getEvents()[1].name) == "macro zone");
+    profiler.clear();
+}
+
+TEST_CASE("blaze::FrameTimeGraph keeps the most recent frames", "[Profiler]") {
+    blaze::FrameTimeGraph graph(4, 16.0);
+    CHECK(graph.getAverage() == 0.0);
+
+    for (double ms : { 100.0, 10.0, 12.0, 14.0, 20.0 })
+        graph.push(ms);
+    CHECK(graph.size() == 4);
+    CHECK(graph.getMax() == 20.0);
+    CHECK(graph.getAverage() == 14.0);
+}
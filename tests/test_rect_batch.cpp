@@ -0,0 +1,111 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Blaze2D/util/RectBatch.h>
+
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace {
+
+    // Random rects plus the awkward cases: touching edges, zero and negative
+    // sizes, signed zeros and NaNs.
+    std::vector<blaze::Rect> sample_rects(std::size_t count)
+    {
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<float> pos(-50.0f, 150.0f);
+        std::uniform_real_distribution<float> size(-10.0f, 80.0f);
+
+        const float nan = std::numeric_limits<float>::quiet_NaN();
+        std::vector<blaze::Rect> rects = {
+            { 0.0f, 0.0f, 100.0f, 100.0f },
+            { 100.0f, 0.0f, 10.0f, 10.0f },
+            { -0.0f, -0.0f, -0.0f, 0.0f },
+            { 0.0f, 0.0f, 0.0f, 0.0f },
+            { 10.0f, 10.0f, -5.0f, -5.0f },
+            { nan, 0.0f, 10.0f, 10.0f },
+            { 0.0f, 0.0f, nan, 10.0f },
+        };
+        while (rects.size() < count)
+            rects.push_back({ pos(rng), pos(rng), size(rng), size(rng) });
+        return rects;
+    }
+
+    bool same_bits(const blaze::Rect& a, const blaze::Rect& b)
+    {
+        return std::memcmp(&a, &b, sizeof(blaze::Rect)) == 0;
+    }
+
+    constexpr blaze::SimdLevel levels[] = {
+        blaze::SimdLevel::Scalar, blaze::SimdLevel::SSE2, blaze::SimdLevel::AVX2, blaze::SimdLevel::NEON
+    };
+
+} // namespace
+
+TEST_CASE("blaze::batch matches the scalar Rect methods on every path", "[RectBatch]") {
+    const blaze::SimdLevel original = blaze::batch::level();
+
+    // 37 keeps a tail after every block size.
+    const std::vector<blaze::Rect> rects = sample_rects(37);
+    const std::vector<blaze::Rect> probes = {
+        { 20.0f, 20.0f, 40.0f, 40.0f },
+        { 100.0f, 0.0f, 0.0f, 10.0f },
+        { -0.0f, 0.0f, 10.0f, -0.0f },
+        { std::numeric_limits<float>::quiet_NaN(), 0.0f, 1.0f, 1.0f },
+    };
+
+    for (blaze::SimdLevel level : levels) {
+        const blaze::SimdLevel selected = blaze::batch::forceLevel(level);
+        INFO("path " << blaze::batch::levelName(selected));
+
+        for (const blaze::Rect& probe : probes) {
+            std::vector<uint8_t> mask(rects.size());
+            std::vector<blaze::Rect> out(rects.size());
+
+            std::size_t hits = blaze::batch::intersects(rects, probe, mask);
+            std::size_t expected = 0;
+            for (std::size_t i = 0; i < rects.size(); ++i) {
+                CHECK(mask[i] == rects[i].intersects(probe));
+                expected += rects[i].intersects(probe);
+            }
+            CHECK(hits == expected);
+
+            blaze::batch::contains(rects, probe, mask);
+            for (std::size_t i = 0; i < rects.size(); ++i)
+                CHECK(mask[i] == rects[i].contains(probe));
+
+            const blaze::Vec2 point = probe.position();
+            blaze::batch::contains(rects, point, mask);
+            for (std::size_t i = 0; i < rects.size(); ++i)
+                CHECK(mask[i] == rects[i].contains(point));
+
+            std::vector<blaze::Vec2> points;
+            for (const blaze::Rect& r : rects)
+                points.push_back(r.position());
+            blaze::batch::pointsInRect(probe, points, mask);
+            for (std::size_t i = 0; i < points.size(); ++i)
+                CHECK(mask[i] == probe.contains(points[i]));
+
+            blaze::batch::intersection(rects, probe, out);
+            for (std::size_t i = 0; i < rects.size(); ++i)
+                CHECK(same_bits(out[i], rects[i].intersection(probe)));
+
+            blaze::batch::united(rects, probe, out);
+            for (std::size_t i = 0; i < rects.size(); ++i)
+                CHECK(same_bits(out[i], rects[i].united(probe)));
+
+            out = rects;
+            blaze::batch::translate(std::span<blaze::Rect>(out), point);
+            for (std::size_t i = 0; i < rects.size(); ++i)
+                CHECK(same_bits(out[i], rects[i].translated(point)));
+        }
+    }
+
+    blaze::batch::forceLevel(original);
+}
+
+TEST_CASE("blaze::batch rejects short outputs", "[RectBatch]") {
+    std::vector<blaze::Rect> rects(4);
+    std::vector<uint8_t> mask(3);
+    CHECK_THROWS_AS(blaze::batch::intersects(rects, blaze::Rect(), mask), std::invalid_argument);
+}
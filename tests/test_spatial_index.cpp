@@ -0,0 +1,163 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Blaze2D/util/SpatialIndex.h>
+
+#include <algorithm>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+    struct Scene
+    {
+        std::vector<blaze::Rect> bounds; // Indexed by value
+        std::vector<bool> alive;
+    };
+
+    blaze::Rect random_rect(std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> pos(0.0f, 1000.0f);
+        std::uniform_real_distribution<float> size(1.0f, 40.0f);
+        std::uniform_int_distribution<int> pick(0, 49);
+
+        // A few objects much larger than a grid cell.
+        const float scale = pick(rng) == 0 ? 30.0f : 1.0f;
+        return blaze::Rect(pos(rng), pos(rng), size(rng) * scale, size(rng));
+    }
+
+    std::vector<uint32_t> brute_query(const Scene& scene, const blaze::Rect& area)
+    {
+        std::vector<uint32_t> out;
+        for (uint32_t i = 0; i < scene.bounds.size(); ++i) {
+            if (scene.alive[i] && scene.bounds[i].intersects(area))
+                out.push_back(i);
+        }
+        return out;
+    }
+
+    std::vector<uint32_t> brute_point(const Scene& scene, const blaze::Vec2& point)
+    {
+        std::vector<uint32_t> out;
+        for (uint32_t i = 0; i < scene.bounds.size(); ++i) {
+            if (scene.alive[i] && scene.bounds[i].contains(point))
+                out.push_back(i);
+        }
+        return out;
+    }
+
+    std::vector<blaze::SpatialPair> brute_pairs(const Scene& scene)
+    {
+        std::vector<blaze::SpatialPair> out;
+        for (uint32_t i = 0; i < scene.bounds.size(); ++i) {
+            for (uint32_t j = i + 1; j < scene.bounds.size(); ++j) {
+                if (scene.alive[i] && scene.alive[j] && scene.bounds[i].intersects(scene.bounds[j]))
+                    out.push_back({ i, j });
+            }
+        }
+        return out;
+    }
+
+    template <typename T>
+    std::vector<T> sorted(std::vector<T> v)
+    {
+        std::sort(v.begin(), v.end(), [](const T& a, const T& b) {
+            if constexpr (std::is_same_v<T, blaze::SpatialPair>)
+                return a.a != b.a ? a.a < b.a : a.b < b.b;
+            else
+                return a < b;
+        });
+        return v;
+    }
+
+    // Pairs are reported by proxy order; normalize to value order.
+    std::vector<blaze::SpatialPair> normalized(std::vector<blaze::SpatialPair> pairs)
+    {
+        for (auto& pair : pairs) {
+            if (pair.a > pair.b)
+                std::swap(pair.a, pair.b);
+        }
+        return sorted(std::move(pairs));
+    }
+
+    // Inserts, moves and removes objects, checking every query against brute force.
+    template <typename Index, typename Move>
+    void exercise(Index& index, Move&& move)
+    {
+        std::mt19937 rng(42);
+        Scene scene;
+        std::vector<uint32_t> proxies;
+
+        for (uint32_t i = 0; i < 400; ++i) {
+            scene.bounds.push_back(random_rect(rng));
+            scene.alive.push_back(true);
+            proxies.push_back(index.insert(scene.bounds[i], i));
+        }
+
+        auto check = [&] {
+            std::uniform_real_distribution<float> pos(-50.0f, 1050.0f);
+            std::vector<uint32_t> found;
+            for (int q = 0; q < 50; ++q) {
+                const blaze::Rect area(pos(rng), pos(rng), 120.0f, 80.0f);
+                found.clear();
+                index.query(area, found);
+                CHECK(sorted(found) == brute_query(scene, area));
+
+                const blaze::Vec2 point(pos(rng), pos(rng));
+                found.clear();
+                index.queryPoint(point, found);
+                CHECK(sorted(found) == brute_point(scene, point));
+            }
+
+            std::vector<blaze::SpatialPair> pairs;
+            index.queryPairs(pairs);
+            CHECK(normalized(pairs) == brute_pairs(scene));
+        };
+
+        check();
+
+        std::uniform_real_distribution<float> step(-30.0f, 30.0f);
+        for (uint32_t i = 0; i < 400; i += 2) {
+            blaze::Rect& r = scene.bounds[i];
+            const blaze::Vec2 delta(step(rng), step(rng));
+            r = r.translated(delta);
+            move(index, proxies[i], r, delta);
+        }
+        for (uint32_t i = 1; i < 400; i += 7) {
+            index.remove(proxies[i]);
+            scene.alive[i] = false;
+        }
+
+        CHECK(index.size() == 400 - 57);
+        check();
+    }
+
+} // namespace
+
+TEST_CASE("blaze::AabbTree answers queries like brute force", "[SpatialIndex]") {
+    blaze::AabbTree tree(2.0f);
+    exercise(tree, [](blaze::AabbTree& t, uint32_t proxy, const blaze::Rect& r, const blaze::Vec2& d) {
+        t.move(proxy, r, d);
+    });
+
+    // AVL balancing keeps a few hundred leaves shallow.
+    CHECK(tree.height() <= 20);
+}
+
+TEST_CASE("blaze::SpatialGrid answers queries like brute force", "[SpatialIndex]") {
+    blaze::SpatialGrid grid(32.0f);
+    exercise(grid, [](blaze::SpatialGrid& g, uint32_t proxy, const blaze::Rect& r, const blaze::Vec2&) {
+        g.move(proxy, r);
+    });
+}
+
+TEST_CASE("blaze::AabbTree keeps leaves that stay inside their fat box", "[SpatialIndex]") {
+    blaze::AabbTree tree(4.0f);
+    uint32_t proxy = tree.insert(blaze::Rect(0.0f, 0.0f, 10.0f, 10.0f), 7);
+
+    CHECK_FALSE(tree.move(proxy, blaze::Rect(2.0f, 2.0f, 10.0f, 10.0f)));
+    CHECK(tree.move(proxy, blaze::Rect(20.0f, 0.0f, 10.0f, 10.0f), { 10.0f, 0.0f }));
+
+    // The fat box leans into the predicted motion.
+    CHECK(tree.getFatBounds(proxy) == blaze::Rect(16.0f, -4.0f, 28.0f, 18.0f));
+    CHECK(tree.getValue(proxy) == 7);
+}
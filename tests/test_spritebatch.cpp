@@ -0,0 +1,86 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Blaze2D/graphics/SpriteBatch.h>
+
+#include <SDL3/SDL.h>
+
+#include "test_support.h"
+
+TEST_CASE("blaze::SpriteBatch merges sprites into one call per texture run", "[SpriteBatch]") {
+    blaze::test::SoftwareTarget target;
+    REQUIRE(target.renderer != nullptr);
+
+    SDL_Texture* a = target.whiteTexture();
+    SDL_Texture* b = target.whiteTexture();
+    REQUIRE(a != nullptr);
+    REQUIRE(b != nullptr);
+
+    blaze::SpriteBatch batch;
+
+    SECTION("Interleaved textures are grouped when sorting by texture") {
+        batch.begin();
+        for (int i = 0; i < 10; ++i)
+            batch.draw(i % 2 ? a : b, blaze::Rect(float(i), 0.0f, 4.0f, 4.0f));
+
+        CHECK(batch.end(target.renderer) == 2);
+        CHECK(batch.getSpriteCount() == 10);
+    }
+
+    SECTION("Submission order only merges neighbours") {
+        batch.begin(blaze::SpriteSortMode::Submission);
+        batch.draw(a, blaze::Rect(0.0f, 0.0f, 4.0f, 4.0f));
+        batch.draw(a, blaze::Rect(4.0f, 0.0f, 4.0f, 4.0f));
+        batch.draw(b, blaze::Rect(8.0f, 0.0f, 4.0f, 4.0f));
+        batch.draw(a, blaze::Rect(12.0f, 0.0f, 4.0f, 4.0f));
+
+        CHECK(batch.end(target.renderer) == 3);
+    }
+
+    SECTION("Layers split runs of the same texture") {
+        batch.begin();
+        batch.draw(a, blaze::Rect(0.0f, 0.0f, 4.0f, 4.0f), blaze::Color(1.f, 1.f, 1.f), 0);
+        batch.draw(b, blaze::Rect(0.0f, 0.0f, 4.0f, 4.0f), blaze::Color(1.f, 1.f, 1.f), 1);
+        batch.draw(a, blaze::Rect(0.0f, 0.0f, 4.0f, 4.0f), blaze::Color(1.f, 1.f, 1.f), 2);
+
+        CHECK(batch.end(target.renderer) == 3);
+    }
+
+    SECTION("An empty batch makes no calls") {
+        batch.begin();
+        CHECK(batch.end(target.renderer) == 0);
+    }
+
+    SDL_DestroyTexture(a);
+    SDL_DestroyTexture(b);
+}
+
+TEST_CASE("blaze::SpriteBatch draws higher layers on top", "[SpriteBatch]") {
+    blaze::test::SoftwareTarget target;
+    REQUIRE(target.renderer != nullptr);
+
+    SDL_Texture* texture = target.whiteTexture();
+    REQUIRE(texture != nullptr);
+
+    SDL_SetRenderDrawColor(target.renderer, 0, 0, 0, 255);
+    SDL_RenderClear(target.renderer);
+
+    blaze::SpriteBatch batch;
+    batch.begin();
+    // Submitted top layer first; the sort must still draw it last.
+    batch.draw(texture, blaze::Rect(0.0f, 0.0f, 16.0f, 16.0f), blaze::Color(1.f, 0.f, 0.f), 1);
+    batch.draw(texture, blaze::Rect(0.0f, 0.0f, 16.0f, 16.0f), blaze::Color(0.f, 0.f, 1.f), 0);
+    batch.fill(blaze::Rect(32.0f, 32.0f, 8.0f, 8.0f), blaze::Color(0.f, 1.f, 0.f));
+    batch.end(target.renderer);
+
+    SDL_Color covered = target.pixel(8, 8);
+    CHECK(covered.r == 255);
+    CHECK(covered.b == 0);
+
+    SDL_Color filled = target.pixel(36, 36);
+    CHECK(filled.g == 255);
+
+    SDL_Color untouched = target.pixel(24, 24);
+    CHECK(untouched.r == 0);
+    CHECK(untouched.g == 0);
+
+    SDL_DestroyTexture(texture);
+}
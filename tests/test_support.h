@@ -0,0 +1,74 @@
+#pragma once
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <system_error>
+
+#include <SDL3/SDL.h>
+
+namespace blaze::test {
+
+    /*
+        Unique directory in the system temp directory, removed with
+        everything in it when the guard goes out of scope, passed or not.
+        Declare it before anything that keeps files in it open.
+    */
+    struct TempDir
+    {
+        std::filesystem::path path;
+
+        explicit TempDir(const std::string& stem)
+        {
+            using namespace std::chrono;
+            path = std::filesystem::temp_directory_path()
+                / (stem + "_" + std::to_string(duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count()));
+            std::filesystem::create_directories(path);
+        }
+
+        ~TempDir()
+        {
+            std::error_code ignored;
+            std::filesystem::remove_all(path, ignored);
+        }
+
+        TempDir(const TempDir&) = delete;
+        TempDir& operator=(const TempDir&) = delete;
+
+        std::filesystem::path operator/(const std::filesystem::path& name) const { return path / name; }
+    };
+
+    // Software renderer drawing straight into a 64x64 surface; needs no video driver.
+    struct SoftwareTarget
+    {
+        SDL_Surface* surface = SDL_CreateSurface(64, 64, SDL_PIXELFORMAT_RGBA32);
+        SDL_Renderer* renderer = SDL_CreateSoftwareRenderer(surface);
+
+        ~SoftwareTarget()
+        {
+            SDL_DestroyRenderer(renderer);
+            SDL_DestroySurface(surface);
+        }
+
+        SoftwareTarget() = default;
+        SoftwareTarget(const SoftwareTarget&) = delete;
+        SoftwareTarget& operator=(const SoftwareTarget&) = delete;
+
+        SDL_Texture* whiteTexture()
+        {
+            SDL_Surface* image = SDL_CreateSurface(8, 8, SDL_PIXELFORMAT_RGBA32);
+            SDL_FillSurfaceRect(image, nullptr, SDL_MapSurfaceRGBA(image, 255, 255, 255, 255));
+            SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, image);
+            SDL_DestroySurface(image);
+            return texture;
+        }
+
+        SDL_Color pixel(int x, int y)
+        {
+            SDL_FlushRenderer(renderer);
+            SDL_Color c{};
+            SDL_ReadSurfacePixel(surface, x, y, &c.r, &c.g, &c.b, &c.a);
+            return c;
+        }
+    };
+
+} // namespace blaze::test
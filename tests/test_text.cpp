@@ -0,0 +1,423 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Blaze2D/App.h>
+#include <Blaze2D/graphics/Font.h>
+#include <Blaze2D/graphics/GlyphCache.h>
+#include <Blaze2D/graphics/SpriteBatch.h>
+#include <Blaze2D/graphics/TextRenderer.h>
+
+#include <SDL3/SDL.h>
+
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "test_support.h"
+
+static const std::filesystem::path media_dir = BLAZE_TEST_MEDIA_DIR;
+
+namespace {
+
+    /*
+        'A' and 'B' are 8x10 with kerning between them, '?' is the
+        fallback and 'a' to 'z' share one cell so the cache has many
+        glyphs to hold.
+    */
+    std::string test_font_description()
+    {
+        std::string fnt =
+            "info face=\"Test Sans\" size=-12 bold=0 padding=0,0,0,0\n"
+            "common lineHeight=12 base=10 scaleW=64 scaleH=64 pages=1\n"
+            "page id=0 file=\"test_0.png\"\n"
+            "chars count=30\n"
+            "char id=32 x=0 y=0 width=0 height=0 xoffset=0 yoffset=0 xadvance=4 page=0 chnl=15\n"
+            "char id=65 x=0 y=0 width=8 height=10 xoffset=0 yoffset=1 xadvance=9 page=0 chnl=15\n"
+            "char id=66 x=8 y=0 width=8 height=10 xoffset=1 yoffset=1 xadvance=9 page=0 chnl=15\n"
+            "char id=63 x=16 y=0 width=6 height=10 xoffset=0 yoffset=1 xadvance=7 page=0 chnl=15\n"
+            "kerning first=65 second=66 amount=-1\n";
+        for (char c = 'a'; c <= 'z'; ++c)
+            fnt += "char id=" + std::to_string(int(c)) + " x=0 y=16 width=8 height=10 xoffset=0 yoffset=1 xadvance=9 page=0\n";
+        return fnt;
+    }
+
+    blaze::Font make_test_font()
+    {
+        return blaze::Font(test_font_description(), { SDL_CreateSurface(64, 64, SDL_PIXELFORMAT_RGBA32) });
+    }
+
+    blaze::Color32 page_pixel(const blaze::Font& font, int x, int y)
+    {
+        const SDL_Surface* page = font.getPage(0);
+        const uint8_t* pixel = static_cast<const uint8_t*>(page->pixels) + y * page->pitch + x * 4;
+        return blaze::Color32(pixel[0], pixel[1], pixel[2], pixel[3]);
+    }
+
+} // namespace
+
+TEST_CASE("blaze::Font reads BMFont text descriptions", "[Font]") {
+    blaze::Font font = make_test_font();
+
+    CHECK(font.getFace() == "Test Sans");
+    CHECK(font.getSize() == 12.0f);
+    CHECK(font.getLineHeight() == 12.0f);
+    CHECK(font.getBase() == 10.0f);
+    CHECK(font.getGlyphCount() == 30);
+    CHECK(font.getPageCount() == 1);
+
+    const uint32_t a = font.findGlyph(U'A');
+    REQUIRE(a != blaze::Font::no_glyph);
+    CHECK(font.getGlyph(a).src.w == 8.0f);
+    CHECK(font.getGlyph(a).advance == 9.0f);
+    CHECK(font.getGlyph(font.findGlyph(U'B')).offset.x == 1.0f);
+
+    SECTION("Missing characters fall back to '?'") {
+        CHECK(font.findGlyph(U'Z') == font.findGlyph(U'?'));
+        CHECK(font.findGlyph(U'\u00E9') == font.findGlyph(U'?'));
+    }
+
+    SECTION("Kerning applies to its pair only") {
+        CHECK(font.getKerning(U'A', U'B') == -1.0f);
+        CHECK(font.getKerning(U'B', U'A') == 0.0f);
+    }
+
+    SECTION("Fonts have distinct ids") {
+        blaze::Font other = make_test_font();
+        CHECK(other.getId() != font.getId());
+    }
+}
+
+TEST_CASE("blaze::Font rejects malformed descriptions", "[Font]") {
+    auto load = [](const std::string& fnt) {
+        blaze::Font font(fnt, { SDL_CreateSurface(16, 16, SDL_PIXELFORMAT_RGBA32) });
+    };
+
+    CHECK_THROWS_AS(load("info face=\"x\"\n"), std::runtime_error);
+    CHECK_THROWS_AS(load("common lineHeight=12\nchar id=65 x=abc\n"), std::runtime_error);
+    CHECK_THROWS_AS(load("common lineHeight=12\nchar id=65 x=0 y=0 width=8 height=8 page=1\n"), std::runtime_error);
+    CHECK_THROWS_AS(load("common lineHeight=12\nchar id=65 x=12 y=0 width=8 height=8\n"), std::runtime_error);
+
+    try {
+        load("common lineHeight=12\n\nchar id=\"65\n");
+        FAIL("expected an exception");
+    }
+    catch (const std::runtime_error& e) {
+        CHECK(std::string(e.what()).find("line 3") != std::string::npos);
+    }
+}
+
+/*
+    TestFont_0.png is an 8-bit greyscale page: 'A' is 255 on its left
+    half and 128 on its right, 'B' is 64 and the rest of the page 0.
+*/
+TEST_CASE("blaze::Font loads a .fnt file and its pages", "[Font]") {
+    const blaze::Font font(media_dir / "TestFont.fnt");
+
+    CHECK(font.getFace() == "Media Test");
+    CHECK(font.getLineHeight() == 10.0f);
+    REQUIRE(font.getPageCount() == 1);
+    CHECK(font.getPage(0)->format == SDL_PIXELFORMAT_RGBA32);
+    CHECK(font.getPage(0)->w == 32);
+    CHECK(font.getGlyph(font.findGlyph(U'B')).src == blaze::Rect(8.0f, 0.0f, 8.0f, 8.0f));
+
+    // Opaque pages hold coverage: brightness becomes alpha over white.
+    CHECK(page_pixel(font, 1, 1) == blaze::Color32(255, 255, 255, 255));
+    CHECK(page_pixel(font, 5, 1) == blaze::Color32(255, 255, 255, 128));
+    CHECK(page_pixel(font, 9, 1) == blaze::Color32(255, 255, 255, 64));
+    CHECK(page_pixel(font, 20, 12) == blaze::Color32(255, 255, 255, 0));
+}
+
+TEST_CASE("blaze::Font converts opaque pages it is given", "[Font]") {
+    SDL_Surface* page = SDL_CreateSurface(4, 4, SDL_PIXELFORMAT_RGB24);
+    for (int y = 0; y < 4; ++y) {
+        uint8_t* row = static_cast<uint8_t*>(page->pixels) + y * page->pitch;
+        for (int x = 0; x < 4; ++x)
+            row[x * 3] = row[x * 3 + 1] = row[x * 3 + 2] = uint8_t(x * 85);
+    }
+
+    const blaze::Font font("common lineHeight=4\nchar id=65 x=0 y=0 width=4 height=4 xadvance=4\n", { page });
+    CHECK(page_pixel(font, 0, 0) == blaze::Color32(255, 255, 255, 0));
+    CHECK(page_pixel(font, 1, 2) == blaze::Color32(255, 255, 255, 85));
+    CHECK(page_pixel(font, 3, 3) == blaze::Color32(255, 255, 255, 255));
+}
+
+TEST_CASE("blaze::Font reports pages it cannot load", "[Font]") {
+    const blaze::test::TempDir dir("blaze_font_test");
+    std::filesystem::copy_file(media_dir / "TestFont_0.png", dir.path / "page_0.png");
+    const std::string common = "common lineHeight=10 base=8 scaleW=32 scaleH=16 pages=2\n";
+
+    auto message = [&](const std::string& fnt) {
+        std::ofstream(dir.path / "font.fnt", std::ios::binary) << common << fnt;
+        try {
+            blaze::Font font(dir.path / "font.fnt");
+        }
+        catch (const std::runtime_error& e) {
+            return std::string(e.what());
+        }
+        FAIL("the font loaded");
+        return std::string();
+    };
+
+    SECTION("Page ids must not leave gaps") {
+        CHECK(message("page id=1 file=\"page_0.png\"\n").find("page without a file") != std::string::npos);
+    }
+
+    SECTION("Pages that fail to load name their file") {
+        // Page 0 is loaded first and must be released again; LeakSanitizer builds catch it if not.
+        const std::string error = message("page id=0 file=\"page_0.png\"\npage id=1 file=\"missing.png\"\n");
+        CHECK(error.find("Failed to load font page") != std::string::npos);
+        CHECK(error.find("missing.png") != std::string::npos);
+    }
+}
+
+TEST_CASE("blaze::TextRenderer draws a loaded font into a headless window", "[Font][Text]") {
+    blaze::App app;
+    blaze::Window& window = app.createWindow("Text", 32, 16, "", blaze::WindowMode::Headless);
+
+    const blaze::Font font(media_dir / "TestFont.fnt");
+    blaze::GlyphCache cache(window.getRenderer());
+    blaze::TextRenderer text(cache);
+    blaze::SpriteBatch batch;
+
+    window.onRender([&](blaze::Window&, SDL_Renderer* renderer, double) {
+        batch.begin();
+        text.draw(batch, font, "AB", blaze::Vec2(2.0f, 2.0f));
+        batch.end(renderer);
+    });
+    app.render(0.0);
+    app.present();
+
+    // White glyphs over the black clear color, weighted by coverage.
+    auto near = [](uint8_t value, int expected) { return value >= expected - 2 && value <= expected + 2; };
+    CHECK(window.readPixel(3, 3) == blaze::Color32(255, 255, 255, 255));
+    CHECK(near(window.readPixel(7, 3).r, 128));
+    CHECK(near(window.readPixel(12, 3).g, 64));
+    CHECK(window.readPixel(10, 3).b == 0);
+    CHECK(window.readPixel(3, 12).b == 0);
+    CHECK(window.readPixel(0, 0).b == 0);
+}
+
+TEST_CASE("blaze::layout_text places, wraps and aligns glyphs", "[Text]") {
+    blaze::Font font = make_test_font();
+    blaze::TextLayout layout;
+
+    SECTION("Kerning moves the second glyph") {
+        blaze::layout_text(font, "AB", {}, layout);
+        REQUIRE(layout.quads.size() == 2);
+        CHECK(layout.quads[0].dst.x == 0.0f);
+        CHECK(layout.quads[0].dst.y == 1.0f);
+        CHECK(layout.quads[1].dst.x == 9.0f); // advance 9, kerning -1, xoffset 1
+        CHECK(layout.size.x == 17.0f);
+        CHECK(layout.size.y == 12.0f);
+    }
+
+    SECTION("Newlines start lines") {
+        blaze::layout_text(font, "A\nB", {}, layout);
+        REQUIRE(layout.lines.size() == 2);
+        CHECK(layout.quads[1].dst.y == 13.0f);
+        CHECK(layout.size.y == 24.0f);
+    }
+
+    SECTION("Wrapping breaks at the last space") {
+        blaze::TextOptions options;
+        options.max_width = 20.0f;
+        blaze::layout_text(font, "AA AA", options, layout);
+        REQUIRE(layout.lines.size() == 2);
+        CHECK(layout.lines[0].count == 2);
+        CHECK(layout.lines[0].width == 18.0f);
+        CHECK(layout.quads[2].dst.x == 0.0f);
+        CHECK(layout.quads[3].dst.x == 9.0f);
+        CHECK(layout.quads[3].dst.y == 13.0f);
+    }
+
+    SECTION("Long words keep their own line") {
+        blaze::TextOptions options;
+        options.max_width = 10.0f;
+        blaze::layout_text(font, "AAA", options, layout);
+        CHECK(layout.lines.size() == 1);
+    }
+
+    SECTION("Lines align within max_width") {
+        blaze::TextOptions options;
+        options.max_width = 40.0f;
+        options.align = blaze::TextAlign::Center;
+        blaze::layout_text(font, "AA", options, layout);
+        CHECK(layout.quads[0].dst.x == 11.0f);
+
+        options.align = blaze::TextAlign::Right;
+        blaze::layout_text(font, "AA", options, layout);
+        CHECK(layout.quads[0].dst.x == 22.0f);
+    }
+
+    SECTION("Scale applies to positions and sizes") {
+        blaze::TextOptions options;
+        options.scale = 2.0f;
+        blaze::layout_text(font, "AB", options, layout);
+        CHECK(layout.quads[1].dst.x == 18.0f);
+        CHECK(layout.quads[1].dst.w == 16.0f);
+        CHECK(layout.size.y == 24.0f);
+    }
+
+    SECTION("Scale must be positive and finite") {
+        for (const float scale : { 0.0f, -0.0f, -1.0f, std::numeric_limits<float>::quiet_NaN(), std::numeric_limits<float>::infinity() }) {
+            blaze::TextOptions options;
+            options.scale = scale;
+            INFO(scale);
+            CHECK_THROWS_AS(blaze::layout_text(font, "AB", options, layout), std::invalid_argument);
+        }
+    }
+
+    SECTION("Invalid UTF-8 shows the fallback glyph") {
+        blaze::layout_text(font, "A\xFF" "B", {}, layout);
+        REQUIRE(layout.quads.size() == 3);
+        CHECK(layout.quads[1].glyph == font.findGlyph(U'?'));
+
+        blaze::layout_text(font, "\xC3\xA9", {}, layout);
+        REQUIRE(layout.quads.size() == 1);
+        CHECK(layout.quads[0].glyph == font.findGlyph(U'?'));
+    }
+
+    SECTION("Empty text has no size") {
+        blaze::layout_text(font, "", {}, layout);
+        CHECK(layout.quads.empty());
+        CHECK(layout.size == blaze::Vec2());
+    }
+}
+
+TEST_CASE("blaze::GlyphCache packs glyphs and recycles the least recently used page", "[GlyphCache]") {
+    blaze::test::SoftwareTarget target;
+    blaze::Font font = make_test_font();
+
+    // 4 x 3 glyphs per page.
+    blaze::GlyphCacheOptions options;
+    options.page_size = 32;
+    options.max_pages = 2;
+    options.padding = 0;
+    blaze::GlyphCache cache(target.renderer, options);
+
+    auto glyph = [&](char c) { return font.findGlyph(char32_t(c)); };
+
+    std::vector<blaze::CachedGlyph> first;
+    for (char c = 'a'; c < 'a' + 12; ++c)
+        first.push_back(cache.get(font, glyph(c)));
+    CHECK(cache.getPageCount() == 1);
+    CHECK(cache.getStats().misses == 12);
+    CHECK(first[0].uv.w == 0.25f);
+
+    // Cached glyphs come back without another upload.
+    const blaze::CachedGlyph again = cache.get(font, glyph('a'));
+    CHECK(cache.getStats().hits == 1);
+    CHECK(again.uv == first[0].uv);
+
+    cache.beginFrame();
+    for (char c = 'a' + 12; c < 'a' + 24; ++c)
+        cache.get(font, glyph(c));
+    CHECK(cache.getPageCount() == 2);
+    CHECK(cache.getStats().evictions == 0);
+
+    SECTION("A full cache recycles the page unused for longest") {
+        cache.get(font, glyph('y'));
+        CHECK(cache.getPageCount() == 2);
+        CHECK(cache.getStats().evictions == 1);
+        CHECK_FALSE(cache.isCurrent(first[0]));
+        CHECK(cache.getGlyphCount() == 13);
+
+        blaze::CachedGlyph stale = first[0];
+        cache.refresh(font, glyph('a'), stale);
+        CHECK(cache.isCurrent(stale));
+        CHECK(stale.page == first[0].page);
+    }
+
+    SECTION("Pages used this frame are kept; the cache grows instead") {
+        cache.refresh(font, glyph('a'), first[0]);
+        cache.get(font, glyph('y'));
+        CHECK(cache.getPageCount() == 3);
+        CHECK(cache.getStats().evictions == 0);
+        CHECK(cache.isCurrent(first[0]));
+    }
+
+    SECTION("clear() drops every glyph") {
+        cache.clear();
+        CHECK(cache.getGlyphCount() == 0);
+        CHECK_FALSE(cache.isCurrent(first[1]));
+    }
+
+    SECTION("Glyphs must fit a page") {
+        blaze::GlyphCacheOptions tiny;
+        tiny.page_size = 4;
+        blaze::GlyphCache small(target.renderer, tiny);
+        CHECK_THROWS_AS(small.get(font, glyph('a')), std::invalid_argument);
+    }
+}
+
+TEST_CASE("blaze::TextRenderer caches layouts and batches glyph quads", "[Text]") {
+    blaze::test::SoftwareTarget target;
+    blaze::Font font = make_test_font();
+    blaze::GlyphCache cache(target.renderer);
+    blaze::TextRenderer text(cache, 2);
+    blaze::SpriteBatch batch;
+
+    batch.begin();
+    const blaze::Vec2 size = text.draw(batch, font, "AB ab", blaze::Vec2(10.0f, 20.0f));
+    CHECK(size == blaze::Vec2(39.0f, 12.0f));
+    CHECK(batch.size() == 4);
+    CHECK(text.getStats().misses == 1);
+    CHECK(cache.getStats().misses == 4);
+
+    // Unchanged text reuses its layout and its cached glyphs.
+    cache.beginFrame();
+    batch.begin();
+    text.draw(batch, font, "AB ab", blaze::Vec2(10.0f, 20.0f));
+    CHECK(text.getStats().hits == 1);
+    CHECK(cache.getStats().misses == 4);
+    CHECK(batch.end(target.renderer) == 1);
+
+    SECTION("Options are part of the key") {
+        blaze::TextOptions options;
+        options.scale = 2.0f;
+        CHECK(text.measure(font, "AB ab", options) == blaze::Vec2(78.0f, 24.0f));
+        CHECK(text.getStats().misses == 2);
+    }
+
+    SECTION("Options that mean the same layout share one") {
+        // max_width -0, NaN or negative all mean no wrapping, like 0.
+        for (const float width : { 0.0f, -0.0f, -5.0f, std::numeric_limits<float>::quiet_NaN() }) {
+            blaze::TextOptions options;
+            options.max_width = width;
+            INFO(width);
+            CHECK(text.measure(font, "AB ab", options) == size);
+        }
+        CHECK(text.getStats().misses == 1);
+        CHECK(text.getLayoutCount() == 1);
+    }
+
+    SECTION("Invalid options throw without touching the cache") {
+        blaze::TextOptions options;
+        options.scale = std::numeric_limits<float>::quiet_NaN();
+        CHECK_THROWS_AS(text.measure(font, "AB ab", options), std::invalid_argument);
+        CHECK_THROWS_AS(text.measure(font, "new", options), std::invalid_argument);
+        CHECK(text.getLayoutCount() == 1);
+        CHECK(text.getStats().misses == 1);
+        CHECK(text.measure(font, "AB ab") == size);
+    }
+
+    SECTION("The least recently used layout goes first") {
+        text.measure(font, "A", {});
+        text.measure(font, "B", {});
+        CHECK(text.getLayoutCount() == 2);
+
+        text.measure(font, "AB ab", {});
+        CHECK(text.getStats().misses == 4);
+        text.measure(font, "B", {});
+        CHECK(text.getStats().hits == 2);
+    }
+
+    SECTION("Glyphs of recycled pages are looked up again") {
+        cache.clear();
+        batch.begin();
+        text.draw(batch, font, "AB ab", blaze::Vec2());
+        CHECK(cache.getStats().misses == 8);
+        CHECK(cache.getGlyphCount() == 4);
+    }
+}
@@ -0,0 +1,44 @@
+#include <Blaze2D/util/Manifest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <exception>
+
+/*
+    blaze-manifest-compile [--no-name-hash] <input.manifest> <output>
+
+    Parses a text manifest and writes it in the compiled binary format,
+    which blaze::Manifest loads without parsing. By default the perfect hash
+    over asset names is computed here and embedded in the output;
+    --no-name-hash leaves it to be built at load time instead.
+*/
+int main(int argc, char** argv)
+{
+    bool embedNameHash = true;
+    int arg = 1;
+
+    if (arg < argc && std::strcmp(argv[arg], "--no-name-hash") == 0) {
+        embedNameHash = false;
+        ++arg;
+    }
+
+    if (argc - arg != 2) {
+        std::fprintf(stderr, "usage: blaze-manifest-compile [--no-name-hash] <input.manifest> <output>\n");
+        return 2;
+    }
+
+    const char* input = argv[arg];
+    const char* output = argv[arg + 1];
+
+    try {
+        blaze::Manifest manifest(input);
+        manifest.writeCompiled(output, embedNameHash);
+        std::printf("Compiled %zu assets into %s\n", manifest.getAll().size(), output);
+    }
+    catch (const std::exception& e) {
+        std::fprintf(stderr, "blaze-manifest-compile: %s\n", e.what());
+        return 1;
+    }
+
+    return 0;
+}